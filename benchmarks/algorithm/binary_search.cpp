@@ -0,0 +1,109 @@
+#include <nanorange/algorithm/batch_lower_bound.hpp>
+#include <nanorange/algorithm/lower_bound.hpp>
+#include <nanorange/index/eytzinger_index.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "benchmark_utils.hpp"
+
+namespace {
+
+// The number of lookups timed per iteration
+constexpr std::size_t num_keys = 4096;
+
+struct std_lower_bound {
+    template <typename T, typename It>
+    static void run(const std::vector<T>& haystack, const std::vector<T>& keys,
+                    It out)
+    {
+        for (const T& key : keys) {
+            *out++ = std::lower_bound(haystack.begin(), haystack.end(), key);
+        }
+    }
+};
+
+struct nano_lower_bound {
+    template <typename T, typename It>
+    static void run(const std::vector<T>& haystack, const std::vector<T>& keys,
+                    It out)
+    {
+        for (const T& key : keys) {
+            *out++ = nano::lower_bound(haystack, key);
+        }
+    }
+};
+
+struct nano_batch_lower_bound {
+    template <typename T, typename It>
+    static void run(const std::vector<T>& haystack, const std::vector<T>& keys,
+                    It out)
+    {
+        nano::batch_lower_bound(haystack, keys, out);
+    }
+};
+
+// Looks up num_keys random keys in a sorted vector of state.range(0)
+// elements. Items processed counts lookups, not elements.
+template <typename Lib, typename T>
+void lower_bound_random(benchmark::State& state)
+{
+    const auto size = static_cast<std::size_t>(state.range(0));
+    auto haystack = bench::random_values<T>(size, std::uint64_t(1) << 30);
+    std::sort(haystack.begin(), haystack.end());
+    const auto keys =
+        bench::random_values<T>(num_keys, std::uint64_t(1) << 30, 1);
+    std::vector<typename std::vector<T>::const_iterator> results(num_keys);
+
+    for (auto _ : state) {
+        Lib::run(haystack, keys, results.begin());
+        benchmark::DoNotOptimize(results.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<std::int64_t>(num_keys));
+}
+
+// As above, but searching an index built (outside the timed loop) from the
+// sorted vector
+template <typename T>
+void eytzinger_lower_bound_random(benchmark::State& state)
+{
+    const auto size = static_cast<std::size_t>(state.range(0));
+    auto haystack = bench::random_values<T>(size, std::uint64_t(1) << 30);
+    std::sort(haystack.begin(), haystack.end());
+    const nano::eytzinger_index<T> index(haystack);
+    const auto keys =
+        bench::random_values<T>(num_keys, std::uint64_t(1) << 30, 1);
+    std::vector<typename nano::eytzinger_index<T>::iterator> results(num_keys);
+
+    for (auto _ : state) {
+        auto out = results.begin();
+        for (const T& key : keys) {
+            *out++ = index.lower_bound(key);
+        }
+        benchmark::DoNotOptimize(results.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<std::int64_t>(num_keys));
+}
+
+} // namespace
+
+#define NANO_LOWER_BOUND_BENCHMARKS(T)                                         \
+    BENCHMARK_TEMPLATE(lower_bound_random, std_lower_bound, T)                 \
+        ->Apply(bench::set_sizes<T, 1>);                                       \
+    BENCHMARK_TEMPLATE(lower_bound_random, nano_lower_bound, T)                \
+        ->Apply(bench::set_sizes<T, 1>);                                       \
+    BENCHMARK_TEMPLATE(lower_bound_random, nano_batch_lower_bound, T)          \
+        ->Apply(bench::set_sizes<T, 1>);                                       \
+    BENCHMARK_TEMPLATE(eytzinger_lower_bound_random, T)                        \
+        ->Apply(bench::set_sizes<T, 1>)
+
+NANO_LOWER_BOUND_BENCHMARKS(std::int32_t);
+NANO_LOWER_BOUND_BENCHMARKS(std::int64_t);
+NANO_LOWER_BOUND_BENCHMARKS(double);
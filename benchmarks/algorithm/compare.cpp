@@ -0,0 +1,140 @@
+#include <nanorange/algorithm/equal.hpp>
+#include <nanorange/algorithm/lexicographical_compare.hpp>
+#include <nanorange/algorithm/mismatch.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+namespace {
+
+// Buffer sizes in bytes, from 4 KiB to 1 MiB
+void set_sizes(benchmark::internal::Benchmark* bench)
+{
+    bench->RangeMultiplier(4)->Range(4 << 10, 1 << 20);
+}
+
+// Two buffers which are equal up to their final element, so that every
+// algorithm has to examine the whole range
+template <typename F, typename T>
+void compare_contiguous(benchmark::State& state)
+{
+    const auto size = static_cast<std::size_t>(state.range(0)) / sizeof(T);
+    std::vector<T> a(size);
+    for (std::size_t i = 0; i < size; i++) {
+        a[i] = T(i * 31);
+    }
+    std::vector<T> b = a;
+    b.back() = T(~b.back());
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(F{}(a.cbegin(), a.cend(), b.cbegin(), b.cend()));
+    }
+
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+struct std_equal {
+    template <typename I>
+    bool operator()(I first1, I last1, I first2, I last2)
+    {
+        return std::equal(first1, last1, first2, last2);
+    }
+};
+
+struct nano_equal {
+    template <typename I>
+    bool operator()(I first1, I last1, I first2, I last2)
+    {
+        return nano::equal(first1, last1, first2, last2);
+    }
+};
+
+// A predicate other than ranges::equal_to is not vectorised, so this is
+// equivalent to what nano::equal used to do
+struct nano_equal_pred {
+    template <typename I>
+    bool operator()(I first1, I last1, I first2, I last2)
+    {
+        return nano::equal(first1, last1, first2, last2, std::equal_to<>{});
+    }
+};
+
+struct std_mismatch {
+    template <typename I>
+    auto operator()(I first1, I last1, I first2, I last2)
+    {
+        return std::mismatch(first1, last1, first2, last2);
+    }
+};
+
+struct nano_mismatch {
+    template <typename I>
+    auto operator()(I first1, I last1, I first2, I last2)
+    {
+        return nano::mismatch(first1, last1, first2, last2);
+    }
+};
+
+struct nano_mismatch_pred {
+    template <typename I>
+    auto operator()(I first1, I last1, I first2, I last2)
+    {
+        return nano::mismatch(first1, last1, first2, last2, std::equal_to<>{});
+    }
+};
+
+struct std_lexicographical_compare {
+    template <typename I>
+    bool operator()(I first1, I last1, I first2, I last2)
+    {
+        return std::lexicographical_compare(first1, last1, first2, last2);
+    }
+};
+
+struct nano_lexicographical_compare {
+    template <typename I>
+    bool operator()(I first1, I last1, I first2, I last2)
+    {
+        return nano::lexicographical_compare(first1, last1, first2, last2);
+    }
+};
+
+struct nano_lexicographical_compare_comp {
+    template <typename I>
+    bool operator()(I first1, I last1, I first2, I last2)
+    {
+        return nano::lexicographical_compare(first1, last1, first2, last2,
+                                             std::less<>{});
+    }
+};
+
+} // namespace
+
+#define NANO_COMPARE_BENCHMARKS(T)                                             \
+    BENCHMARK_TEMPLATE(compare_contiguous, std_equal, T)->Apply(set_sizes);    \
+    BENCHMARK_TEMPLATE(compare_contiguous, nano_equal, T)->Apply(set_sizes);   \
+    BENCHMARK_TEMPLATE(compare_contiguous, nano_equal_pred, T)                 \
+        ->Apply(set_sizes);                                                    \
+    BENCHMARK_TEMPLATE(compare_contiguous, std_mismatch, T)                    \
+        ->Apply(set_sizes);                                                    \
+    BENCHMARK_TEMPLATE(compare_contiguous, nano_mismatch, T)                   \
+        ->Apply(set_sizes);                                                    \
+    BENCHMARK_TEMPLATE(compare_contiguous, nano_mismatch_pred, T)              \
+        ->Apply(set_sizes);                                                    \
+    BENCHMARK_TEMPLATE(compare_contiguous, std_lexicographical_compare, T)     \
+        ->Apply(set_sizes);                                                    \
+    BENCHMARK_TEMPLATE(compare_contiguous, nano_lexicographical_compare, T)    \
+        ->Apply(set_sizes);                                                    \
+    BENCHMARK_TEMPLATE(compare_contiguous, nano_lexicographical_compare_comp,  \
+                       T)                                                      \
+        ->Apply(set_sizes)
+
+NANO_COMPARE_BENCHMARKS(char);
+NANO_COMPARE_BENCHMARKS(unsigned char);
+NANO_COMPARE_BENCHMARKS(std::byte);
+NANO_COMPARE_BENCHMARKS(int);
@@ -0,0 +1,95 @@
+#include <nanorange/algorithm/copy.hpp>
+#include <nanorange/algorithm/move.hpp>
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+namespace {
+
+struct pod64 {
+    long long data[8];
+};
+
+void set_sizes(benchmark::internal::Benchmark* bench)
+{
+    bench->RangeMultiplier(16)->Range(16, 16 << 20);
+}
+
+template <typename F, typename T>
+void copy_contiguous(benchmark::State& state)
+{
+    const auto size = static_cast<std::size_t>(state.range(0));
+    std::vector<T> in(size);
+    std::vector<T> out(size);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(F{}(in.begin(), in.end(), out.begin()));
+        benchmark::ClobberMemory();
+    }
+
+    state.SetBytesProcessed(state.iterations() * state.range(0) *
+                            static_cast<long long>(sizeof(T)));
+}
+
+struct std_copy {
+    template <typename I, typename O>
+    O operator()(I first, I last, O out)
+    {
+        return std::copy(first, last, out);
+    }
+};
+
+struct nano_copy {
+    template <typename I, typename O>
+    O operator()(I first, I last, O out)
+    {
+        return nano::copy(first, last, out).out;
+    }
+};
+
+struct nano_move {
+    template <typename I, typename O>
+    O operator()(I first, I last, O out)
+    {
+        return nano::move(first, last, out).out;
+    }
+};
+
+struct nano_copy_backward {
+    template <typename I, typename O>
+    O operator()(I first, I last, O out)
+    {
+        return nano::copy_backward(first, last, out + (last - first)).out;
+    }
+};
+
+// A plain element-wise loop, for comparison with what nano::copy used to do
+struct loop_copy {
+    template <typename I, typename O>
+    O operator()(I first, I last, O out)
+    {
+        for (; first != last; ++first, ++out) {
+            *out = *first;
+        }
+        return out;
+    }
+};
+
+} // namespace
+
+// int -------------------------------------------------
+
+BENCHMARK_TEMPLATE(copy_contiguous, std_copy, int)->Apply(set_sizes);
+BENCHMARK_TEMPLATE(copy_contiguous, nano_copy, int)->Apply(set_sizes);
+BENCHMARK_TEMPLATE(copy_contiguous, nano_move, int)->Apply(set_sizes);
+BENCHMARK_TEMPLATE(copy_contiguous, nano_copy_backward, int)->Apply(set_sizes);
+BENCHMARK_TEMPLATE(copy_contiguous, loop_copy, int)->Apply(set_sizes);
+
+// 64-byte struct -------------------------------------------------
+
+BENCHMARK_TEMPLATE(copy_contiguous, std_copy, pod64)->Apply(set_sizes);
+BENCHMARK_TEMPLATE(copy_contiguous, nano_copy, pod64)->Apply(set_sizes);
+BENCHMARK_TEMPLATE(copy_contiguous, loop_copy, pod64)->Apply(set_sizes);
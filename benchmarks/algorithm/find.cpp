@@ -0,0 +1,107 @@
+#include <nanorange/algorithm/count.hpp>
+#include <nanorange/algorithm/find.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+namespace {
+
+void set_sizes(benchmark::internal::Benchmark* bench)
+{
+    bench->RangeMultiplier(16)->Range(16, 16 << 20);
+}
+
+// The value we look for is always in the last position, so that every
+// algorithm has to examine the whole range
+template <typename F, typename T>
+void search_contiguous(benchmark::State& state)
+{
+    const auto size = static_cast<std::size_t>(state.range(0));
+    std::vector<T> vec(size, T(1));
+    vec.back() = T(2);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(F{}(vec.cbegin(), vec.cend(), T(2)));
+    }
+
+    state.SetBytesProcessed(state.iterations() * state.range(0) *
+                            static_cast<long long>(sizeof(T)));
+}
+
+struct std_find {
+    template <typename I, typename T>
+    I operator()(I first, I last, const T& value)
+    {
+        return std::find(first, last, value);
+    }
+};
+
+struct nano_find {
+    template <typename I, typename T>
+    I operator()(I first, I last, const T& value)
+    {
+        return nano::find(first, last, value);
+    }
+};
+
+// find_if() with an arbitrary predicate is not vectorised, so this is
+// equivalent to what nano::find used to do
+struct nano_find_if {
+    template <typename I, typename T>
+    I operator()(I first, I last, const T& value)
+    {
+        return nano::find_if(first, last,
+                             [&value](const T& t) { return t == value; });
+    }
+};
+
+struct std_count {
+    template <typename I, typename T>
+    auto operator()(I first, I last, const T& value)
+    {
+        return std::count(first, last, value);
+    }
+};
+
+struct nano_count {
+    template <typename I, typename T>
+    auto operator()(I first, I last, const T& value)
+    {
+        return nano::count(first, last, value);
+    }
+};
+
+} // namespace
+
+// uint8_t -------------------------------------------------
+
+BENCHMARK_TEMPLATE(search_contiguous, std_find, std::uint8_t)->Apply(set_sizes);
+BENCHMARK_TEMPLATE(search_contiguous, nano_find, std::uint8_t)->Apply(set_sizes);
+BENCHMARK_TEMPLATE(search_contiguous, nano_find_if, std::uint8_t)->Apply(set_sizes);
+BENCHMARK_TEMPLATE(search_contiguous, std_count, std::uint8_t)->Apply(set_sizes);
+BENCHMARK_TEMPLATE(search_contiguous, nano_count, std::uint8_t)->Apply(set_sizes);
+
+// int -------------------------------------------------
+
+BENCHMARK_TEMPLATE(search_contiguous, std_find, int)->Apply(set_sizes);
+BENCHMARK_TEMPLATE(search_contiguous, nano_find, int)->Apply(set_sizes);
+BENCHMARK_TEMPLATE(search_contiguous, nano_find_if, int)->Apply(set_sizes);
+BENCHMARK_TEMPLATE(search_contiguous, std_count, int)->Apply(set_sizes);
+BENCHMARK_TEMPLATE(search_contiguous, nano_count, int)->Apply(set_sizes);
+
+// int64_t -------------------------------------------------
+
+BENCHMARK_TEMPLATE(search_contiguous, std_find, std::int64_t)->Apply(set_sizes);
+BENCHMARK_TEMPLATE(search_contiguous, nano_find, std::int64_t)->Apply(set_sizes);
+BENCHMARK_TEMPLATE(search_contiguous, std_count, std::int64_t)->Apply(set_sizes);
+BENCHMARK_TEMPLATE(search_contiguous, nano_count, std::int64_t)->Apply(set_sizes);
+
+// double -------------------------------------------------
+
+BENCHMARK_TEMPLATE(search_contiguous, std_find, double)->Apply(set_sizes);
+BENCHMARK_TEMPLATE(search_contiguous, nano_find, double)->Apply(set_sizes);
+BENCHMARK_TEMPLATE(search_contiguous, std_count, double)->Apply(set_sizes);
+BENCHMARK_TEMPLATE(search_contiguous, nano_count, double)->Apply(set_sizes);
@@ -0,0 +1,166 @@
+#include <nanorange/algorithm/make_heap.hpp>
+#include <nanorange/algorithm/make_heap_d.hpp>
+#include <nanorange/algorithm/pop_heap.hpp>
+#include <nanorange/algorithm/pop_heap_d.hpp>
+#include <nanorange/algorithm/push_heap.hpp>
+#include <nanorange/algorithm/push_heap_d.hpp>
+#include <nanorange/algorithm/sort_heap.hpp>
+#include <nanorange/algorithm/sort_heap_d.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "benchmark_utils.hpp"
+
+namespace {
+
+// 10^3 to 10^8 elements, skipping sizes whose inputs would not fit in
+// bench::max_input_bytes
+template <typename T, long long MaxSize = 100'000'000>
+void set_sizes(benchmark::internal::Benchmark* bench)
+{
+    for (long long size = 1000; size <= MaxSize; size *= 10) {
+        if (static_cast<std::size_t>(size) * bench::footprint<T>() * 2 <=
+            bench::max_input_bytes) {
+            bench->Arg(size);
+        }
+    }
+}
+
+struct std_heap {
+    template <typename I>
+    static void make_heap(I first, I last) { std::make_heap(first, last); }
+
+    template <typename I>
+    static void push_heap(I first, I last) { std::push_heap(first, last); }
+
+    template <typename I>
+    static void pop_heap(I first, I last) { std::pop_heap(first, last); }
+
+    template <typename I>
+    static void sort_heap(I first, I last) { std::sort_heap(first, last); }
+};
+
+struct nano_binary_heap {
+    template <typename I>
+    static void make_heap(I first, I last) { nano::make_heap(first, last); }
+
+    template <typename I>
+    static void push_heap(I first, I last) { nano::push_heap(first, last); }
+
+    template <typename I>
+    static void pop_heap(I first, I last) { nano::pop_heap(first, last); }
+
+    template <typename I>
+    static void sort_heap(I first, I last) { nano::sort_heap(first, last); }
+};
+
+template <std::size_t D>
+struct nano_dary_heap {
+    template <typename I>
+    static void make_heap(I first, I last)
+    {
+        nano::make_heap_d<D>(first, last);
+    }
+
+    template <typename I>
+    static void push_heap(I first, I last)
+    {
+        nano::push_heap_d<D>(first, last);
+    }
+
+    template <typename I>
+    static void pop_heap(I first, I last)
+    {
+        nano::pop_heap_d<D>(first, last);
+    }
+
+    template <typename I>
+    static void sort_heap(I first, I last)
+    {
+        nano::sort_heap_d<D>(first, last);
+    }
+};
+
+template <typename Heap, typename T>
+void make_heap_random(benchmark::State& state)
+{
+    const auto input =
+        bench::random_values<T>(static_cast<std::size_t>(state.range(0)));
+    std::vector<T> vec;
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        vec = input;
+        state.ResumeTiming();
+
+        Heap::make_heap(vec.begin(), vec.end());
+        benchmark::DoNotOptimize(vec.data());
+    }
+
+    bench::set_items_processed(state);
+}
+
+// A priority queue in steady state: each iteration removes the top element
+// and inserts a new one, so the heap stays the same size
+template <typename Heap, typename T>
+void pop_push_random(benchmark::State& state)
+{
+    const auto size = static_cast<std::size_t>(state.range(0));
+    auto vec = bench::random_values<T>(size);
+    Heap::make_heap(vec.begin(), vec.end());
+    const auto incoming =
+        bench::random_values<T>(4096, std::uint64_t(1) << 62, 1);
+    std::size_t i = 0;
+
+    for (auto _ : state) {
+        Heap::pop_heap(vec.begin(), vec.end());
+        vec.back() = incoming[i++ % incoming.size()];
+        Heap::push_heap(vec.begin(), vec.end());
+        benchmark::DoNotOptimize(vec.data());
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+template <typename Heap, typename T>
+void sort_heap_random(benchmark::State& state)
+{
+    auto input =
+        bench::random_values<T>(static_cast<std::size_t>(state.range(0)));
+    Heap::make_heap(input.begin(), input.end());
+    std::vector<T> vec;
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        vec = input;
+        state.ResumeTiming();
+
+        Heap::sort_heap(vec.begin(), vec.end());
+        benchmark::DoNotOptimize(vec.data());
+    }
+
+    bench::set_items_processed(state);
+}
+
+} // namespace
+
+// Sorting 10^8 elements a heap at a time takes tens of seconds per
+// iteration, so sort_heap stops at 10^7
+#define NANO_HEAP_D_BENCHMARKS(heap, T)                                        \
+    BENCHMARK_TEMPLATE(make_heap_random, heap, T)->Apply(set_sizes<T>);        \
+    BENCHMARK_TEMPLATE(pop_push_random, heap, T)->Apply(set_sizes<T>);         \
+    BENCHMARK_TEMPLATE(sort_heap_random, heap, T)                              \
+        ->Apply(set_sizes<T, 10'000'000>)
+
+#define NANO_HEAP_D_ALL(T)                                                     \
+    NANO_HEAP_D_BENCHMARKS(std_heap, T);                                       \
+    NANO_HEAP_D_BENCHMARKS(nano_binary_heap, T);                               \
+    NANO_HEAP_D_BENCHMARKS(nano_dary_heap<2>, T);                              \
+    NANO_HEAP_D_BENCHMARKS(nano_dary_heap<4>, T);                              \
+    NANO_HEAP_D_BENCHMARKS(nano_dary_heap<8>, T)
+
+NANO_HEAP_D_ALL(int);
+NANO_HEAP_D_ALL(bench::record64);
@@ -0,0 +1,188 @@
+#include <nanorange/algorithm/is_heap.hpp>
+#include <nanorange/algorithm/make_heap.hpp>
+#include <nanorange/algorithm/pop_heap.hpp>
+#include <nanorange/algorithm/push_heap.hpp>
+#include <nanorange/algorithm/sort_heap.hpp>
+
+#include <algorithm>
+#include <vector>
+
+#include "benchmark_utils.hpp"
+
+namespace {
+
+struct std_lib {
+    template <typename I>
+    static void make_heap(I first, I last) { std::make_heap(first, last); }
+
+    template <typename I>
+    static void push_heap(I first, I last) { std::push_heap(first, last); }
+
+    template <typename I>
+    static void pop_heap(I first, I last) { std::pop_heap(first, last); }
+
+    template <typename I>
+    static void sort_heap(I first, I last) { std::sort_heap(first, last); }
+
+    template <typename I>
+    static bool is_heap(I first, I last) { return std::is_heap(first, last); }
+};
+
+#ifdef NANO_BENCHMARK_HAVE_STD_RANGES
+struct ranges_lib {
+    template <typename I>
+    static void make_heap(I first, I last)
+    {
+        std::ranges::make_heap(first, last);
+    }
+
+    template <typename I>
+    static void push_heap(I first, I last)
+    {
+        std::ranges::push_heap(first, last);
+    }
+
+    template <typename I>
+    static void pop_heap(I first, I last)
+    {
+        std::ranges::pop_heap(first, last);
+    }
+
+    template <typename I>
+    static void sort_heap(I first, I last)
+    {
+        std::ranges::sort_heap(first, last);
+    }
+
+    template <typename I>
+    static bool is_heap(I first, I last)
+    {
+        return std::ranges::is_heap(first, last);
+    }
+};
+#endif
+
+struct nano_lib {
+    template <typename I>
+    static void make_heap(I first, I last) { nano::make_heap(first, last); }
+
+    template <typename I>
+    static void push_heap(I first, I last) { nano::push_heap(first, last); }
+
+    template <typename I>
+    static void pop_heap(I first, I last) { nano::pop_heap(first, last); }
+
+    template <typename I>
+    static void sort_heap(I first, I last) { nano::sort_heap(first, last); }
+
+    template <typename I>
+    static bool is_heap(I first, I last) { return nano::is_heap(first, last); }
+};
+
+template <typename T>
+std::vector<T> random_heap(std::size_t size)
+{
+    auto vec = bench::random_values<T>(size);
+    std::make_heap(vec.begin(), vec.end());
+    return vec;
+}
+
+template <typename Lib, typename T>
+void make_heap_random(benchmark::State& state)
+{
+    const auto input =
+        bench::random_values<T>(static_cast<std::size_t>(state.range(0)));
+    std::vector<T> vec;
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        vec = input;
+        state.ResumeTiming();
+
+        Lib::make_heap(vec.begin(), vec.end());
+        benchmark::DoNotOptimize(vec.data());
+    }
+
+    bench::set_items_processed(state);
+}
+
+// Builds a heap one element at a time
+template <typename Lib, typename T>
+void push_heap_random(benchmark::State& state)
+{
+    const auto input =
+        bench::random_values<T>(static_cast<std::size_t>(state.range(0)));
+    std::vector<T> vec;
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        vec = input;
+        state.ResumeTiming();
+
+        for (auto it = vec.begin(); it != vec.end(); ++it) {
+            Lib::push_heap(vec.begin(), it + 1);
+        }
+        benchmark::DoNotOptimize(vec.data());
+    }
+
+    bench::set_items_processed(state);
+}
+
+// Empties a heap one element at a time
+template <typename Lib, typename T>
+void pop_heap_random(benchmark::State& state)
+{
+    const auto input = random_heap<T>(static_cast<std::size_t>(state.range(0)));
+    std::vector<T> vec;
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        vec = input;
+        state.ResumeTiming();
+
+        for (auto it = vec.end(); it != vec.begin(); --it) {
+            Lib::pop_heap(vec.begin(), it);
+        }
+        benchmark::DoNotOptimize(vec.data());
+    }
+
+    bench::set_items_processed(state);
+}
+
+template <typename Lib, typename T>
+void sort_heap_random(benchmark::State& state)
+{
+    const auto input = random_heap<T>(static_cast<std::size_t>(state.range(0)));
+    std::vector<T> vec;
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        vec = input;
+        state.ResumeTiming();
+
+        Lib::sort_heap(vec.begin(), vec.end());
+        benchmark::DoNotOptimize(vec.data());
+    }
+
+    bench::set_items_processed(state);
+}
+
+template <typename Lib, typename T>
+void is_heap_random(benchmark::State& state)
+{
+    const auto vec = random_heap<T>(static_cast<std::size_t>(state.range(0)));
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Lib::is_heap(vec.begin(), vec.end()));
+    }
+
+    bench::set_items_processed(state);
+}
+
+} // namespace
+
+NANO_BENCHMARK_ALL(make_heap_random);
+NANO_BENCHMARK_ALL(push_heap_random);
+NANO_BENCHMARK_ALL(pop_heap_random);
+NANO_BENCHMARK_ALL(sort_heap_random);
+NANO_BENCHMARK_ALL(is_heap_random);
@@ -0,0 +1,133 @@
+#include <nanorange/algorithm/inplace_merge.hpp>
+#include <nanorange/algorithm/merge.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "benchmark_utils.hpp"
+
+namespace {
+
+// The shapes of input. Each is a pair of sorted ranges of about size / 2
+// elements, whose values alternate between the two ranges:
+//  - interleaved: each value goes to either range at random, as for two
+//    random samples
+//  - blocky: in runs of about a thousand, as time series from two sources
+//    which each report in bursts
+//  - disjoint: in a single run each, as back-to-back time windows
+enum class shape { interleaved, blocky, disjoint };
+
+template <typename T>
+std::vector<T> make_input(std::size_t size, shape s)
+{
+    std::mt19937_64 gen{};
+    std::size_t run = 1;
+    if (s == shape::blocky) {
+        run = 1000;
+    } else if (s == shape::disjoint) {
+        run = size / 2 > 0 ? size / 2 : 1;
+    }
+    std::uniform_int_distribution<std::size_t> run_len(1, 2 * run - 1);
+    std::bernoulli_distribution coin;
+
+    // Values go alternately to each half, a run at a time
+    std::vector<T> first;
+    std::vector<T> second;
+    std::uint64_t value = 0;
+    bool to_first = true;
+    while (first.size() + second.size() < size) {
+        auto& half = to_first ? first : second;
+        std::size_t n = s == shape::interleaved ? 1 : run_len(gen);
+        n = std::min(n, size - first.size() - second.size());
+        for (; n > 0; --n) {
+            half.push_back(static_cast<T>(value++));
+        }
+        to_first = s == shape::interleaved ? coin(gen) : !to_first;
+    }
+
+    first.insert(first.end(), second.begin(), second.end());
+    return first;
+}
+
+struct std_lib {
+    template <typename I, typename O>
+    static void merge(I first, I middle, I last, O out)
+    {
+        std::merge(first, middle, middle, last, out);
+    }
+
+    template <typename I>
+    static void inplace_merge(I first, I middle, I last)
+    {
+        std::inplace_merge(first, middle, last);
+    }
+};
+
+struct nano_lib {
+    template <typename I, typename O>
+    static void merge(I first, I middle, I last, O out)
+    {
+        nano::merge(first, middle, middle, last, out);
+    }
+
+    template <typename I>
+    static void inplace_merge(I first, I middle, I last)
+    {
+        nano::inplace_merge(first, middle, last);
+    }
+};
+
+template <typename Lib, typename T, shape S>
+void merge_shape(benchmark::State& state)
+{
+    const auto size = static_cast<std::size_t>(state.range(0));
+    const auto input = make_input<T>(size, S);
+    const auto middle = input.begin() + static_cast<std::ptrdiff_t>(
+        std::is_sorted_until(input.begin(), input.end()) - input.begin());
+    std::vector<T> out(size);
+
+    for (auto _ : state) {
+        Lib::merge(input.begin(), middle, input.end(), out.begin());
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+
+    bench::set_items_processed(state);
+}
+
+template <typename Lib, typename T, shape S>
+void inplace_merge_shape(benchmark::State& state)
+{
+    const auto size = static_cast<std::size_t>(state.range(0));
+    const auto input = make_input<T>(size, S);
+    const auto split = std::is_sorted_until(input.begin(), input.end()) -
+                       input.begin();
+    auto vec = input;
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        std::copy(input.begin(), input.end(), vec.begin());
+        state.ResumeTiming();
+        Lib::inplace_merge(vec.begin(), vec.begin() + split, vec.end());
+        benchmark::ClobberMemory();
+    }
+
+    bench::set_items_processed(state);
+}
+
+} // namespace
+
+#define NANO_MERGE_BENCHMARKS(func, lib)                                       \
+    BENCHMARK_TEMPLATE(func, lib, int, shape::interleaved)                     \
+        ->Apply(bench::set_sizes<int, 3>);                                     \
+    BENCHMARK_TEMPLATE(func, lib, int, shape::blocky)                          \
+        ->Apply(bench::set_sizes<int, 3>);                                     \
+    BENCHMARK_TEMPLATE(func, lib, int, shape::disjoint)                        \
+        ->Apply(bench::set_sizes<int, 3>)
+
+NANO_MERGE_BENCHMARKS(merge_shape, std_lib);
+NANO_MERGE_BENCHMARKS(merge_shape, nano_lib);
+NANO_MERGE_BENCHMARKS(inplace_merge_shape, std_lib);
+NANO_MERGE_BENCHMARKS(inplace_merge_shape, nano_lib);
@@ -0,0 +1,119 @@
+#include <nanorange/algorithm/max_element.hpp>
+#include <nanorange/algorithm/min_element.hpp>
+#include <nanorange/algorithm/minmax_element.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+namespace {
+
+void set_sizes(benchmark::internal::Benchmark* bench)
+{
+    bench->RangeMultiplier(16)->Range(16, 16 << 20);
+}
+
+// Random samples, so that new extrema are found early on and then rarely
+template <typename F, typename T>
+void reduce_contiguous(benchmark::State& state)
+{
+    const auto size = static_cast<std::size_t>(state.range(0));
+    std::mt19937 gen{};
+    std::uniform_int_distribution<int> dist(0, 100);
+    std::vector<T> vec(size);
+    std::generate(vec.begin(), vec.end(), [&] { return T(dist(gen)); });
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(F{}(vec.cbegin(), vec.cend()));
+    }
+
+    state.SetBytesProcessed(state.iterations() * state.range(0) *
+                            static_cast<long long>(sizeof(T)));
+}
+
+struct std_min_element {
+    template <typename I>
+    I operator()(I first, I last)
+    {
+        return std::min_element(first, last);
+    }
+};
+
+struct nano_min_element {
+    template <typename I>
+    I operator()(I first, I last)
+    {
+        return nano::min_element(first, last);
+    }
+};
+
+// A comparator other than ranges::less is not vectorised, so this is
+// equivalent to what nano::min_element used to do
+struct nano_min_element_comp {
+    template <typename I>
+    I operator()(I first, I last)
+    {
+        return nano::min_element(first, last, std::less<>{});
+    }
+};
+
+struct std_max_element {
+    template <typename I>
+    I operator()(I first, I last)
+    {
+        return std::max_element(first, last);
+    }
+};
+
+struct nano_max_element {
+    template <typename I>
+    I operator()(I first, I last)
+    {
+        return nano::max_element(first, last);
+    }
+};
+
+struct std_minmax_element {
+    template <typename I>
+    auto operator()(I first, I last)
+    {
+        return std::minmax_element(first, last);
+    }
+};
+
+struct nano_minmax_element {
+    template <typename I>
+    auto operator()(I first, I last)
+    {
+        return nano::minmax_element(first, last);
+    }
+};
+
+} // namespace
+
+#define NANO_MINMAX_BENCHMARKS(T)                                              \
+    BENCHMARK_TEMPLATE(reduce_contiguous, std_min_element, T)                  \
+        ->Apply(set_sizes);                                                    \
+    BENCHMARK_TEMPLATE(reduce_contiguous, nano_min_element, T)                 \
+        ->Apply(set_sizes);                                                    \
+    BENCHMARK_TEMPLATE(reduce_contiguous, nano_min_element_comp, T)            \
+        ->Apply(set_sizes);                                                    \
+    BENCHMARK_TEMPLATE(reduce_contiguous, std_max_element, T)                  \
+        ->Apply(set_sizes);                                                    \
+    BENCHMARK_TEMPLATE(reduce_contiguous, nano_max_element, T)                 \
+        ->Apply(set_sizes);                                                    \
+    BENCHMARK_TEMPLATE(reduce_contiguous, std_minmax_element, T)               \
+        ->Apply(set_sizes);                                                    \
+    BENCHMARK_TEMPLATE(reduce_contiguous, nano_minmax_element, T)              \
+        ->Apply(set_sizes)
+
+NANO_MINMAX_BENCHMARKS(std::uint8_t);
+NANO_MINMAX_BENCHMARKS(std::int16_t);
+NANO_MINMAX_BENCHMARKS(int);
+NANO_MINMAX_BENCHMARKS(std::int64_t);
+NANO_MINMAX_BENCHMARKS(float);
+NANO_MINMAX_BENCHMARKS(double);
@@ -0,0 +1,261 @@
+#include <nanorange/algorithm/copy.hpp>
+#include <nanorange/algorithm/fill.hpp>
+#include <nanorange/algorithm/fill_n.hpp>
+#include <nanorange/algorithm/generate.hpp>
+#include <nanorange/algorithm/move.hpp>
+#include <nanorange/algorithm/transform.hpp>
+
+#include <algorithm>
+#include <vector>
+
+#include "benchmark_utils.hpp"
+
+namespace {
+
+struct std_lib {
+    template <typename V, typename O>
+    static O copy(const V& v, O out)
+    {
+        return std::copy(v.begin(), v.end(), out);
+    }
+
+    template <typename V, typename O>
+    static O copy_backward(const V& v, O out)
+    {
+        return std::copy_backward(v.begin(), v.end(), out);
+    }
+
+    template <typename V, typename O>
+    static O move(V& v, O out)
+    {
+        return std::move(v.begin(), v.end(), out);
+    }
+
+    template <typename V, typename T>
+    static void fill(V& v, const T& t) { std::fill(v.begin(), v.end(), t); }
+
+    template <typename V, typename T>
+    static void fill_n(V& v, const T& t)
+    {
+        std::fill_n(v.begin(), v.size(), t);
+    }
+
+    template <typename V, typename G>
+    static void generate(V& v, G gen)
+    {
+        std::generate(v.begin(), v.end(), gen);
+    }
+};
+
+#ifdef NANO_BENCHMARK_HAVE_STD_RANGES
+struct ranges_lib {
+    template <typename V, typename O>
+    static O copy(const V& v, O out)
+    {
+        return std::ranges::copy(v, out).out;
+    }
+
+    template <typename V, typename O>
+    static O copy_backward(const V& v, O out)
+    {
+        return std::ranges::copy_backward(v, out).out;
+    }
+
+    template <typename V, typename O>
+    static O move(V& v, O out)
+    {
+        return std::ranges::move(v, out).out;
+    }
+
+    template <typename V, typename T>
+    static void fill(V& v, const T& t) { std::ranges::fill(v, t); }
+
+    template <typename V, typename T>
+    static void fill_n(V& v, const T& t)
+    {
+        std::ranges::fill_n(v.begin(), v.size(), t);
+    }
+
+    template <typename V, typename G>
+    static void generate(V& v, G gen) { std::ranges::generate(v, gen); }
+};
+#endif
+
+struct nano_lib {
+    template <typename V, typename O>
+    static O copy(const V& v, O out)
+    {
+        return nano::copy(v, out).out;
+    }
+
+    template <typename V, typename O>
+    static O copy_backward(const V& v, O out)
+    {
+        return nano::copy_backward(v, out).out;
+    }
+
+    template <typename V, typename O>
+    static O move(V& v, O out)
+    {
+        return nano::move(v, out).out;
+    }
+
+    template <typename V, typename T>
+    static void fill(V& v, const T& t) { nano::fill(v, t); }
+
+    template <typename V, typename T>
+    static void fill_n(V& v, const T& t)
+    {
+        nano::fill_n(v.begin(), static_cast<std::ptrdiff_t>(v.size()), t);
+    }
+
+    template <typename V, typename G>
+    static void generate(V& v, G gen) { nano::generate(v, gen); }
+};
+
+template <typename T>
+void set_bytes_processed(benchmark::State& state)
+{
+    state.SetBytesProcessed(state.iterations() * state.range(0) *
+                            static_cast<long long>(sizeof(T)));
+}
+
+template <typename Lib, typename T>
+void copy_random(benchmark::State& state)
+{
+    const auto size = static_cast<std::size_t>(state.range(0));
+    const auto in = bench::random_values<T>(size);
+    std::vector<T> out(size);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Lib::copy(in, out.begin()));
+        benchmark::ClobberMemory();
+    }
+
+    set_bytes_processed<T>(state);
+}
+
+template <typename Lib, typename T>
+void copy_backward_random(benchmark::State& state)
+{
+    const auto size = static_cast<std::size_t>(state.range(0));
+    const auto in = bench::random_values<T>(size);
+    std::vector<T> out(size);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Lib::copy_backward(in, out.end()));
+        benchmark::ClobberMemory();
+    }
+
+    set_bytes_processed<T>(state);
+}
+
+// Moving back and forth between two buffers, so that moved-from strings are
+// never the source
+template <typename Lib, typename T>
+void move_random(benchmark::State& state)
+{
+    const auto size = static_cast<std::size_t>(state.range(0));
+    auto a = bench::random_values<T>(size);
+    std::vector<T> b(size);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Lib::move(a, b.begin()));
+        benchmark::ClobberMemory();
+        a.swap(b);
+    }
+
+    set_bytes_processed<T>(state);
+}
+
+template <typename Lib, typename T>
+void fill_value(benchmark::State& state)
+{
+    std::vector<T> vec(static_cast<std::size_t>(state.range(0)));
+    const auto value = bench::make_value<T>(42);
+
+    for (auto _ : state) {
+        Lib::fill(vec, value);
+        benchmark::ClobberMemory();
+    }
+
+    set_bytes_processed<T>(state);
+}
+
+template <typename Lib, typename T>
+void fill_n_value(benchmark::State& state)
+{
+    std::vector<T> vec(static_cast<std::size_t>(state.range(0)));
+    const auto value = bench::make_value<T>(42);
+
+    for (auto _ : state) {
+        Lib::fill_n(vec, value);
+        benchmark::ClobberMemory();
+    }
+
+    set_bytes_processed<T>(state);
+}
+
+template <typename Lib, typename T>
+void generate_counter(benchmark::State& state)
+{
+    std::vector<T> vec(static_cast<std::size_t>(state.range(0)));
+
+    for (auto _ : state) {
+        Lib::generate(vec, [i = std::uint64_t{0}]() mutable {
+            return bench::make_value<T>(i++);
+        });
+        benchmark::ClobberMemory();
+    }
+
+    set_bytes_processed<T>(state);
+}
+
+// Args are {number of elements, pool concurrency}
+void set_thread_counts(benchmark::internal::Benchmark* bench)
+{
+    const int max_threads =
+        static_cast<int>(nano::thread_pool::default_concurrency());
+
+    for (int size : {1'000'000, 16'000'000}) {
+        for (int threads = 1; threads < max_threads; threads *= 2) {
+            bench->Args({size, threads});
+        }
+        bench->Args({size, max_threads});
+    }
+}
+
+// An element-wise transform of the kind done when converting units,
+// sequentially and on pools of various sizes
+template <bool Parallel>
+void transform_scale(benchmark::State& state)
+{
+    const auto size = static_cast<std::size_t>(state.range(0));
+    nano::thread_pool pool(static_cast<std::size_t>(state.range(1)));
+    const auto in = bench::random_values<double>(size);
+    std::vector<double> out(size);
+    const auto op = [](double d) { return d * 1.8 + 32.0; };
+
+    for (auto _ : state) {
+        if constexpr (Parallel) {
+            nano::transform(nano::par.on(pool), in, out.begin(), op);
+        } else {
+            std::transform(in.begin(), in.end(), out.begin(), op);
+        }
+        benchmark::ClobberMemory();
+    }
+
+    set_bytes_processed<double>(state);
+}
+
+} // namespace
+
+NANO_BENCHMARK_ALL(copy_random);
+NANO_BENCHMARK_ALL(copy_backward_random);
+NANO_BENCHMARK_ALL(move_random);
+NANO_BENCHMARK_ALL_COPIES(fill_value, 1);
+NANO_BENCHMARK_ALL_COPIES(fill_n_value, 1);
+NANO_BENCHMARK_ALL_COPIES(generate_counter, 1);
+
+BENCHMARK_TEMPLATE(transform_scale, false)->Apply(set_thread_counts)->UseRealTime();
+BENCHMARK_TEMPLATE(transform_scale, true)->Apply(set_thread_counts)->UseRealTime();
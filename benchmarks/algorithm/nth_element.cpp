@@ -0,0 +1,145 @@
+#include <nanorange/algorithm/nth_element.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+namespace {
+
+// Args are {number of elements, pool concurrency}
+void set_thread_counts(benchmark::internal::Benchmark* bench)
+{
+    const int max_threads =
+        static_cast<int>(nano::thread_pool::default_concurrency());
+
+    for (int size : {1'000'000, 10'000'000, 100'000'000}) {
+        for (int threads = 1; threads < max_threads; threads *= 2) {
+            bench->Args({size, threads});
+        }
+        bench->Args({size, max_threads});
+    }
+}
+
+void set_sizes(benchmark::internal::Benchmark* bench)
+{
+    for (int size : {1'000, 100'000, 1'000'000, 10'000'000, 100'000'000}) {
+        bench->Args({size, 1});
+    }
+}
+
+template <typename T>
+std::vector<T> random_values(std::size_t size)
+{
+    std::mt19937_64 gen{};
+    std::vector<T> vec(size);
+    if constexpr (std::is_floating_point<T>::value) {
+        std::uniform_real_distribution<T> dist;
+        for (auto& t : vec) {
+            t = dist(gen);
+        }
+    } else {
+        std::uniform_int_distribution<T> dist;
+        for (auto& t : vec) {
+            t = dist(gen);
+        }
+    }
+    return vec;
+}
+
+// Ascending then descending, which defeats a median-of-three pivot
+template <typename T>
+std::vector<T> organ_pipe_values(std::size_t size)
+{
+    std::vector<T> vec(size);
+    for (std::size_t i = 0; i < size; i++) {
+        vec[i] = static_cast<T>(i < size / 2 ? i : size - i);
+    }
+    return vec;
+}
+
+// A handful of distinct values, as with quantised latencies
+template <typename T>
+std::vector<T> few_unique_values(std::size_t size)
+{
+    auto vec = random_values<T>(size);
+    for (auto& t : vec) {
+        t = static_cast<T>(static_cast<std::uint64_t>(t) % 16);
+    }
+    return vec;
+}
+
+// The 99th percentile
+template <typename Rng>
+auto p99(Rng& rng)
+{
+    return rng.begin() + static_cast<std::ptrdiff_t>(rng.size() * 99 / 100);
+}
+
+struct std_nth_element {
+    template <typename Rng>
+    void operator()(nano::thread_pool&, Rng& rng)
+    {
+        std::nth_element(rng.begin(), p99(rng), rng.end());
+    }
+};
+
+struct nano_nth_element {
+    template <typename Rng>
+    void operator()(nano::thread_pool&, Rng& rng)
+    {
+        nano::nth_element(rng, p99(rng));
+    }
+};
+
+struct nano_par_nth_element {
+    template <typename Rng>
+    void operator()(nano::thread_pool& pool, Rng& rng)
+    {
+        nano::nth_element(nano::par.on(pool), rng, p99(rng));
+    }
+};
+
+template <typename F, typename T, std::vector<T> (*Make)(std::size_t)>
+void nth_element_p99(benchmark::State& state)
+{
+    const auto size = static_cast<std::size_t>(state.range(0));
+    nano::thread_pool pool(static_cast<std::size_t>(state.range(1)));
+
+    const auto input = Make(size);
+    std::vector<T> vec;
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        vec = input;
+        state.ResumeTiming();
+
+        F{}(pool, vec);
+        benchmark::DoNotOptimize(vec.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+} // namespace
+
+#define NANO_NTH_ELEMENT_BENCHMARKS(T, make)                                   \
+    BENCHMARK_TEMPLATE(nth_element_p99, std_nth_element, T, make<T>)           \
+        ->Apply(set_sizes)->Unit(benchmark::kMicrosecond)->UseRealTime();      \
+    BENCHMARK_TEMPLATE(nth_element_p99, nano_nth_element, T, make<T>)          \
+        ->Apply(set_sizes)->Unit(benchmark::kMicrosecond)->UseRealTime();      \
+    BENCHMARK_TEMPLATE(nth_element_p99, nano_par_nth_element, T, make<T>)      \
+        ->Apply(set_thread_counts)->Unit(benchmark::kMicrosecond)->UseRealTime()
+
+// int -------------------------------------------------
+
+NANO_NTH_ELEMENT_BENCHMARKS(int, random_values);
+NANO_NTH_ELEMENT_BENCHMARKS(int, organ_pipe_values);
+NANO_NTH_ELEMENT_BENCHMARKS(int, few_unique_values);
+
+// double -------------------------------------------------
+
+NANO_NTH_ELEMENT_BENCHMARKS(double, random_values);
@@ -0,0 +1,284 @@
+#include <nanorange/algorithm/is_partitioned.hpp>
+#include <nanorange/algorithm/partition.hpp>
+#include <nanorange/algorithm/partition_copy.hpp>
+#include <nanorange/algorithm/partition_point.hpp>
+#include <nanorange/algorithm/stable_partition.hpp>
+
+#include <algorithm>
+#include <vector>
+
+#include "benchmark_utils.hpp"
+
+namespace {
+
+// Every benchmark partitions on whether an element is less than a pivot
+// value in the middle of the input's range
+struct std_lib {
+    template <typename V, typename P>
+    static void partition(V& v, P pred)
+    {
+        std::partition(v.begin(), v.end(), pred);
+    }
+
+    template <typename V, typename P>
+    static void stable_partition(V& v, P pred)
+    {
+        std::stable_partition(v.begin(), v.end(), pred);
+    }
+
+    template <typename V, typename O, typename P>
+    static void partition_copy(const V& v, O t, O f, P pred)
+    {
+        std::partition_copy(v.begin(), v.end(), t, f, pred);
+    }
+
+    template <typename V, typename P>
+    static auto partition_point(const V& v, P pred)
+    {
+        return std::partition_point(v.begin(), v.end(), pred);
+    }
+
+    template <typename V, typename P>
+    static bool is_partitioned(const V& v, P pred)
+    {
+        return std::is_partitioned(v.begin(), v.end(), pred);
+    }
+};
+
+#ifdef NANO_BENCHMARK_HAVE_STD_RANGES
+struct ranges_lib {
+    template <typename V, typename P>
+    static void partition(V& v, P pred)
+    {
+        std::ranges::partition(v, pred);
+    }
+
+    template <typename V, typename P>
+    static void stable_partition(V& v, P pred)
+    {
+        std::ranges::stable_partition(v, pred);
+    }
+
+    template <typename V, typename O, typename P>
+    static void partition_copy(const V& v, O t, O f, P pred)
+    {
+        std::ranges::partition_copy(v, t, f, pred);
+    }
+
+    template <typename V, typename P>
+    static auto partition_point(const V& v, P pred)
+    {
+        return std::ranges::partition_point(v, pred);
+    }
+
+    template <typename V, typename P>
+    static bool is_partitioned(const V& v, P pred)
+    {
+        return std::ranges::is_partitioned(v, pred);
+    }
+};
+#endif
+
+struct nano_lib {
+    template <typename V, typename P>
+    static void partition(V& v, P pred)
+    {
+        nano::partition(v, pred);
+    }
+
+    template <typename V, typename P>
+    static void stable_partition(V& v, P pred)
+    {
+        nano::stable_partition(v, pred);
+    }
+
+    template <typename V, typename O, typename P>
+    static void partition_copy(const V& v, O t, O f, P pred)
+    {
+        nano::partition_copy(v, t, f, pred);
+    }
+
+    template <typename V, typename P>
+    static auto partition_point(const V& v, P pred)
+    {
+        return nano::partition_point(v, pred);
+    }
+
+    template <typename V, typename P>
+    static bool is_partitioned(const V& v, P pred)
+    {
+        return nano::is_partitioned(v, pred);
+    }
+};
+
+template <typename T>
+auto less_than_middle(std::size_t size)
+{
+    return [pivot = bench::make_value<T>(size / 2)](const T& t) {
+        return t < pivot;
+    };
+}
+
+template <typename Lib, typename T>
+void partition_random(benchmark::State& state)
+{
+    const auto size = static_cast<std::size_t>(state.range(0));
+    const auto input = bench::random_values<T>(size, size);
+    const auto pred = less_than_middle<T>(size);
+    std::vector<T> vec;
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        vec = input;
+        state.ResumeTiming();
+
+        Lib::partition(vec, pred);
+        benchmark::DoNotOptimize(vec.data());
+    }
+
+    bench::set_items_processed(state);
+}
+
+template <typename Lib, typename T>
+void stable_partition_random(benchmark::State& state)
+{
+    const auto size = static_cast<std::size_t>(state.range(0));
+    const auto input = bench::random_values<T>(size, size);
+    const auto pred = less_than_middle<T>(size);
+    std::vector<T> vec;
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        vec = input;
+        state.ResumeTiming();
+
+        Lib::stable_partition(vec, pred);
+        benchmark::DoNotOptimize(vec.data());
+    }
+
+    bench::set_items_processed(state);
+}
+
+template <typename Lib, typename T>
+void partition_copy_random(benchmark::State& state)
+{
+    const auto size = static_cast<std::size_t>(state.range(0));
+    const auto input = bench::random_values<T>(size, size);
+    const auto pred = less_than_middle<T>(size);
+    std::vector<T> out_true(size);
+    std::vector<T> out_false(size);
+
+    for (auto _ : state) {
+        Lib::partition_copy(input, out_true.begin(), out_false.begin(), pred);
+        benchmark::ClobberMemory();
+    }
+
+    bench::set_items_processed(state);
+}
+
+template <typename Lib, typename T>
+void partition_point_ascending(benchmark::State& state)
+{
+    const auto size = static_cast<std::size_t>(state.range(0));
+    const auto vec = bench::ascending_values<T>(size);
+    const auto pred = less_than_middle<T>(size);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Lib::partition_point(vec, pred));
+    }
+
+    bench::set_items_processed(state);
+}
+
+template <typename Lib, typename T>
+void is_partitioned_ascending(benchmark::State& state)
+{
+    const auto size = static_cast<std::size_t>(state.range(0));
+    const auto vec = bench::ascending_values<T>(size);
+    const auto pred = less_than_middle<T>(size);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Lib::is_partitioned(vec, pred));
+    }
+
+    bench::set_items_processed(state);
+}
+
+// Args are {number of elements, pool concurrency}
+void set_thread_counts(benchmark::internal::Benchmark* bench)
+{
+    const int max_threads =
+        static_cast<int>(nano::thread_pool::default_concurrency());
+
+    for (int size : {1'000'000, 16'000'000}) {
+        for (int threads = 1; threads < max_threads; threads *= 2) {
+            bench->Args({size, threads});
+        }
+        bench->Args({size, max_threads});
+    }
+}
+
+enum class partition_op { partition, stable_partition, partition_copy };
+
+// Splitting a large buffer of records into hot and cold halves, as done
+// when compacting, sequentially and on pools of various sizes
+template <partition_op Op, bool Parallel>
+void partition_hot_cold(benchmark::State& state)
+{
+    const auto size = static_cast<std::size_t>(state.range(0));
+    nano::thread_pool pool(static_cast<std::size_t>(state.range(1)));
+    const auto input = bench::random_values<int>(size, size);
+    const auto pred = less_than_middle<int>(size);
+    std::vector<int> vec = input;
+    std::vector<int> out_true(size);
+    std::vector<int> out_false(size);
+
+    for (auto _ : state) {
+        if constexpr (Op == partition_op::partition_copy) {
+            if constexpr (Parallel) {
+                nano::partition_copy(nano::par.on(pool), input,
+                                     out_true.begin(), out_false.begin(),
+                                     pred);
+            } else {
+                std::partition_copy(input.begin(), input.end(),
+                                    out_true.begin(), out_false.begin(), pred);
+            }
+            benchmark::ClobberMemory();
+        } else {
+            state.PauseTiming();
+            std::copy(input.begin(), input.end(), vec.begin());
+            state.ResumeTiming();
+
+            if constexpr (Op == partition_op::partition && Parallel) {
+                nano::partition(nano::par.on(pool), vec, pred);
+            } else if constexpr (Op == partition_op::partition) {
+                std::partition(vec.begin(), vec.end(), pred);
+            } else if constexpr (Parallel) {
+                nano::stable_partition(nano::par.on(pool), vec, pred);
+            } else {
+                std::stable_partition(vec.begin(), vec.end(), pred);
+            }
+            benchmark::DoNotOptimize(vec.data());
+        }
+    }
+
+    bench::set_items_processed(state);
+}
+
+} // namespace
+
+NANO_BENCHMARK_ALL(partition_random);
+NANO_BENCHMARK_ALL(stable_partition_random);
+NANO_BENCHMARK_ALL_COPIES(partition_copy_random, 3);
+NANO_BENCHMARK_ALL(partition_point_ascending);
+NANO_BENCHMARK_ALL(is_partitioned_ascending);
+
+#define NANO_PARTITION_SCALE_BENCHMARKS(op)                                    \
+    BENCHMARK_TEMPLATE(partition_hot_cold, partition_op::op, false)            \
+        ->Apply(set_thread_counts)->UseRealTime();                             \
+    BENCHMARK_TEMPLATE(partition_hot_cold, partition_op::op, true)             \
+        ->Apply(set_thread_counts)->UseRealTime()
+
+NANO_PARTITION_SCALE_BENCHMARKS(partition);
+NANO_PARTITION_SCALE_BENCHMARKS(stable_partition);
+NANO_PARTITION_SCALE_BENCHMARKS(partition_copy);
@@ -0,0 +1,195 @@
+#include <nanorange/algorithm/is_permutation.hpp>
+#include <nanorange/algorithm/next_permutation.hpp>
+#include <nanorange/algorithm/prev_permutation.hpp>
+#include <nanorange/algorithm/reverse.hpp>
+#include <nanorange/algorithm/rotate.hpp>
+#include <nanorange/algorithm/shuffle.hpp>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "benchmark_utils.hpp"
+
+namespace {
+
+struct std_lib {
+    template <typename V>
+    static bool next_permutation(V& v)
+    {
+        return std::next_permutation(v.begin(), v.end());
+    }
+
+    template <typename V>
+    static bool prev_permutation(V& v)
+    {
+        return std::prev_permutation(v.begin(), v.end());
+    }
+
+    template <typename V>
+    static bool is_permutation(const V& a, const V& b)
+    {
+        return std::is_permutation(a.begin(), a.end(), b.begin(), b.end());
+    }
+
+    template <typename V>
+    static void reverse(V& v) { std::reverse(v.begin(), v.end()); }
+
+    template <typename V>
+    static void rotate(V& v)
+    {
+        std::rotate(v.begin(), v.begin() + v.size() / 3, v.end());
+    }
+
+    template <typename V, typename G>
+    static void shuffle(V& v, G& gen) { std::shuffle(v.begin(), v.end(), gen); }
+};
+
+#ifdef NANO_BENCHMARK_HAVE_STD_RANGES
+struct ranges_lib {
+    template <typename V>
+    static bool next_permutation(V& v)
+    {
+        return std::ranges::next_permutation(v).found;
+    }
+
+    template <typename V>
+    static bool prev_permutation(V& v)
+    {
+        return std::ranges::prev_permutation(v).found;
+    }
+
+    template <typename V>
+    static bool is_permutation(const V& a, const V& b)
+    {
+        return std::ranges::is_permutation(a, b);
+    }
+
+    template <typename V>
+    static void reverse(V& v) { std::ranges::reverse(v); }
+
+    template <typename V>
+    static void rotate(V& v)
+    {
+        std::ranges::rotate(v, v.begin() + v.size() / 3);
+    }
+
+    template <typename V, typename G>
+    static void shuffle(V& v, G& gen) { std::ranges::shuffle(v, gen); }
+};
+#endif
+
+struct nano_lib {
+    template <typename V>
+    static bool next_permutation(V& v)
+    {
+        return nano::next_permutation(v).found;
+    }
+
+    template <typename V>
+    static bool prev_permutation(V& v)
+    {
+        return nano::prev_permutation(v).found;
+    }
+
+    template <typename V>
+    static bool is_permutation(const V& a, const V& b)
+    {
+        return nano::is_permutation(a, b);
+    }
+
+    template <typename V>
+    static void reverse(V& v) { nano::reverse(v); }
+
+    template <typename V>
+    static void rotate(V& v) { nano::rotate(v, v.begin() + v.size() / 3); }
+
+    template <typename V, typename G>
+    static void shuffle(V& v, G& gen) { nano::shuffle(v, gen); }
+};
+
+// Stepping from the last permutation of the whole range to the first one
+// and back again reverses every element twice, which is the worst case
+template <typename Lib, typename T>
+void permutation_wraparound(benchmark::State& state)
+{
+    auto vec =
+        bench::ascending_values<T>(static_cast<std::size_t>(state.range(0)));
+    std::reverse(vec.begin(), vec.end());
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Lib::next_permutation(vec));
+        benchmark::DoNotOptimize(Lib::prev_permutation(vec));
+    }
+
+    state.SetItemsProcessed(2 * state.iterations() * state.range(0));
+}
+
+// Checking is quadratic for distinct elements in a different order in every
+// implementation, so we only measure ranges with a long common prefix
+// followed by a short swapped tail
+template <typename Lib, typename T>
+void is_permutation_tail(benchmark::State& state)
+{
+    const auto a =
+        bench::ascending_values<T>(static_cast<std::size_t>(state.range(0)));
+    auto b = a;
+    std::reverse(b.end() - std::min<std::ptrdiff_t>(b.size(), 8), b.end());
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Lib::is_permutation(a, b));
+    }
+
+    bench::set_items_processed(state);
+}
+
+template <typename Lib, typename T>
+void reverse_random(benchmark::State& state)
+{
+    auto vec =
+        bench::random_values<T>(static_cast<std::size_t>(state.range(0)));
+
+    for (auto _ : state) {
+        Lib::reverse(vec);
+        benchmark::DoNotOptimize(vec.data());
+    }
+
+    bench::set_items_processed(state);
+}
+
+template <typename Lib, typename T>
+void rotate_random(benchmark::State& state)
+{
+    auto vec =
+        bench::random_values<T>(static_cast<std::size_t>(state.range(0)));
+
+    for (auto _ : state) {
+        Lib::rotate(vec);
+        benchmark::DoNotOptimize(vec.data());
+    }
+
+    bench::set_items_processed(state);
+}
+
+template <typename Lib, typename T>
+void shuffle_random(benchmark::State& state)
+{
+    auto vec =
+        bench::random_values<T>(static_cast<std::size_t>(state.range(0)));
+    std::mt19937 gen{};
+
+    for (auto _ : state) {
+        Lib::shuffle(vec, gen);
+        benchmark::DoNotOptimize(vec.data());
+    }
+
+    bench::set_items_processed(state);
+}
+
+} // namespace
+
+NANO_BENCHMARK_ALL(permutation_wraparound);
+NANO_BENCHMARK_ALL(is_permutation_tail);
+NANO_BENCHMARK_ALL(reverse_random);
+NANO_BENCHMARK_ALL(rotate_random);
+NANO_BENCHMARK_ALL(shuffle_random);
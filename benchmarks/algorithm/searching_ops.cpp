@@ -0,0 +1,261 @@
+#include <nanorange/algorithm/adjacent_find.hpp>
+#include <nanorange/algorithm/binary_search.hpp>
+#include <nanorange/algorithm/equal_range.hpp>
+#include <nanorange/algorithm/find.hpp>
+#include <nanorange/algorithm/lower_bound.hpp>
+#include <nanorange/algorithm/search.hpp>
+#include <nanorange/algorithm/upper_bound.hpp>
+
+#include <algorithm>
+#include <vector>
+
+#include "benchmark_utils.hpp"
+
+namespace {
+
+struct std_lib {
+    template <typename V, typename T>
+    static auto find(const V& v, const T& t)
+    {
+        return std::find(v.begin(), v.end(), t);
+    }
+
+    template <typename V>
+    static auto adjacent_find(const V& v)
+    {
+        return std::adjacent_find(v.begin(), v.end());
+    }
+
+    template <typename V>
+    static auto search(const V& v, const V& needle)
+    {
+        return std::search(v.begin(), v.end(), needle.begin(), needle.end());
+    }
+
+    template <typename V, typename T>
+    static auto lower_bound(const V& v, const T& t)
+    {
+        return std::lower_bound(v.begin(), v.end(), t);
+    }
+
+    template <typename V, typename T>
+    static auto upper_bound(const V& v, const T& t)
+    {
+        return std::upper_bound(v.begin(), v.end(), t);
+    }
+
+    template <typename V, typename T>
+    static auto equal_range(const V& v, const T& t)
+    {
+        return std::equal_range(v.begin(), v.end(), t);
+    }
+
+    template <typename V, typename T>
+    static bool binary_search(const V& v, const T& t)
+    {
+        return std::binary_search(v.begin(), v.end(), t);
+    }
+};
+
+#ifdef NANO_BENCHMARK_HAVE_STD_RANGES
+struct ranges_lib {
+    template <typename V, typename T>
+    static auto find(const V& v, const T& t)
+    {
+        return std::ranges::find(v, t);
+    }
+
+    template <typename V>
+    static auto adjacent_find(const V& v)
+    {
+        return std::ranges::adjacent_find(v);
+    }
+
+    template <typename V>
+    static auto search(const V& v, const V& needle)
+    {
+        return std::ranges::search(v, needle);
+    }
+
+    template <typename V, typename T>
+    static auto lower_bound(const V& v, const T& t)
+    {
+        return std::ranges::lower_bound(v, t);
+    }
+
+    template <typename V, typename T>
+    static auto upper_bound(const V& v, const T& t)
+    {
+        return std::ranges::upper_bound(v, t);
+    }
+
+    template <typename V, typename T>
+    static auto equal_range(const V& v, const T& t)
+    {
+        return std::ranges::equal_range(v, t);
+    }
+
+    template <typename V, typename T>
+    static bool binary_search(const V& v, const T& t)
+    {
+        return std::ranges::binary_search(v, t);
+    }
+};
+#endif
+
+struct nano_lib {
+    template <typename V, typename T>
+    static auto find(const V& v, const T& t)
+    {
+        return nano::find(v, t);
+    }
+
+    template <typename V>
+    static auto adjacent_find(const V& v)
+    {
+        return nano::adjacent_find(v);
+    }
+
+    template <typename V>
+    static auto search(const V& v, const V& needle)
+    {
+        return nano::search(v, needle);
+    }
+
+    template <typename V, typename T>
+    static auto lower_bound(const V& v, const T& t)
+    {
+        return nano::lower_bound(v, t);
+    }
+
+    template <typename V, typename T>
+    static auto upper_bound(const V& v, const T& t)
+    {
+        return nano::upper_bound(v, t);
+    }
+
+    template <typename V, typename T>
+    static auto equal_range(const V& v, const T& t)
+    {
+        return nano::equal_range(v, t);
+    }
+
+    template <typename V, typename T>
+    static bool binary_search(const V& v, const T& t)
+    {
+        return nano::binary_search(v, t);
+    }
+};
+
+// Linear searches: the value we look for is not present, so every
+// algorithm has to examine the whole range
+
+template <typename Lib, typename T>
+void find_absent(benchmark::State& state)
+{
+    const auto size = static_cast<std::size_t>(state.range(0));
+    const auto vec = bench::ascending_values<T>(size);
+    const auto value = bench::make_value<T>(size);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Lib::find(vec, value));
+    }
+
+    bench::set_items_processed(state);
+}
+
+template <typename Lib, typename T>
+void adjacent_find_absent(benchmark::State& state)
+{
+    const auto vec =
+        bench::ascending_values<T>(static_cast<std::size_t>(state.range(0)));
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Lib::adjacent_find(vec));
+    }
+
+    bench::set_items_processed(state);
+}
+
+// The haystack is made of many partial matches of the needle, which is
+// the bad case for naive searching
+template <typename Lib, typename T>
+void search_partial_matches(benchmark::State& state)
+{
+    constexpr std::size_t needle_size = 8;
+    const auto size = static_cast<std::size_t>(state.range(0));
+
+    std::vector<T> vec(size, bench::make_value<T>(0));
+    std::vector<T> needle(needle_size, bench::make_value<T>(0));
+    needle.back() = bench::make_value<T>(1);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Lib::search(vec, needle));
+    }
+
+    bench::set_items_processed(state);
+}
+
+// Binary searches: a fixed batch of random keys is looked up in a sorted
+// range on every iteration
+constexpr std::size_t num_queries = 1024;
+
+template <typename Lib, typename T, typename Op>
+void run_queries(benchmark::State& state, Op op)
+{
+    const auto size = static_cast<std::size_t>(state.range(0));
+    // Every other value is present
+    const auto vec = bench::ascending_values<T>(size, 2);
+    const auto queries = bench::random_values<T>(num_queries, 2 * size, 1);
+
+    for (auto _ : state) {
+        for (const auto& q : queries) {
+            benchmark::DoNotOptimize(op(vec, q));
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<long long>(num_queries));
+}
+
+template <typename Lib, typename T>
+void lower_bound_random(benchmark::State& state)
+{
+    run_queries<Lib, T>(state, [](const auto& v, const auto& q) {
+        return Lib::lower_bound(v, q);
+    });
+}
+
+template <typename Lib, typename T>
+void upper_bound_random(benchmark::State& state)
+{
+    run_queries<Lib, T>(state, [](const auto& v, const auto& q) {
+        return Lib::upper_bound(v, q);
+    });
+}
+
+template <typename Lib, typename T>
+void equal_range_random(benchmark::State& state)
+{
+    run_queries<Lib, T>(state, [](const auto& v, const auto& q) {
+        return Lib::equal_range(v, q);
+    });
+}
+
+template <typename Lib, typename T>
+void binary_search_random(benchmark::State& state)
+{
+    run_queries<Lib, T>(state, [](const auto& v, const auto& q) {
+        return Lib::binary_search(v, q);
+    });
+}
+
+} // namespace
+
+NANO_BENCHMARK_ALL(find_absent);
+NANO_BENCHMARK_ALL(adjacent_find_absent);
+NANO_BENCHMARK_ALL(search_partial_matches);
+NANO_BENCHMARK_ALL(lower_bound_random);
+NANO_BENCHMARK_ALL(upper_bound_random);
+NANO_BENCHMARK_ALL(equal_range_random);
+NANO_BENCHMARK_ALL(binary_search_random);
@@ -0,0 +1,279 @@
+#include <nanorange/algorithm/includes.hpp>
+#include <nanorange/algorithm/merge.hpp>
+#include <nanorange/algorithm/set_difference.hpp>
+#include <nanorange/algorithm/set_intersection.hpp>
+#include <nanorange/algorithm/set_symmetric_difference.hpp>
+#include <nanorange/algorithm/set_union.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "benchmark_utils.hpp"
+
+namespace {
+
+// Each operation writes into out, which is large enough for any result, and
+// returns the end of the output
+struct std_lib {
+    template <typename V, typename O>
+    static O merge(const V& a, const V& b, O out)
+    {
+        return std::merge(a.begin(), a.end(), b.begin(), b.end(), out);
+    }
+
+    template <typename V, typename O>
+    static O set_union(const V& a, const V& b, O out)
+    {
+        return std::set_union(a.begin(), a.end(), b.begin(), b.end(), out);
+    }
+
+    template <typename V, typename O>
+    static O set_intersection(const V& a, const V& b, O out)
+    {
+        return std::set_intersection(a.begin(), a.end(), b.begin(), b.end(),
+                                     out);
+    }
+
+    template <typename V, typename O>
+    static O set_difference(const V& a, const V& b, O out)
+    {
+        return std::set_difference(a.begin(), a.end(), b.begin(), b.end(),
+                                   out);
+    }
+
+    template <typename V, typename O>
+    static O set_symmetric_difference(const V& a, const V& b, O out)
+    {
+        return std::set_symmetric_difference(a.begin(), a.end(), b.begin(),
+                                             b.end(), out);
+    }
+
+    template <typename V>
+    static bool includes(const V& a, const V& b)
+    {
+        return std::includes(a.begin(), a.end(), b.begin(), b.end());
+    }
+};
+
+#ifdef NANO_BENCHMARK_HAVE_STD_RANGES
+struct ranges_lib {
+    template <typename V, typename O>
+    static O merge(const V& a, const V& b, O out)
+    {
+        return std::ranges::merge(a, b, out).out;
+    }
+
+    template <typename V, typename O>
+    static O set_union(const V& a, const V& b, O out)
+    {
+        return std::ranges::set_union(a, b, out).out;
+    }
+
+    template <typename V, typename O>
+    static O set_intersection(const V& a, const V& b, O out)
+    {
+        return std::ranges::set_intersection(a, b, out).out;
+    }
+
+    template <typename V, typename O>
+    static O set_difference(const V& a, const V& b, O out)
+    {
+        return std::ranges::set_difference(a, b, out).out;
+    }
+
+    template <typename V, typename O>
+    static O set_symmetric_difference(const V& a, const V& b, O out)
+    {
+        return std::ranges::set_symmetric_difference(a, b, out).out;
+    }
+
+    template <typename V>
+    static bool includes(const V& a, const V& b)
+    {
+        return std::ranges::includes(a, b);
+    }
+};
+#endif
+
+struct nano_lib {
+    template <typename V, typename O>
+    static O merge(const V& a, const V& b, O out)
+    {
+        return nano::merge(a, b, out).out;
+    }
+
+    template <typename V, typename O>
+    static O set_union(const V& a, const V& b, O out)
+    {
+        return nano::set_union(a, b, out).out;
+    }
+
+    template <typename V, typename O>
+    static O set_intersection(const V& a, const V& b, O out)
+    {
+        return nano::set_intersection(a, b, out);
+    }
+
+    template <typename V, typename O>
+    static O set_difference(const V& a, const V& b, O out)
+    {
+        return nano::set_difference(a, b, out).out;
+    }
+
+    template <typename V, typename O>
+    static O set_symmetric_difference(const V& a, const V& b, O out)
+    {
+        return nano::set_symmetric_difference(a, b, out).out;
+    }
+
+    template <typename V>
+    static bool includes(const V& a, const V& b)
+    {
+        return nano::includes(a, b);
+    }
+};
+
+// The two inputs are sorted sets of size N each, drawn from [0, 3N) so that
+// roughly a third of each input is also present in the other one
+template <typename T, typename Op>
+void run_binary_op(benchmark::State& state, Op op)
+{
+    const auto size = static_cast<std::size_t>(state.range(0));
+
+    const auto make_set = [size](std::uint64_t seed) {
+        auto vec = bench::random_values<T>(size, 3 * size, seed);
+        std::sort(vec.begin(), vec.end());
+        vec.erase(std::unique(vec.begin(), vec.end()), vec.end());
+        return vec;
+    };
+
+    const auto a = make_set(1);
+    const auto b = make_set(2);
+    std::vector<T> out(a.size() + b.size());
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(op(a, b, out.begin()));
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<long long>(a.size() + b.size()));
+}
+
+template <typename Lib, typename T>
+void merge_random(benchmark::State& state)
+{
+    run_binary_op<T>(state, [](const auto& a, const auto& b, auto out) {
+        return Lib::merge(a, b, out);
+    });
+}
+
+template <typename Lib, typename T>
+void set_union_random(benchmark::State& state)
+{
+    run_binary_op<T>(state, [](const auto& a, const auto& b, auto out) {
+        return Lib::set_union(a, b, out);
+    });
+}
+
+template <typename Lib, typename T>
+void set_intersection_random(benchmark::State& state)
+{
+    run_binary_op<T>(state, [](const auto& a, const auto& b, auto out) {
+        return Lib::set_intersection(a, b, out);
+    });
+}
+
+template <typename Lib, typename T>
+void set_difference_random(benchmark::State& state)
+{
+    run_binary_op<T>(state, [](const auto& a, const auto& b, auto out) {
+        return Lib::set_difference(a, b, out);
+    });
+}
+
+template <typename Lib, typename T>
+void set_symmetric_difference_random(benchmark::State& state)
+{
+    run_binary_op<T>(state, [](const auto& a, const auto& b, auto out) {
+        return Lib::set_symmetric_difference(a, b, out);
+    });
+}
+
+// Intersects two posting lists (sorted lists of unique document ids). The
+// second has state.range(0) ids, and the first one in state.range(1) of
+// them, so the ratio selects between the block-wise and galloping paths.
+template <typename Lib, typename T>
+void set_intersection_postings(benchmark::State& state)
+{
+    const auto size = static_cast<std::size_t>(state.range(0));
+    const auto ratio = static_cast<std::size_t>(state.range(1));
+
+    const auto make_list = [](std::size_t n, std::uint64_t max,
+                              std::uint64_t seed) {
+        auto vec = bench::random_values<T>(n, max, seed);
+        std::sort(vec.begin(), vec.end());
+        vec.erase(std::unique(vec.begin(), vec.end()), vec.end());
+        return vec;
+    };
+
+    const auto a = make_list(size / ratio, 4 * size, 1);
+    const auto b = make_list(size, 4 * size, 2);
+    std::vector<T> out(a.size());
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Lib::set_intersection(a, b, out.begin()));
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<long long>(a.size() + b.size()));
+}
+
+template <typename T>
+void set_posting_sizes(benchmark::internal::Benchmark* bench)
+{
+    for (long long size : {1 << 10, 1 << 16, 1 << 22}) {
+        for (long long ratio : {1, 4, 64, 1024}) {
+            if (size / ratio > 0) {
+                bench->Args({size, ratio});
+            }
+        }
+    }
+}
+
+// Every element of the needle is present, so the whole of both ranges
+// must be examined
+template <typename Lib, typename T>
+void includes_subset(benchmark::State& state)
+{
+    const auto size = static_cast<std::size_t>(state.range(0));
+    const auto haystack = bench::ascending_values<T>(size);
+    const auto needle = bench::ascending_values<T>(size / 2, 2);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Lib::includes(haystack, needle));
+    }
+
+    bench::set_items_processed(state);
+}
+
+} // namespace
+
+// The binary operations hold two inputs and an output of twice the input size
+NANO_BENCHMARK_ALL_COPIES(merge_random, 4);
+NANO_BENCHMARK_ALL_COPIES(set_union_random, 4);
+NANO_BENCHMARK_ALL_COPIES(set_intersection_random, 4);
+NANO_BENCHMARK_ALL_COPIES(set_difference_random, 4);
+NANO_BENCHMARK_ALL_COPIES(set_symmetric_difference_random, 4);
+NANO_BENCHMARK_ALL(includes_subset);
+
+#define NANO_POSTINGS_BENCHMARKS(lib)                                          \
+    BENCHMARK_TEMPLATE(set_intersection_postings, lib, std::uint32_t)          \
+        ->Apply(set_posting_sizes<std::uint32_t>);                             \
+    BENCHMARK_TEMPLATE(set_intersection_postings, lib, std::uint64_t)          \
+        ->Apply(set_posting_sizes<std::uint64_t>)
+
+NANO_POSTINGS_BENCHMARKS(std_lib);
+NANO_POSTINGS_BENCHMARKS(nano_lib);
@@ -0,0 +1,140 @@
+#include <nanorange/algorithm/radix_sort.hpp>
+#include <nanorange/algorithm/sort.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+namespace {
+
+// Args are {number of elements, pool concurrency}
+void set_thread_counts(benchmark::internal::Benchmark* bench)
+{
+    const int max_threads =
+        static_cast<int>(nano::thread_pool::default_concurrency());
+
+    for (int size : {1'000'000, 10'000'000, 100'000'000}) {
+        for (int threads = 1; threads < max_threads; threads *= 2) {
+            bench->Args({size, threads});
+        }
+        bench->Args({size, max_threads});
+    }
+}
+
+void set_sizes(benchmark::internal::Benchmark* bench)
+{
+    for (int size : {1'000'000, 10'000'000, 100'000'000}) {
+        bench->Args({size, 1});
+    }
+}
+
+template <typename T>
+std::vector<T> random_values(std::size_t size)
+{
+    std::mt19937_64 gen{};
+    std::vector<T> vec(size);
+    if constexpr (std::is_floating_point<T>::value) {
+        std::uniform_real_distribution<T> dist;
+        for (auto& t : vec) {
+            t = dist(gen);
+        }
+    } else {
+        std::uniform_int_distribution<T> dist;
+        for (auto& t : vec) {
+            t = dist(gen);
+        }
+    }
+    return vec;
+}
+
+struct std_sort {
+    template <typename Rng>
+    void operator()(nano::thread_pool&, Rng& rng)
+    {
+        std::sort(rng.begin(), rng.end());
+    }
+};
+
+struct nano_sort {
+    template <typename Rng>
+    void operator()(nano::thread_pool&, Rng& rng)
+    {
+        nano::sort(rng);
+    }
+};
+
+struct nano_radix_sort {
+    template <typename Rng>
+    void operator()(nano::thread_pool&, Rng& rng)
+    {
+        nano::radix_sort(rng);
+    }
+};
+
+struct nano_par_sort {
+    template <typename Rng>
+    void operator()(nano::thread_pool& pool, Rng& rng)
+    {
+        nano::sort(nano::par.on(pool), rng);
+    }
+};
+
+template <typename F, typename T>
+void sort_random(benchmark::State& state)
+{
+    const auto size = static_cast<std::size_t>(state.range(0));
+    nano::thread_pool pool(static_cast<std::size_t>(state.range(1)));
+
+    const auto input = random_values<T>(size);
+    std::vector<T> vec;
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        vec = input;
+        state.ResumeTiming();
+
+        F{}(pool, vec);
+        benchmark::DoNotOptimize(vec.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+} // namespace
+
+// int -------------------------------------------------
+
+BENCHMARK_TEMPLATE(sort_random, std_sort, int)
+    ->Apply(set_sizes)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+BENCHMARK_TEMPLATE(sort_random, nano_sort, int)
+    ->Apply(set_sizes)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+BENCHMARK_TEMPLATE(sort_random, nano_radix_sort, int)
+    ->Apply(set_sizes)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+BENCHMARK_TEMPLATE(sort_random, nano_par_sort, int)
+    ->Apply(set_thread_counts)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+// uint64_t -------------------------------------------------
+
+BENCHMARK_TEMPLATE(sort_random, std_sort, std::uint64_t)
+    ->Apply(set_sizes)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+BENCHMARK_TEMPLATE(sort_random, nano_sort, std::uint64_t)
+    ->Apply(set_sizes)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+BENCHMARK_TEMPLATE(sort_random, nano_radix_sort, std::uint64_t)
+    ->Apply(set_sizes)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+// double -------------------------------------------------
+
+BENCHMARK_TEMPLATE(sort_random, nano_sort, double)
+    ->Apply(set_sizes)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+BENCHMARK_TEMPLATE(sort_random, nano_radix_sort, double)
+    ->Apply(set_sizes)->Unit(benchmark::kMillisecond)->UseRealTime();
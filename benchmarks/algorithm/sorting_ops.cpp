@@ -0,0 +1,215 @@
+#include <nanorange/algorithm/adaptive_stable_sort.hpp>
+#include <nanorange/algorithm/is_sorted.hpp>
+#include <nanorange/algorithm/nth_element.hpp>
+#include <nanorange/algorithm/partial_sort.hpp>
+#include <nanorange/algorithm/sort.hpp>
+#include <nanorange/algorithm/stable_sort.hpp>
+
+#include <algorithm>
+#include <vector>
+
+#include "benchmark_utils.hpp"
+
+namespace {
+
+struct std_lib {
+    template <typename V>
+    static void sort(V& v) { std::sort(v.begin(), v.end()); }
+
+    template <typename V>
+    static void stable_sort(V& v) { std::stable_sort(v.begin(), v.end()); }
+
+    template <typename V>
+    static void partial_sort(V& v)
+    {
+        std::partial_sort(v.begin(), v.begin() + v.size() / 10, v.end());
+    }
+
+    template <typename V>
+    static void nth_element(V& v)
+    {
+        std::nth_element(v.begin(), v.begin() + v.size() / 2, v.end());
+    }
+
+    template <typename V>
+    static bool is_sorted(const V& v)
+    {
+        return std::is_sorted(v.begin(), v.end());
+    }
+};
+
+#ifdef NANO_BENCHMARK_HAVE_STD_RANGES
+struct ranges_lib {
+    template <typename V>
+    static void sort(V& v) { std::ranges::sort(v); }
+
+    template <typename V>
+    static void stable_sort(V& v) { std::ranges::stable_sort(v); }
+
+    template <typename V>
+    static void partial_sort(V& v)
+    {
+        std::ranges::partial_sort(v, v.begin() + v.size() / 10);
+    }
+
+    template <typename V>
+    static void nth_element(V& v)
+    {
+        std::ranges::nth_element(v, v.begin() + v.size() / 2);
+    }
+
+    template <typename V>
+    static bool is_sorted(const V& v) { return std::ranges::is_sorted(v); }
+};
+#endif
+
+struct nano_lib {
+    template <typename V>
+    static void sort(V& v) { nano::sort(v); }
+
+    template <typename V>
+    static void stable_sort(V& v) { nano::stable_sort(v); }
+
+    template <typename V>
+    static void partial_sort(V& v)
+    {
+        nano::partial_sort(v, v.begin() + v.size() / 10);
+    }
+
+    template <typename V>
+    static void nth_element(V& v)
+    {
+        nano::nth_element(v, v.begin() + v.size() / 2);
+    }
+
+    template <typename V>
+    static bool is_sorted(const V& v) { return nano::is_sorted(v); }
+};
+
+// nano::adaptive_stable_sort() has no standard counterpart, so it is
+// compared against the other libraries' stable_sort()
+struct nano_adaptive_lib {
+    template <typename V>
+    static void stable_sort(V& v) { nano::adaptive_stable_sort(v); }
+};
+
+// Random values in a few long sorted runs, every fourth of them descending,
+// like a log which is appended to in order by several sources in turn
+template <typename T>
+std::vector<T> sorted_runs(std::size_t size)
+{
+    constexpr std::size_t num_runs = 16;
+    auto vec = bench::random_values<T>(size);
+    for (std::size_t i = 0; i < num_runs; i++) {
+        const auto first = vec.begin() + static_cast<std::ptrdiff_t>(size * i / num_runs);
+        const auto last = vec.begin() + static_cast<std::ptrdiff_t>(size * (i + 1) / num_runs);
+        std::sort(first, last);
+        if (i % 4 == 3) {
+            std::reverse(first, last);
+        }
+    }
+    return vec;
+}
+
+// Runs Op over a fresh copy of the input made by Make on each iteration
+template <typename T, typename Op, typename Make>
+void run_on_copy(benchmark::State& state, Op op, Make make)
+{
+    const auto input = make(static_cast<std::size_t>(state.range(0)));
+    std::vector<T> vec;
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        vec = input;
+        state.ResumeTiming();
+
+        op(vec);
+        benchmark::DoNotOptimize(vec.data());
+    }
+
+    bench::set_items_processed(state);
+}
+
+// Runs Op over a fresh copy of a random input on each iteration
+template <typename T, typename Op>
+void run_on_random(benchmark::State& state, Op op)
+{
+    run_on_copy<T>(state, op,
+                   [](std::size_t size) { return bench::random_values<T>(size); });
+}
+
+template <typename Lib, typename T>
+void sort_random(benchmark::State& state)
+{
+    run_on_random<T>(state, [](auto& v) { Lib::sort(v); });
+}
+
+template <typename Lib, typename T>
+void stable_sort_random(benchmark::State& state)
+{
+    run_on_random<T>(state, [](auto& v) { Lib::stable_sort(v); });
+}
+
+template <typename Lib, typename T>
+void stable_sort_runs(benchmark::State& state)
+{
+    run_on_copy<T>(state, [](auto& v) { Lib::stable_sort(v); },
+                   sorted_runs<T>);
+}
+
+template <typename Lib, typename T>
+void partial_sort_random(benchmark::State& state)
+{
+    run_on_random<T>(state, [](auto& v) { Lib::partial_sort(v); });
+}
+
+template <typename Lib, typename T>
+void nth_element_random(benchmark::State& state)
+{
+    run_on_random<T>(state, [](auto& v) { Lib::nth_element(v); });
+}
+
+// Sorting already-sorted input is a common pattern worth tracking separately
+template <typename Lib, typename T>
+void sort_ascending(benchmark::State& state)
+{
+    const auto input =
+        bench::ascending_values<T>(static_cast<std::size_t>(state.range(0)));
+    std::vector<T> vec;
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        vec = input;
+        state.ResumeTiming();
+
+        Lib::sort(vec);
+        benchmark::DoNotOptimize(vec.data());
+    }
+
+    bench::set_items_processed(state);
+}
+
+template <typename Lib, typename T>
+void is_sorted_ascending(benchmark::State& state)
+{
+    const auto vec =
+        bench::ascending_values<T>(static_cast<std::size_t>(state.range(0)));
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Lib::is_sorted(vec));
+    }
+
+    bench::set_items_processed(state);
+}
+
+} // namespace
+
+NANO_BENCHMARK_ALL(sort_random);
+NANO_BENCHMARK_ALL(sort_ascending);
+NANO_BENCHMARK_ALL(stable_sort_random);
+NANO_BENCHMARK_TYPES(stable_sort_random, nano_adaptive_lib, 2);
+NANO_BENCHMARK_ALL(stable_sort_runs);
+NANO_BENCHMARK_TYPES(stable_sort_runs, nano_adaptive_lib, 2);
+NANO_BENCHMARK_ALL(partial_sort_random);
+NANO_BENCHMARK_ALL(nth_element_random);
+NANO_BENCHMARK_ALL(is_sorted_ascending);
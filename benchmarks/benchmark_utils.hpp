@@ -0,0 +1,190 @@
+// benchmarks/benchmark_utils.hpp
+//
+// Shared element types, input generators and size sweeps for the
+// per-family algorithm benchmarks
+
+#ifndef NANORANGE_BENCHMARK_UTILS_HPP_INCLUDED
+#define NANORANGE_BENCHMARK_UTILS_HPP_INCLUDED
+
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#if __cplusplus > 201703L && __has_include(<version>)
+#include <version>
+#endif
+
+// Comparisons against std::ranges are only built when the standard library
+// provides them, which generally means compiling as C++20
+#if defined(__cpp_lib_ranges) && __cpp_lib_ranges >= 201911L
+#define NANO_BENCHMARK_HAVE_STD_RANGES 1
+#endif
+
+namespace bench {
+
+// A 64-byte element type, ordered by its key. The payload is carried along
+// so that moves and swaps cost what they would for a typical record.
+struct record64 {
+    std::uint64_t key;
+    std::uint64_t payload[7];
+
+    friend bool operator==(const record64& lhs, const record64& rhs)
+    {
+        return lhs.key == rhs.key;
+    }
+    friend bool operator!=(const record64& lhs, const record64& rhs)
+    {
+        return !(lhs == rhs);
+    }
+    friend bool operator<(const record64& lhs, const record64& rhs)
+    {
+        return lhs.key < rhs.key;
+    }
+    friend bool operator>(const record64& lhs, const record64& rhs)
+    {
+        return rhs < lhs;
+    }
+    friend bool operator<=(const record64& lhs, const record64& rhs)
+    {
+        return !(rhs < lhs);
+    }
+    friend bool operator>=(const record64& lhs, const record64& rhs)
+    {
+        return !(lhs < rhs);
+    }
+};
+
+static_assert(sizeof(record64) == 64, "record64 should be 64 bytes");
+
+// Maps an integer to an element, preserving order for non-negative inputs
+template <typename T>
+T make_value(std::uint64_t i)
+{
+    if constexpr (std::is_same<T, std::string>::value) {
+        // Zero-padded so that lexicographic order matches numeric order.
+        // 20 characters is long enough to defeat the small string
+        // optimisation, which is the interesting case.
+        char buf[24];
+        std::snprintf(buf, sizeof(buf), "%020llu",
+                      static_cast<unsigned long long>(i));
+        return std::string(buf);
+    } else if constexpr (std::is_same<T, record64>::value) {
+        record64 r{};
+        r.key = i;
+        r.payload[0] = i;
+        return r;
+    } else {
+        return static_cast<T>(i);
+    }
+}
+
+// Uniformly random values in [0, max_value)
+template <typename T>
+std::vector<T> random_values(std::size_t size, std::uint64_t max_value,
+                             std::uint64_t seed = 0)
+{
+    std::mt19937_64 gen{seed};
+    std::uniform_int_distribution<std::uint64_t> dist(
+        0, max_value > 0 ? max_value - 1 : 0);
+    std::vector<T> vec;
+    vec.reserve(size);
+    for (std::size_t i = 0; i < size; i++) {
+        vec.push_back(make_value<T>(dist(gen)));
+    }
+    return vec;
+}
+
+template <typename T>
+std::vector<T> random_values(std::size_t size)
+{
+    return random_values<T>(size, std::uint64_t(1) << 62);
+}
+
+// 0, step, 2 * step, ...
+template <typename T>
+std::vector<T> ascending_values(std::size_t size, std::uint64_t step = 1,
+                                std::uint64_t start = 0)
+{
+    std::vector<T> vec;
+    vec.reserve(size);
+    for (std::size_t i = 0; i < size; i++) {
+        vec.push_back(make_value<T>(start + i * step));
+    }
+    return vec;
+}
+
+// Approximate memory used by one element, including any heap allocation
+template <typename T>
+constexpr std::size_t footprint()
+{
+    return std::is_same<T, std::string>::value ? sizeof(T) + 32 : sizeof(T);
+}
+
+// Benchmarks which need more than this much memory for their inputs are
+// not registered. 10^8 strings or records would otherwise need several
+// gigabytes per copy of the input.
+constexpr std::size_t max_input_bytes = std::size_t(1) << 31;
+
+// Sweeps 16, 128, 1024, ... 8^8 and 10^8 elements, skipping sizes whose
+// inputs would not fit in max_input_bytes. Copies is the number of
+// full-size buffers that the benchmark keeps alive at once.
+template <typename T, int Copies = 2>
+void set_sizes(benchmark::internal::Benchmark* bench)
+{
+    constexpr long long max_size = 100'000'000;
+
+    const auto fits = [](long long size) {
+        return static_cast<std::size_t>(size) * footprint<T>() * Copies <=
+               max_input_bytes;
+    };
+
+    for (long long size = 16; size < max_size; size *= 8) {
+        if (fits(size)) {
+            bench->Arg(size);
+        }
+    }
+    if (fits(max_size)) {
+        bench->Arg(max_size);
+    }
+}
+
+inline void set_items_processed(benchmark::State& state)
+{
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+} // namespace bench
+
+// Registers Func<Lib, T> for every element type, where the benchmark keeps
+// Copies full-size buffers alive at once
+#define NANO_BENCHMARK_TYPES(func, lib, copies)                                \
+    BENCHMARK_TEMPLATE(func, lib, int)                                         \
+        ->Apply(bench::set_sizes<int, copies>);                                \
+    BENCHMARK_TEMPLATE(func, lib, double)                                      \
+        ->Apply(bench::set_sizes<double, copies>);                             \
+    BENCHMARK_TEMPLATE(func, lib, std::string)                                 \
+        ->Apply(bench::set_sizes<std::string, copies>);                        \
+    BENCHMARK_TEMPLATE(func, lib, bench::record64)                             \
+        ->Apply(bench::set_sizes<bench::record64, copies>)
+
+// Registers Func<Lib, T> for each of std_lib, ranges_lib (if available) and
+// nano_lib, and every element type
+#ifdef NANO_BENCHMARK_HAVE_STD_RANGES
+#define NANO_BENCHMARK_ALL_COPIES(func, copies)                                \
+    NANO_BENCHMARK_TYPES(func, std_lib, copies);                               \
+    NANO_BENCHMARK_TYPES(func, ranges_lib, copies);                            \
+    NANO_BENCHMARK_TYPES(func, nano_lib, copies)
+#else
+#define NANO_BENCHMARK_ALL_COPIES(func, copies)                                \
+    NANO_BENCHMARK_TYPES(func, std_lib, copies);                               \
+    NANO_BENCHMARK_TYPES(func, nano_lib, copies)
+#endif
+
+#define NANO_BENCHMARK_ALL(func) NANO_BENCHMARK_ALL_COPIES(func, 2)
+
+#endif
@@ -0,0 +1,129 @@
+#include <nanorange/numeric/accumulate.hpp>
+#include <nanorange/numeric/reduce.hpp>
+#include <nanorange/numeric/transform_reduce.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+#include "benchmark_utils.hpp"
+
+namespace {
+
+struct std_accumulate {
+    template <typename T>
+    static T reduce(const std::vector<T>& vec)
+    {
+        return std::accumulate(vec.begin(), vec.end(), T{});
+    }
+
+    template <typename T>
+    static T dot(const std::vector<T>& x, const std::vector<T>& y)
+    {
+        return std::inner_product(x.begin(), x.end(), y.begin(), T{});
+    }
+};
+
+struct std_reduce {
+    template <typename T>
+    static T reduce(const std::vector<T>& vec)
+    {
+        return std::reduce(vec.begin(), vec.end(), T{});
+    }
+
+    template <typename T>
+    static T dot(const std::vector<T>& x, const std::vector<T>& y)
+    {
+        return std::transform_reduce(x.begin(), x.end(), y.begin(), T{});
+    }
+};
+
+struct nano_accumulate {
+    template <typename T>
+    static T reduce(const std::vector<T>& vec)
+    {
+        return nano::accumulate(vec, T{});
+    }
+
+    template <typename T>
+    static T dot(const std::vector<T>& x, const std::vector<T>& y)
+    {
+        return nano::accumulate(nano::begin(x), nano::end(x), T{},
+                                [&](T acc, const T& a) {
+                                    return acc + a * y[&a - x.data()];
+                                });
+    }
+};
+
+struct nano_reduce {
+    template <typename T>
+    static T reduce(const std::vector<T>& vec)
+    {
+        return nano::reduce(vec, T{});
+    }
+
+    template <typename T>
+    static T dot(const std::vector<T>& x, const std::vector<T>& y)
+    {
+        return nano::transform_reduce(x, y, T{});
+    }
+};
+
+struct nano_reduce_par {
+    template <typename T>
+    static T reduce(const std::vector<T>& vec)
+    {
+        return nano::reduce(nano::par, vec, T{});
+    }
+
+    template <typename T>
+    static T dot(const std::vector<T>& x, const std::vector<T>& y)
+    {
+        return nano::transform_reduce(nano::par, x, y, T{});
+    }
+};
+
+template <typename Lib, typename T>
+void reduce_random(benchmark::State& state)
+{
+    const auto vec =
+        bench::random_values<T>(static_cast<std::size_t>(state.range(0)), 1000);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Lib::reduce(vec));
+    }
+
+    bench::set_items_processed(state);
+}
+
+template <typename Lib, typename T>
+void dot_random(benchmark::State& state)
+{
+    const auto size = static_cast<std::size_t>(state.range(0));
+    const auto x = bench::random_values<T>(size, 1000, 1);
+    const auto y = bench::random_values<T>(size, 1000, 2);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Lib::dot(x, y));
+    }
+
+    bench::set_items_processed(state);
+}
+
+} // namespace
+
+#define NANO_REDUCE_BENCHMARKS(lib, T)                                         \
+    BENCHMARK_TEMPLATE(reduce_random, lib, T)                                  \
+        ->Apply(bench::set_sizes<T, 1>);                                       \
+    BENCHMARK_TEMPLATE(dot_random, lib, T)->Apply(bench::set_sizes<T, 2>)
+
+#define NANO_REDUCE_ALL(T)                                                     \
+    NANO_REDUCE_BENCHMARKS(std_accumulate, T);                                 \
+    NANO_REDUCE_BENCHMARKS(std_reduce, T);                                     \
+    NANO_REDUCE_BENCHMARKS(nano_accumulate, T);                                \
+    NANO_REDUCE_BENCHMARKS(nano_reduce, T);                                    \
+    NANO_REDUCE_BENCHMARKS(nano_reduce_par, T)
+
+NANO_REDUCE_ALL(std::int64_t);
+NANO_REDUCE_ALL(double);
@@ -0,0 +1,137 @@
+#include <nanorange/numeric/exclusive_scan.hpp>
+#include <nanorange/numeric/inclusive_scan.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+#include "benchmark_utils.hpp"
+
+namespace {
+
+struct std_partial_sum {
+    template <typename T>
+    static void inclusive(const std::vector<T>& in, std::vector<T>& out)
+    {
+        std::partial_sum(in.begin(), in.end(), out.begin());
+    }
+
+    template <typename T>
+    static void exclusive(const std::vector<T>& in, std::vector<T>& out)
+    {
+        T acc{};
+        for (std::size_t i = 0; i < in.size(); i++) {
+            out[i] = acc;
+            acc += in[i];
+        }
+    }
+};
+
+struct std_scan {
+    template <typename T>
+    static void inclusive(const std::vector<T>& in, std::vector<T>& out)
+    {
+        std::inclusive_scan(in.begin(), in.end(), out.begin());
+    }
+
+    template <typename T>
+    static void exclusive(const std::vector<T>& in, std::vector<T>& out)
+    {
+        std::exclusive_scan(in.begin(), in.end(), out.begin(), T{});
+    }
+};
+
+struct nano_scan {
+    template <typename T>
+    static void inclusive(const std::vector<T>& in, std::vector<T>& out)
+    {
+        nano::inclusive_scan(in, out.begin());
+    }
+
+    template <typename T>
+    static void exclusive(const std::vector<T>& in, std::vector<T>& out)
+    {
+        nano::exclusive_scan(in, out.begin(), T{});
+    }
+};
+
+struct nano_scan_seq {
+    template <typename T>
+    static void inclusive(const std::vector<T>& in, std::vector<T>& out)
+    {
+        nano::inclusive_scan(nano::seq, in, out.begin());
+    }
+
+    template <typename T>
+    static void exclusive(const std::vector<T>& in, std::vector<T>& out)
+    {
+        nano::exclusive_scan(nano::seq, in, out.begin(), T{});
+    }
+};
+
+struct nano_scan_par {
+    template <typename T>
+    static void inclusive(const std::vector<T>& in, std::vector<T>& out)
+    {
+        nano::inclusive_scan(nano::par, in, out.begin());
+    }
+
+    template <typename T>
+    static void exclusive(const std::vector<T>& in, std::vector<T>& out)
+    {
+        nano::exclusive_scan(nano::par, in, out.begin(), T{});
+    }
+};
+
+template <typename Lib, typename T>
+void inclusive_scan_random(benchmark::State& state)
+{
+    const auto size = static_cast<std::size_t>(state.range(0));
+    const auto in = bench::random_values<T>(size, 1000);
+    std::vector<T> out(size);
+
+    for (auto _ : state) {
+        Lib::inclusive(in, out);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+
+    bench::set_items_processed(state);
+}
+
+// A histogram-to-offsets conversion, as in a counting sort
+template <typename Lib, typename T>
+void exclusive_scan_random(benchmark::State& state)
+{
+    const auto size = static_cast<std::size_t>(state.range(0));
+    const auto in = bench::random_values<T>(size, 1000);
+    std::vector<T> out(size);
+
+    for (auto _ : state) {
+        Lib::exclusive(in, out);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+
+    bench::set_items_processed(state);
+}
+
+} // namespace
+
+#define NANO_SCAN_BENCHMARKS(lib, T)                                           \
+    BENCHMARK_TEMPLATE(inclusive_scan_random, lib, T)                          \
+        ->Apply(bench::set_sizes<T, 2>);                                       \
+    BENCHMARK_TEMPLATE(exclusive_scan_random, lib, T)                          \
+        ->Apply(bench::set_sizes<T, 2>)
+
+#define NANO_SCAN_ALL(T)                                                       \
+    NANO_SCAN_BENCHMARKS(std_partial_sum, T);                                  \
+    NANO_SCAN_BENCHMARKS(std_scan, T);                                         \
+    NANO_SCAN_BENCHMARKS(nano_scan, T);                                        \
+    NANO_SCAN_BENCHMARKS(nano_scan_seq, T);                                    \
+    NANO_SCAN_BENCHMARKS(nano_scan_par, T)
+
+NANO_SCAN_ALL(std::uint32_t);
+NANO_SCAN_ALL(std::uint64_t);
+NANO_SCAN_ALL(double);
@@ -0,0 +1,30 @@
+# Prints the size of each function in namespace kernels:: of a benchmark
+# executable, so that the code generated for a view pipeline can be compared
+# with that of the equivalent hand-written loop.
+#
+# Usage: cmake -DNM=<nm> -DEXECUTABLE=<file> -DOUTPUT=<file> -P code_size.cmake
+
+execute_process(
+    COMMAND ${NM} -C --print-size --size-sort ${EXECUTABLE}
+    OUTPUT_VARIABLE symbols
+    RESULT_VARIABLE result
+)
+
+if (NOT result EQUAL 0)
+    message(WARNING "Could not read symbols from ${EXECUTABLE}")
+    return()
+endif()
+
+string(REPLACE "\n" ";" symbols "${symbols}")
+
+set(report "")
+foreach (line IN LISTS symbols)
+    # <address> <size> <type> <name>
+    if (line MATCHES "^[0-9a-fA-F]+ ([0-9a-fA-F]+) [tTwW] kernels::([a-z_]+)\\(")
+        math(EXPR size "0x${CMAKE_MATCH_1}")
+        set(report "${report}${CMAKE_MATCH_2}: ${size} bytes\n")
+    endif()
+endforeach()
+
+file(WRITE ${OUTPUT} "${report}")
+message(STATUS "Code size of view pipeline kernels:\n${report}")
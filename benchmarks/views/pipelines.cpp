@@ -0,0 +1,345 @@
+#include <nanorange/views/filter.hpp>
+#include <nanorange/views/join.hpp>
+#include <nanorange/views/split.hpp>
+#include <nanorange/views/take.hpp>
+#include <nanorange/views/transform.hpp>
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+// Each pipeline and its hand-written equivalent is a separate non-inlined
+// function in namespace kernels, so that the build can report the size of
+// the generated code for each one (see code_size.cmake)
+#if defined(_MSC_VER)
+#define NANO_BENCHMARK_KERNEL __declspec(noinline)
+#else
+#define NANO_BENCHMARK_KERNEL __attribute__((noinline))
+#endif
+
+namespace kernels {
+
+constexpr auto is_even = [](int i) { return i % 2 == 0; };
+constexpr auto square = [](int i) { return static_cast<long long>(i) * i; };
+
+// filter | transform ------------------------------------------------------
+
+NANO_BENCHMARK_KERNEL long long
+filter_transform_loop(const std::vector<int>& vec)
+{
+    long long sum = 0;
+    for (int i : vec) {
+        if (is_even(i)) {
+            sum += square(i);
+        }
+    }
+    return sum;
+}
+
+NANO_BENCHMARK_KERNEL long long
+filter_transform_view(const std::vector<int>& vec)
+{
+    long long sum = 0;
+    for (long long i : vec | nano::views::filter(is_even) |
+                           nano::views::transform(square)) {
+        sum += i;
+    }
+    return sum;
+}
+
+// filter | transform | take -----------------------------------------------
+
+NANO_BENCHMARK_KERNEL long long
+filter_transform_take_loop(const std::vector<int>& vec, std::ptrdiff_t n)
+{
+    long long sum = 0;
+    for (auto it = vec.begin(); it != vec.end() && n > 0; ++it) {
+        if (is_even(*it)) {
+            sum += square(*it);
+            --n;
+        }
+    }
+    return sum;
+}
+
+NANO_BENCHMARK_KERNEL long long
+filter_transform_take_view(const std::vector<int>& vec, std::ptrdiff_t n)
+{
+    long long sum = 0;
+    for (long long i : vec | nano::views::filter(is_even) |
+                           nano::views::transform(square) |
+                           nano::views::take(n)) {
+        sum += i;
+    }
+    return sum;
+}
+
+// join ---------------------------------------------------------------------
+
+NANO_BENCHMARK_KERNEL long long
+join_loop(const std::vector<std::vector<int>>& vecs)
+{
+    long long sum = 0;
+    for (const auto& vec : vecs) {
+        for (int i : vec) {
+            sum += i;
+        }
+    }
+    return sum;
+}
+
+NANO_BENCHMARK_KERNEL long long
+join_view(const std::vector<std::vector<int>>& vecs)
+{
+    long long sum = 0;
+    for (int i : vecs | nano::views::join) {
+        sum += i;
+    }
+    return sum;
+}
+
+// split ----------------------------------------------------------------------
+
+// Both versions count the fields and sum their lengths. The view has to
+// walk each field to find its length, which is part of the cost of using it.
+struct field_stats {
+    std::size_t count = 0;
+    std::size_t total_length = 0;
+};
+
+NANO_BENCHMARK_KERNEL field_stats split_loop(const std::string& str,
+                                             const std::string& delim)
+{
+    field_stats stats;
+    std::size_t pos = 0;
+    while (true) {
+        const auto next = str.find(delim, pos);
+        ++stats.count;
+        if (next == std::string::npos) {
+            stats.total_length += str.size() - pos;
+            break;
+        }
+        stats.total_length += next - pos;
+        pos = next + delim.size();
+    }
+    return stats;
+}
+
+NANO_BENCHMARK_KERNEL field_stats split_view(const std::string& str,
+                                             const std::string& delim)
+{
+    field_stats stats;
+    for (auto field : nano::views::split(str, delim)) {
+        ++stats.count;
+        for (char c : field) {
+            (void) c;
+            ++stats.total_length;
+        }
+    }
+    return stats;
+}
+
+NANO_BENCHMARK_KERNEL field_stats split_char_view(const std::string& str,
+                                                  char delim)
+{
+    field_stats stats;
+    for (auto field : nano::views::split(str, delim)) {
+        ++stats.count;
+        for (char c : field) {
+            (void) c;
+            ++stats.total_length;
+        }
+    }
+    return stats;
+}
+
+} // namespace kernels
+
+namespace {
+
+void set_sizes(benchmark::internal::Benchmark* bench)
+{
+    bench->RangeMultiplier(16)->Range(16, 16 << 20);
+}
+
+std::vector<int> random_ints(std::size_t size)
+{
+    std::mt19937 gen{};
+    std::uniform_int_distribution<int> dist(0, 1 << 16);
+    std::vector<int> vec(size);
+    for (auto& i : vec) {
+        i = dist(gen);
+    }
+    return vec;
+}
+
+void set_items_processed(benchmark::State& state)
+{
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <bool UseView>
+void filter_transform(benchmark::State& state)
+{
+    const auto vec = random_ints(static_cast<std::size_t>(state.range(0)));
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(UseView
+                                     ? kernels::filter_transform_view(vec)
+                                     : kernels::filter_transform_loop(vec));
+    }
+
+    set_items_processed(state);
+}
+
+// Takes the first quarter of the filtered elements
+template <bool UseView>
+void filter_transform_take(benchmark::State& state)
+{
+    const auto vec = random_ints(static_cast<std::size_t>(state.range(0)));
+    const auto n = static_cast<std::ptrdiff_t>(state.range(0) / 8);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+            UseView ? kernels::filter_transform_take_view(vec, n)
+                    : kernels::filter_transform_take_loop(vec, n));
+    }
+
+    set_items_processed(state);
+}
+
+// filter_view::begin() finds the first matching element, then caches it so
+// that subsequent calls are O(1). The only match is at the end of the range,
+// so a fresh view has to scan everything while the cached one shouldn't.
+template <bool Cached>
+void filter_begin(benchmark::State& state)
+{
+    std::vector<int> vec(static_cast<std::size_t>(state.range(0)), 1);
+    vec.back() = 2;
+
+    auto cached = vec | nano::views::filter(kernels::is_even);
+
+    for (auto _ : state) {
+        if (Cached) {
+            benchmark::DoNotOptimize(*cached.begin());
+        } else {
+            auto fresh = vec | nano::views::filter(kernels::is_even);
+            benchmark::DoNotOptimize(*fresh.begin());
+        }
+    }
+
+    set_items_processed(state);
+}
+
+// Args are {total number of elements, elements per inner vector}
+void set_join_sizes(benchmark::internal::Benchmark* bench)
+{
+    for (int size : {1 << 10, 1 << 16, 1 << 22}) {
+        for (int inner : {1, 4, 64, 4096}) {
+            if (inner <= size) {
+                bench->Args({size, inner});
+            }
+        }
+    }
+}
+
+template <bool UseView>
+void join(benchmark::State& state)
+{
+    const auto size = static_cast<std::size_t>(state.range(0));
+    const auto inner = static_cast<std::size_t>(state.range(1));
+
+    const auto ints = random_ints(size);
+    std::vector<std::vector<int>> vecs;
+    for (std::size_t i = 0; i < size; i += inner) {
+        vecs.emplace_back(ints.begin() + i, ints.begin() + i + inner);
+    }
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(UseView ? kernels::join_view(vecs)
+                                         : kernels::join_loop(vecs));
+    }
+
+    set_items_processed(state);
+}
+
+// Args are {string length, field length}; fields are separated by ", "
+void set_split_sizes(benchmark::internal::Benchmark* bench)
+{
+    for (int size : {1 << 12, 1 << 20, 1 << 26}) {
+        for (int field : {4, 64}) {
+            bench->Args({size, field});
+        }
+    }
+}
+
+std::string make_fields(std::size_t size, std::size_t field,
+                        const std::string& delim)
+{
+    std::string str;
+    str.reserve(size + field + delim.size());
+    while (str.size() < size) {
+        str.append(field, 'x');
+        str += delim;
+    }
+    return str;
+}
+
+template <bool UseView>
+void split_multichar(benchmark::State& state)
+{
+    const std::string delim = ", ";
+    const auto str = make_fields(static_cast<std::size_t>(state.range(0)),
+                                 static_cast<std::size_t>(state.range(1)),
+                                 delim);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(UseView ? kernels::split_view(str, delim)
+                                         : kernels::split_loop(str, delim));
+    }
+
+    state.SetBytesProcessed(state.iterations() *
+                            static_cast<long long>(str.size()));
+}
+
+template <bool UseView>
+void split_char(benchmark::State& state)
+{
+    const auto str = make_fields(static_cast<std::size_t>(state.range(0)),
+                                 static_cast<std::size_t>(state.range(1)),
+                                 ",");
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(UseView ? kernels::split_char_view(str, ',')
+                                         : kernels::split_loop(str, ","));
+    }
+
+    state.SetBytesProcessed(state.iterations() *
+                            static_cast<long long>(str.size()));
+}
+
+} // namespace
+
+// In each pair the first benchmark is the hand-written loop
+
+BENCHMARK_TEMPLATE(filter_transform, false)->Apply(set_sizes);
+BENCHMARK_TEMPLATE(filter_transform, true)->Apply(set_sizes);
+
+BENCHMARK_TEMPLATE(filter_transform_take, false)->Apply(set_sizes);
+BENCHMARK_TEMPLATE(filter_transform_take, true)->Apply(set_sizes);
+
+// Here the first benchmark constructs a new view every time
+BENCHMARK_TEMPLATE(filter_begin, false)->Apply(set_sizes);
+BENCHMARK_TEMPLATE(filter_begin, true)->Apply(set_sizes);
+
+BENCHMARK_TEMPLATE(join, false)->Apply(set_join_sizes);
+BENCHMARK_TEMPLATE(join, true)->Apply(set_join_sizes);
+
+BENCHMARK_TEMPLATE(split_multichar, false)->Apply(set_split_sizes);
+BENCHMARK_TEMPLATE(split_multichar, true)->Apply(set_split_sizes);
+
+BENCHMARK_TEMPLATE(split_char, false)->Apply(set_split_sizes);
+BENCHMARK_TEMPLATE(split_char, true)->Apply(set_split_sizes);
@@ -8,9 +8,12 @@
 #define NANORANGE_ALGORITHM_HPP_INCLUDED
 
 // Algorithms reimplemented in Nanorange
+#include <nanorange/algorithm/adaptive_stable_sort.hpp>
 #include <nanorange/algorithm/adjacent_find.hpp>
 #include <nanorange/algorithm/all_of.hpp>
 #include <nanorange/algorithm/any_of.hpp>
+#include <nanorange/algorithm/batch_lower_bound.hpp>
+#include <nanorange/algorithm/batch_upper_bound.hpp>
 #include <nanorange/algorithm/binary_search.hpp>
 #include <nanorange/algorithm/clamp.hpp>
 #include <nanorange/algorithm/copy.hpp>
@@ -28,6 +31,7 @@
 #include <nanorange/algorithm/includes.hpp>
 #include <nanorange/algorithm/inplace_merge.hpp>
 #include <nanorange/algorithm/is_heap.hpp>
+#include <nanorange/algorithm/is_heap_d.hpp>
 #include <nanorange/algorithm/is_heap_until.hpp>
 #include <nanorange/algorithm/is_partitioned.hpp>
 #include <nanorange/algorithm/is_permutation.hpp>
@@ -36,6 +40,7 @@
 #include <nanorange/algorithm/lexicographical_compare.hpp>
 #include <nanorange/algorithm/lower_bound.hpp>
 #include <nanorange/algorithm/make_heap.hpp>
+#include <nanorange/algorithm/make_heap_d.hpp>
 #include <nanorange/algorithm/max.hpp>
 #include <nanorange/algorithm/max_element.hpp>
 #include <nanorange/algorithm/merge.hpp>
@@ -54,8 +59,11 @@
 #include <nanorange/algorithm/partition_copy.hpp>
 #include <nanorange/algorithm/partition_point.hpp>
 #include <nanorange/algorithm/pop_heap.hpp>
+#include <nanorange/algorithm/pop_heap_d.hpp>
 #include <nanorange/algorithm/prev_permutation.hpp>
 #include <nanorange/algorithm/push_heap.hpp>
+#include <nanorange/algorithm/push_heap_d.hpp>
+#include <nanorange/algorithm/radix_sort.hpp>
 #include <nanorange/algorithm/remove.hpp>
 #include <nanorange/algorithm/remove_copy.hpp>
 #include <nanorange/algorithm/remove_copy_if.hpp>
@@ -69,6 +77,7 @@
 #include <nanorange/algorithm/rotate.hpp>
 #include <nanorange/algorithm/rotate_copy.hpp>
 #include <nanorange/algorithm/search.hpp>
+#include <nanorange/algorithm/searchers.hpp>
 #include <nanorange/algorithm/search_n.hpp>
 #include <nanorange/algorithm/set_difference.hpp>
 #include <nanorange/algorithm/set_intersection.hpp>
@@ -78,6 +87,7 @@
 #include <nanorange/algorithm/shuffle.hpp>
 #include <nanorange/algorithm/sort.hpp>
 #include <nanorange/algorithm/sort_heap.hpp>
+#include <nanorange/algorithm/sort_heap_d.hpp>
 #include <nanorange/algorithm/stable_partition.hpp>
 #include <nanorange/algorithm/stable_sort.hpp>
 #include <nanorange/algorithm/swap_ranges.hpp>
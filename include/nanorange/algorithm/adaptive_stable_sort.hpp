@@ -0,0 +1,224 @@
+// nanorange/algorithm/adaptive_stable_sort.hpp
+//
+// Copyright (c) 2020 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_ALGORITHM_ADAPTIVE_STABLE_SORT_HPP_INCLUDED
+#define NANORANGE_ALGORITHM_ADAPTIVE_STABLE_SORT_HPP_INCLUDED
+
+#include <nanorange/algorithm/inplace_merge.hpp>
+#include <nanorange/algorithm/lower_bound.hpp>
+#include <nanorange/algorithm/reverse.hpp>
+#include <nanorange/algorithm/upper_bound.hpp>
+#include <nanorange/detail/algorithm/pdqsort.hpp>
+#include <nanorange/detail/memory/temporary_vector.hpp>
+
+#include <functional>
+#include <limits>
+
+NANO_BEGIN_NAMESPACE
+
+namespace detail {
+
+// Powersort (Munro and Wild, 2018). The range is split into the runs which
+// are already in order, ascending or strictly descending, and the runs are
+// merged in an order which depends on where their boundaries fall, so that
+// merging r runs of n elements in total costs O(n log r) comparisons. Data
+// which is sorted apart from a few appended or reversed stretches is
+// therefore sorted in close to linear time.
+struct adaptive_stable_sort_fn {
+private:
+    // Shorter runs are extended to this length with insertion sort, so that
+    // random data isn't merged one or two elements at a time
+    static constexpr int min_run = 24;
+
+    // Returns the end of the run starting at first, which must not be last,
+    // reversing it first if it is descending. Only strictly descending runs
+    // are reversed, so that no two equal elements change order.
+    template <typename I, typename Comp, typename Proj>
+    static I find_run(I first, I last, Comp& comp, Proj& proj)
+    {
+        I next = first + 1;
+        if (next == last) {
+            return next;
+        }
+
+        const auto less = [&](I a, I b) {
+            return nano::invoke(comp, nano::invoke(proj, *a),
+                                nano::invoke(proj, *b));
+        };
+
+        if (less(next, first)) {
+            do {
+                ++next;
+            } while (next != last && less(next, next - 1));
+            nano::reverse(first, next);
+        } else {
+            do {
+                ++next;
+            } while (next != last && !less(next, next - 1));
+        }
+
+        return next;
+    }
+
+    // The power of the boundary between the adjacent runs [s1, s1 + n1) and
+    // [s1 + n1, s1 + n1 + n2) of a range of n elements: the depth at which
+    // the boundary would be drawn if the range were split in half, then in
+    // quarters and so on, between the runs' midpoints. Runs are merged
+    // across deeper boundaries first.
+    template <typename D>
+    static int node_power(D s1, D n1, D n2, D n)
+    {
+        // Twice the midpoints of the runs, as fractions of n
+        D a = 2 * s1 + n1;
+        D b = a + n1 + n2;
+        int power = 0;
+
+        while (true) {
+            ++power;
+            if (a >= n) {
+                a -= n;
+                b -= n;
+            } else if (b >= n) {
+                return power;
+            }
+            a *= 2;
+            b *= 2;
+        }
+    }
+
+    // Merges the adjacent sorted runs [first, middle) and [middle, last).
+    // The elements at the start of the first run which are no greater than
+    // the start of the second, and those at the end of the second which are
+    // no less than the end of the first, are already in place, so only what
+    // lies between them is merged.
+    template <typename I, typename Buf, typename Comp, typename Proj>
+    static void merge_runs(I first, I middle, I last, Buf& buf, Comp& comp,
+                           Proj& proj)
+    {
+        first = nano::upper_bound(first, middle, nano::invoke(proj, *middle),
+                                  std::ref(comp), std::ref(proj));
+        if (first == middle) {
+            return;
+        }
+        last = nano::lower_bound(middle, last,
+                                 nano::invoke(proj, *(middle - 1)),
+                                 std::ref(comp), std::ref(proj));
+
+        const auto len1 = middle - first;
+        const auto len2 = last - middle;
+        if (buf.capacity() >= static_cast<std::size_t>(nano::min(len1, len2))) {
+            inplace_merge_fn::impl_buffered(std::move(first), std::move(middle),
+                                            std::move(last), len1, len2, buf,
+                                            comp, proj);
+        } else {
+            inplace_merge_fn::impl_slow(std::move(first), std::move(middle),
+                                        std::move(last), len1, len2, comp,
+                                        proj);
+        }
+    }
+
+    template <typename I, typename Comp, typename Proj>
+    static void impl(I first, I last, Comp& comp, Proj& proj)
+    {
+        using diff_t = iter_difference_t<I>;
+
+        struct run {
+            diff_t start;
+            diff_t len;
+            // The power of the boundary with the next run on the stack
+            int power;
+        };
+
+        const diff_t n = last - first;
+
+        // Find the first run before allocating anything, since the range may
+        // already be sorted
+        diff_t end = find_run(first, last, comp, proj) - first;
+        if (end < min_run) {
+            end = nano::min(diff_t(min_run), n);
+            detail::insertion_sort(first, first + end, comp, proj);
+        }
+        if (end == n) {
+            return;
+        }
+
+        // The powers of the boundaries on the stack are strictly increasing,
+        // and none is greater than the number of bits in n
+        run stack[std::numeric_limits<diff_t>::digits + 2];
+        int top = 0;
+        stack[top++] = run{0, end, 0};
+
+        // The merges never need to buffer more than half of the range
+        temporary_vector<iter_value_t<I>> buf(static_cast<std::size_t>(n / 2));
+
+        const auto merge_top = [&] {
+            run& left = stack[top - 2];
+            const run& right = stack[top - 1];
+            merge_runs(first + left.start, first + right.start,
+                       first + (right.start + right.len), buf, comp, proj);
+            left.len += right.len;
+            --top;
+        };
+
+        while (end != n) {
+            const diff_t start = end;
+            end = find_run(first + start, last, comp, proj) - first;
+            if (end - start < min_run) {
+                end = nano::min(start + diff_t(min_run), n);
+                detail::insertion_sort(first + start, first + end, comp, proj);
+            }
+
+            const int power = node_power(stack[top - 1].start,
+                                         stack[top - 1].len, end - start, n);
+            while (top > 1 && stack[top - 2].power > power) {
+                merge_top();
+            }
+            stack[top - 1].power = power;
+            stack[top++] = run{start, end - start, 0};
+        }
+
+        while (top > 1) {
+            merge_top();
+        }
+    }
+
+public:
+    template <typename I, typename S, typename Comp = ranges::less, typename Proj = identity>
+    std::enable_if_t<random_access_iterator<I> && sentinel_for<S, I> &&
+                         sortable<I, Comp, Proj>, I>
+    operator()(I first, S last, Comp comp = Comp{}, Proj proj = Proj{}) const
+    {
+        const auto ilast = nano::next(first, last);
+        if (first != ilast) {
+            impl(std::move(first), ilast, comp, proj);
+        }
+        return ilast;
+    }
+
+    template <typename Rng, typename Comp = ranges::less, typename Proj = identity>
+    std::enable_if_t<random_access_range<Rng> &&
+                         sortable<iterator_t<Rng>, Comp, Proj>,
+                     borrowed_iterator_t<Rng>>
+    operator()(Rng&& rng, Comp comp = Comp{}, Proj proj = Proj{}) const
+    {
+        auto first = nano::begin(rng);
+        const auto last = nano::next(first, nano::end(rng));
+        if (first != last) {
+            impl(std::move(first), last, comp, proj);
+        }
+        return last;
+    }
+};
+
+} // namespace detail
+
+// Sorts [first, last) stably, like stable_sort(), but in close to linear time
+// when the input consists of a few long ascending or descending runs
+NANO_INLINE_VAR(detail::adaptive_stable_sort_fn, adaptive_stable_sort)
+
+NANO_END_NAMESPACE
+
+#endif
@@ -0,0 +1,67 @@
+// nanorange/algorithm/batch_upper_bound.hpp
+//
+// Copyright (c) 2020 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_ALGORITHM_BATCH_UPPER_BOUND_HPP_INCLUDED
+#define NANORANGE_ALGORITHM_BATCH_UPPER_BOUND_HPP_INCLUDED
+
+#include <nanorange/detail/algorithm/branchless_search.hpp>
+#include <nanorange/ranges.hpp>
+
+NANO_BEGIN_NAMESPACE
+
+template <typename I, typename O>
+using batch_upper_bound_result = in_out_result<I, O>;
+
+namespace detail {
+
+// Equivalent to calling nano::upper_bound() on the sorted range [first, last)
+// for each key in turn and writing the results to out, but much faster for
+// many keys, especially on ranges too large for the cache: the searches for
+// several keys are run side by side (see detail::batch_bound()).
+struct batch_upper_bound_fn {
+    template <typename I, typename S, typename KI, typename KS, typename O,
+              typename Comp = ranges::less, typename Proj = identity>
+    std::enable_if_t<
+        random_access_iterator<I> && sized_sentinel_for<S, I> &&
+            forward_iterator<KI> && sentinel_for<KS, KI> &&
+            weakly_incrementable<O> && writable<O, const I&> &&
+            indirect_strict_weak_order<Comp, KI, projected<I, Proj>>,
+        batch_upper_bound_result<KI, O>>
+    operator()(I first, S last, KI kfirst, KS klast, O out, Comp comp = Comp{},
+               Proj proj = Proj{}) const
+    {
+        const auto n = last - first;
+        return detail::batch_bound<true>(std::move(first), n,
+                                         std::move(kfirst), std::move(klast),
+                                         std::move(out), comp, proj);
+    }
+
+    // The output iterators refer into rng, so it may not be a temporary
+    template <typename Rng, typename KRng, typename O,
+              typename Comp = ranges::less, typename Proj = identity>
+    std::enable_if_t<
+        random_access_range<Rng> && sized_range<Rng> && borrowed_range<Rng> &&
+            forward_range<KRng> && weakly_incrementable<O> &&
+            writable<O, const iterator_t<Rng>&> &&
+            indirect_strict_weak_order<Comp, iterator_t<KRng>,
+                                       projected<iterator_t<Rng>, Proj>>,
+        batch_upper_bound_result<borrowed_iterator_t<KRng>, O>>
+    operator()(Rng&& rng, KRng&& keys, O out, Comp comp = Comp{},
+               Proj proj = Proj{}) const
+    {
+        return detail::batch_bound<true>(nano::begin(rng), nano::distance(rng),
+                                         nano::begin(keys), nano::end(keys),
+                                         std::move(out), comp, proj);
+    }
+};
+
+} // namespace detail
+
+NANO_INLINE_VAR(detail::batch_upper_bound_fn, batch_upper_bound)
+
+NANO_END_NAMESPACE
+
+#endif
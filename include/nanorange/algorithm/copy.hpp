@@ -7,6 +7,7 @@
 #ifndef NANORANGE_ALGORITHM_COPY_HPP_INCLUDED
 #define NANORANGE_ALGORITHM_COPY_HPP_INCLUDED
 
+#include <nanorange/detail/algorithm/memmove.hpp>
 #include <nanorange/detail/algorithm/result_types.hpp>
 #include <nanorange/ranges.hpp>
 
@@ -19,6 +20,22 @@ namespace detail {
 
 struct copy_fn {
 private:
+    // Contiguous ranges of trivially copyable types can be copied with
+    // memmove, but only at run time
+    template <typename I, typename S, typename O>
+    static constexpr std::enable_if_t<is_memmove_assignable<I, S, O>,
+                                      copy_result<I, O>>
+    impl(I first, S last, O result, priority_tag<2>)
+    {
+        if (!detail::is_constant_evaluated()) {
+            const auto dist = last - first;
+            return detail::memmove_forward(std::move(first), dist,
+                                           std::move(result));
+        }
+        return impl(std::move(first), std::move(last), std::move(result),
+                    priority_tag<1>{});
+    }
+
     // If we know the distance between first and last, we can use that
     // information to (potentially) allow better codegen
     template <typename I, typename S, typename O>
@@ -58,7 +75,7 @@ public:
     operator()(I first, S last, O result) const
     {
         return copy_fn::impl(std::move(first), std::move(last),
-                             std::move(result), priority_tag<1>{});
+                             std::move(result), priority_tag<2>{});
     }
 
     template <typename Rng, typename O>
@@ -68,7 +85,7 @@ public:
     operator()(Rng&& rng, O result) const
     {
         return copy_fn::impl(nano::begin(rng), nano::end(rng),
-                             std::move(result), priority_tag<1>{});
+                             std::move(result), priority_tag<2>{});
     }
 };
 
@@ -88,6 +105,13 @@ struct copy_n_fn {
                                copy_n_result<I, O>>
     operator()(I first, iter_difference_t<I> n, O result) const
     {
+        if constexpr (is_memmove_assignable<I, I, O>) {
+            if (!detail::is_constant_evaluated()) {
+                return detail::memmove_forward(std::move(first), n > 0 ? n : 0,
+                                               std::move(result));
+            }
+        }
+
         for (iter_difference_t<I> i{}; i < n; i++) {
             *result = *first;
             ++first;
@@ -167,6 +191,14 @@ private:
     static constexpr copy_backward_result<I1, I2>
     impl(I1 first, S1 last, I2 result)
     {
+        if constexpr (is_memmove_assignable<I1, S1, I2>) {
+            if (!detail::is_constant_evaluated()) {
+                const auto dist = last - first;
+                return detail::memmove_backward(std::move(first), dist,
+                                                std::move(result));
+            }
+        }
+
         I1 last_it = nano::next(first, std::move(last));
         I1 it = last_it;
 
@@ -7,6 +7,7 @@
 #ifndef NANORANGE_ALGORITHM_COUNT_HPP_INCLUDED
 #define NANORANGE_ALGORITHM_COUNT_HPP_INCLUDED
 
+#include <nanorange/detail/algorithm/simd_find.hpp>
 #include <nanorange/ranges.hpp>
 
 NANO_BEGIN_NAMESPACE
@@ -65,6 +66,26 @@ NANO_INLINE_VAR(detail::count_if_fn, count_if)
 namespace detail {
 
 struct count_fn {
+private:
+    template <typename I, typename S, typename T, typename Proj>
+    static constexpr iter_difference_t<I> impl(I first, S last, const T& value,
+                                               Proj& proj)
+    {
+        if constexpr (simd_findable<I, S, T, Proj>) {
+            if (!detail::is_constant_evaluated()) {
+                const auto dist = last - first;
+                return detail::count_contiguous(std::move(first), dist, value);
+            }
+        }
+
+        const auto pred = [&value] (const auto& t) {
+            return detail::find_equal(t, value);
+        };
+        return count_if_fn::impl(std::move(first), std::move(last),
+                                 pred, proj);
+    }
+
+public:
     template <typename I, typename S, typename T, typename Proj = identity>
     constexpr std::enable_if_t<
         input_iterator<I> && sentinel_for<S, I> &&
@@ -72,9 +93,7 @@ struct count_fn {
         iter_difference_t<I>>
     operator()(I first, S last, const T& value, Proj proj = Proj{}) const
     {
-        const auto pred = [&value] (const auto& t) { return t == value; };
-        return count_if_fn::impl(std::move(first), std::move(last),
-                                 pred, proj);
+        return count_fn::impl(std::move(first), std::move(last), value, proj);
     }
 
     template <typename Rng, typename T, typename Proj = identity>
@@ -85,9 +104,7 @@ struct count_fn {
         range_difference_t<Rng>>
     operator()(Rng&& rng, const T& value, Proj proj = Proj{}) const
     {
-        const auto pred = [&value] (const auto& t) { return t == value; };
-        return count_if_fn::impl(nano::begin(rng), nano::end(rng),
-                                 pred, proj);
+        return count_fn::impl(nano::begin(rng), nano::end(rng), value, proj);
     }
 };
 
@@ -7,6 +7,7 @@
 #ifndef NANORANGE_ALGORITHM_EQUAL_HPP_INCLUDED
 #define NANORANGE_ALGORITHM_EQUAL_HPP_INCLUDED
 
+#include <nanorange/detail/algorithm/simd_mismatch.hpp>
 #include <nanorange/iterator/operations.hpp>
 #include <nanorange/ranges.hpp>
 
@@ -38,6 +39,18 @@ private:
     static constexpr bool impl3(I1 first1, S1 last1, I2 first2, Pred pred,
                                 Proj1& proj1, Proj2& proj2)
     {
+        // Contiguous ranges of integers can be compared with memcmp, but
+        // only at run time
+        if constexpr (same_as<Pred, ranges::equal_to> &&
+                      sized_sentinel_for<S1, I1> &&
+                      is_bitwise_comparable<I1, I2, Proj1, Proj2>) {
+            if (!detail::is_constant_evaluated()) {
+                const auto n = last1 - first1;
+                return detail::memcmp_equal(std::move(first1),
+                                            std::move(first2), n);
+            }
+        }
+
         while (first1 != last1) {
             if (!nano::invoke(pred, nano::invoke(proj1, *first1),
                               nano::invoke(proj2, *first2))) {
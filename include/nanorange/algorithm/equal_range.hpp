@@ -21,8 +21,12 @@ private:
     static constexpr subrange<I> impl(I first, S last, const T& value,
                                       Comp& comp, Proj& proj)
     {
-        return {lower_bound_fn::impl(first, last, value, comp, proj),
-                upper_bound_fn::impl(first, last, value, comp, proj)};
+        // The upper bound cannot be before the lower one
+        I lower = lower_bound_fn::impl(std::move(first), last, value, comp,
+                                       proj);
+        I upper = upper_bound_fn::impl(lower, std::move(last), value, comp,
+                                       proj);
+        return {std::move(lower), std::move(upper)};
     }
 
 public:
@@ -7,6 +7,7 @@
 #ifndef NANORANGE_ALGORITHM_FILL_HPP_INCLUDED
 #define NANORANGE_ALGORITHM_FILL_HPP_INCLUDED
 
+#include <nanorange/detail/algorithm/parallel_chunks.hpp>
 #include <nanorange/ranges.hpp>
 
 NANO_BEGIN_NAMESPACE
@@ -26,6 +27,21 @@ private:
         return first;
     }
 
+    template <typename EP, typename T, typename O>
+    static O policy_impl(EP& policy, O first, iter_difference_t<O> n,
+                         const T& value)
+    {
+        if constexpr (parallel_execution_policy<EP>) {
+            auto run = [&](iter_difference_t<O> lo, iter_difference_t<O> hi) {
+                fill_fn::impl(first + lo, first + hi, value);
+            };
+            detail::parallel_chunks(policy, first, n, run);
+            return first + n;
+        } else {
+            return fill_fn::impl(first, first + n, value);
+        }
+    }
+
 public:
     template <typename T, typename O, typename S>
     constexpr std::enable_if_t<
@@ -42,6 +58,26 @@ public:
     {
         return fill_fn::impl(nano::begin(rng), nano::end(rng), value);
     }
+
+    template <typename EP, typename T, typename O, typename S>
+    std::enable_if_t<execution_policy<EP> && random_access_iterator<O> &&
+                         sized_sentinel_for<S, O> && output_iterator<O, const T&>,
+                     O>
+    operator()(EP&& policy, O first, S last, const T& value) const
+    {
+        const auto n = last - first;
+        return fill_fn::policy_impl(policy, std::move(first), n, value);
+    }
+
+    template <typename EP, typename T, typename Rng>
+    std::enable_if_t<execution_policy<EP> && random_access_range<Rng> &&
+                         sized_range<Rng> && output_range<Rng, const T&>,
+                     borrowed_iterator_t<Rng>>
+    operator()(EP&& policy, Rng&& rng, const T& value) const
+    {
+        return fill_fn::policy_impl(policy, nano::begin(rng),
+                                    nano::distance(rng), value);
+    }
 };
 
 } // namespace detail
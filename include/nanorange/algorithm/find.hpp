@@ -7,6 +7,7 @@
 #ifndef NANORANGE_ALGORITHM_FIND_HPP_INCLUDED
 #define NANORANGE_ALGORITHM_FIND_HPP_INCLUDED
 
+#include <nanorange/detail/algorithm/simd_find.hpp>
 #include <nanorange/ranges.hpp>
 
 NANO_BEGIN_NAMESPACE
@@ -60,6 +61,26 @@ NANO_INLINE_VAR(detail::find_if_fn, find_if)
 namespace detail {
 
 struct find_fn {
+private:
+    template <typename I, typename S, typename T, typename Proj>
+    static constexpr I impl(I first, S last, const T& value, Proj& proj)
+    {
+        // Searching contiguous arrays of arithmetic types can be vectorised,
+        // but only at run time
+        if constexpr (simd_findable<I, S, T, Proj>) {
+            if (!detail::is_constant_evaluated()) {
+                const auto dist = last - first;
+                return detail::find_contiguous(std::move(first), dist, value);
+            }
+        }
+
+        const auto pred = [&value] (const auto& t) {
+            return detail::find_equal(t, value);
+        };
+        return find_if_fn::impl(std::move(first), std::move(last), pred, proj);
+    }
+
+public:
     template <typename I, typename S, typename T, typename Proj = identity>
     constexpr std::enable_if_t<
         input_iterator<I> && sentinel_for<S, I> &&
@@ -67,8 +88,7 @@ struct find_fn {
         I>
     operator()(I first, S last, const T& value, Proj proj = Proj{}) const
     {
-        const auto pred = [&value] (const auto& t) { return t == value; };
-        return find_if_fn::impl(std::move(first), std::move(last), pred, proj);
+        return find_fn::impl(std::move(first), std::move(last), value, proj);
     }
 
     template <typename Rng, typename T, typename Proj = identity>
@@ -79,8 +99,7 @@ struct find_fn {
         borrowed_iterator_t<Rng>>
     operator()(Rng&& rng, const T& value, Proj proj = Proj{}) const
     {
-        const auto pred = [&value] (const auto& t) { return t == value; };
-        return find_if_fn::impl(nano::begin(rng), nano::end(rng), pred, proj);
+        return find_fn::impl(nano::begin(rng), nano::end(rng), value, proj);
     }
 };
 } // namespace detail
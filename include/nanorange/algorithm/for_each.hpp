@@ -7,6 +7,7 @@
 #ifndef NANORANGE_ALGORITHM_FOR_EACH_HPP_INCLUDED
 #define NANORANGE_ALGORITHM_FOR_EACH_HPP_INCLUDED
 
+#include <nanorange/detail/algorithm/parallel_chunks.hpp>
 #include <nanorange/detail/algorithm/result_types.hpp>
 #include <nanorange/ranges.hpp>
 
@@ -32,6 +33,24 @@ private:
         return {first, std::move(fun)};
     }
 
+    // The parallel overloads call the same fun from every task
+    template <typename EP, typename I, typename Proj, typename Fun>
+    static void policy_impl(EP& policy, I first, iter_difference_t<I> n,
+                            Fun& fun, Proj& proj)
+    {
+        auto run = [&](iter_difference_t<I> lo, iter_difference_t<I> hi) {
+            for (; lo != hi; ++lo) {
+                nano::invoke(fun, nano::invoke(proj, first[lo]));
+            }
+        };
+
+        if constexpr (parallel_execution_policy<EP>) {
+            detail::parallel_chunks(policy, first, n, run);
+        } else {
+            run(0, n);
+        }
+    }
+
 public:
     template <typename I, typename S, typename Proj = identity, typename Fun>
     constexpr std::enable_if_t<
@@ -54,6 +73,33 @@ public:
         return for_each_fn::impl(nano::begin(rng), nano::end(rng),
                                  fun, proj);
     }
+
+    template <typename EP, typename I, typename S, typename Proj = identity,
+              typename Fun>
+    std::enable_if_t<
+        execution_policy<EP> && random_access_iterator<I> &&
+            sized_sentinel_for<S, I> &&
+            indirect_unary_invocable<Fun, projected<I, Proj>>,
+        for_each_result<I, Fun>>
+    operator()(EP&& policy, I first, S last, Fun fun, Proj proj = Proj{}) const
+    {
+        const auto n = last - first;
+        for_each_fn::policy_impl(policy, first, n, fun, proj);
+        return {first + n, std::move(fun)};
+    }
+
+    template <typename EP, typename Rng, typename Proj = identity, typename Fun>
+    std::enable_if_t<
+        execution_policy<EP> && random_access_range<Rng> && sized_range<Rng> &&
+            indirect_unary_invocable<Fun, projected<iterator_t<Rng>, Proj>>,
+        for_each_result<borrowed_iterator_t<Rng>, Fun>>
+    operator()(EP&& policy, Rng&& rng, Fun fun, Proj proj = Proj{}) const
+    {
+        const auto first = nano::begin(rng);
+        const auto n = nano::distance(rng);
+        for_each_fn::policy_impl(policy, first, n, fun, proj);
+        return {first + n, std::move(fun)};
+    }
 };
 } // namespace detail
 
@@ -7,6 +7,7 @@
 #ifndef NANORANGE_ALGORITHM_GENERATE_HPP_INCLUDED
 #define NANORANGE_ALGORITHM_GENERATE_HPP_INCLUDED
 
+#include <nanorange/detail/algorithm/parallel_chunks.hpp>
 #include <nanorange/ranges.hpp>
 
 NANO_BEGIN_NAMESPACE
@@ -26,6 +27,21 @@ private:
         return first;
     }
 
+    // The parallel overloads call the same gen from every task
+    template <typename EP, typename O, typename F>
+    static O policy_impl(EP& policy, O first, iter_difference_t<O> n, F& gen)
+    {
+        if constexpr (parallel_execution_policy<EP>) {
+            auto run = [&](iter_difference_t<O> lo, iter_difference_t<O> hi) {
+                generate_fn::impl(first + lo, first + hi, gen);
+            };
+            detail::parallel_chunks(policy, first, n, run);
+            return first + n;
+        } else {
+            return generate_fn::impl(first, first + n, gen);
+        }
+    }
+
 public:
     template <typename O, typename S, typename F>
     constexpr std::enable_if_t<input_or_output_iterator<O> &&
@@ -46,6 +62,28 @@ public:
     {
         return generate_fn::impl(nano::begin(rng), nano::end(rng), gen);
     }
+
+    template <typename EP, typename O, typename S, typename F>
+    std::enable_if_t<execution_policy<EP> && random_access_iterator<O> &&
+                         sized_sentinel_for<S, O> && copy_constructible<F> &&
+                         invocable<F&> && writable<O, invoke_result_t<F&>>,
+                     O>
+    operator()(EP&& policy, O first, S last, F gen) const
+    {
+        const auto n = last - first;
+        return generate_fn::policy_impl(policy, std::move(first), n, gen);
+    }
+
+    template <typename EP, typename Rng, typename F>
+    std::enable_if_t<execution_policy<EP> && random_access_range<Rng> &&
+                         sized_range<Rng> && invocable<F&> &&
+                         output_range<Rng, invoke_result_t<F&>>,
+                     borrowed_iterator_t<Rng>>
+    operator()(EP&& policy, Rng&& rng, F gen) const
+    {
+        return generate_fn::policy_impl(policy, nano::begin(rng),
+                                        nano::distance(rng), gen);
+    }
 };
 
 } // namespace detail
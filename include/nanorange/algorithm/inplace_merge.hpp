@@ -28,6 +28,7 @@
 #include <nanorange/algorithm/move.hpp>
 #include <nanorange/algorithm/rotate.hpp>
 #include <nanorange/algorithm/upper_bound.hpp>
+#include <nanorange/detail/algorithm/gallop.hpp>
 #include <nanorange/detail/memory/temporary_vector.hpp>
 #include <nanorange/iterator/back_insert_iterator.hpp>
 #include <nanorange/iterator/move_iterator.hpp>
@@ -38,6 +39,7 @@ namespace detail {
 
 struct inplace_merge_fn {
 private:
+    friend struct adaptive_stable_sort_fn;
     friend struct stable_sort_fn;
 
     template <typename I, typename Pred, typename Proj>
@@ -130,6 +132,42 @@ private:
         }
     }
 
+    // Moves the elements of [first1, last1) and [first2, last2) into result
+    // in merged order, where the second range ends exactly where the output
+    // does. Once the first range runs out, whatever is left of the second is
+    // already in place, so we stop rather than move it onto itself.
+    template <typename I1, typename I2, typename O, typename Comp, typename Proj>
+    static void move_merge_into_place(I1 first1, I1 last1, I2 first2, I2 last2,
+                                      O result, Comp& comp, Proj& proj)
+    {
+        // The buffer is always random access, but the range may not be
+        if constexpr (random_access_iterator<I2>) {
+            auto res = detail::gallop_merge<true>(
+                std::move(first1), last1 - first1, std::move(first2),
+                last2 - first2, std::move(result), comp, proj, proj);
+            first1 = std::move(res.in1);
+            first2 = std::move(res.in2);
+            result = std::move(res.out);
+        }
+
+        while (first1 != last1) {
+            if (first2 == last2) {
+                nano::move(std::move(first1), std::move(last1), std::move(result));
+                return;
+            }
+
+            if (nano::invoke(comp, nano::invoke(proj, *first2),
+                             nano::invoke(proj, *first1))) {
+                *result = nano::iter_move(first2);
+                ++first2;
+            } else {
+                *result = nano::iter_move(first1);
+                ++first1;
+            }
+            ++result;
+        }
+    }
+
     template <typename I, typename Buf, typename Comp, typename Proj>
     static void impl_buffered(I first, I middle, I last,
                               iter_difference_t<I> len1, iter_difference_t<I> len2,
@@ -137,28 +175,22 @@ private:
     {
         if (len1 <= len2) {
             nano::move(first, middle, nano::back_inserter(buf));
-            nano::merge(
-                nano::make_move_iterator(buf.begin()),
-                nano::make_move_sentinel(buf.end()),
-                nano::make_move_iterator(std::move(middle)),
-                nano::make_move_sentinel(std::move(last)),
-                std::move(first), std::ref(comp), std::ref(proj), std::ref(proj));
+            move_merge_into_place(buf.begin(), buf.end(), std::move(middle),
+                                  std::move(last), std::move(first), comp, proj);
         } else {
             nano::move(middle, last, nano::back_inserter(buf));
             using ri_t = nano::reverse_iterator<I>;
-            // TODO: C++17's not_fn would be useful
-            auto not_comp = [&comp] (auto&& a, auto&& b) {
-                return !nano::invoke(comp, std::forward<decltype(a)>(a),
-                        std::forward<decltype(b)>(b));
+            // Merging backwards, so elements of the buffered range go first
+            // unless they compare strictly less
+            auto rev_comp = [&comp] (auto&& a, auto&& b) {
+                return nano::invoke(comp, std::forward<decltype(b)>(b),
+                                    std::forward<decltype(a)>(a));
             };
-            nano::merge(
-                nano::make_move_iterator(ri_t{std::move(middle)}),
-                nano::make_move_sentinel(ri_t{std::move(first)}),
-                nano::make_move_iterator(nano::rbegin(buf)),
-                nano::make_move_sentinel(nano::rend(buf)),
-                nano::make_reverse_iterator(std::move(last)),
-                not_comp, std::ref(proj), std::ref(proj));
+            move_merge_into_place(nano::rbegin(buf), nano::rend(buf),
+                                  ri_t{std::move(middle)}, ri_t{std::move(first)},
+                                  ri_t{std::move(last)}, rev_comp, proj);
         }
+        buf.clear();
     }
 
     template <typename I, typename S, typename Comp, typename Proj>
@@ -0,0 +1,79 @@
+// nanorange/algorithm/is_heap_d.hpp
+//
+// Copyright (c) 2020 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_ALGORITHM_IS_HEAP_D_HPP_INCLUDED
+#define NANORANGE_ALGORITHM_IS_HEAP_D_HPP_INCLUDED
+
+#include <nanorange/ranges.hpp>
+
+#include <cstddef>
+
+NANO_BEGIN_NAMESPACE
+
+namespace detail {
+
+// Extension: is_heap for a heap in which each element has D children
+template <std::size_t D>
+struct is_heap_d_fn {
+private:
+    static_assert(D >= 2, "A d-ary heap must have arity of at least 2");
+
+    // Returns the length of the longest prefix which is a heap
+    template <typename I, typename Comp, typename Proj>
+    static constexpr iter_difference_t<I> impl(I first,
+                                               const iter_difference_t<I> n,
+                                               Comp& comp, Proj& proj)
+    {
+        using diff_t = iter_difference_t<I>;
+        constexpr auto d = static_cast<diff_t>(D);
+
+        for (diff_t c = 1; c < n; ++c) {
+            if (nano::invoke(comp, nano::invoke(proj, *(first + (c - 1) / d)),
+                             nano::invoke(proj, *(first + c)))) {
+                return c;
+            }
+        }
+
+        return n;
+    }
+
+public:
+    template <typename I, typename S, typename Comp = ranges::less,
+              typename Proj = identity>
+    constexpr std::enable_if_t<
+        random_access_iterator<I> && sentinel_for<S, I> &&
+            indirect_strict_weak_order<Comp, projected<I, Proj>>,
+        bool>
+    operator()(I first, S last, Comp comp = Comp{}, Proj proj = Proj{}) const
+    {
+        const auto n = nano::distance(first, last);
+        return is_heap_d_fn::impl(std::move(first), n, comp, proj) == n;
+    }
+
+    template <typename Rng, typename Comp = ranges::less, typename Proj = identity>
+    constexpr std::enable_if_t<
+        random_access_range<Rng> &&
+            indirect_strict_weak_order<Comp, projected<iterator_t<Rng>, Proj>>,
+        bool>
+    operator()(Rng&& rng, Comp comp = Comp{}, Proj proj = Proj{}) const
+    {
+        const auto n = nano::distance(rng);
+        return is_heap_d_fn::impl(nano::begin(rng), n, comp, proj) == n;
+    }
+};
+
+} // namespace detail
+
+inline namespace function_objects {
+
+template <std::size_t D>
+inline constexpr detail::is_heap_d_fn<D> is_heap_d{};
+
+}
+
+NANO_END_NAMESPACE
+
+#endif
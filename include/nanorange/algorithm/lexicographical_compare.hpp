@@ -7,6 +7,7 @@
 #ifndef NANORANGE_ALGORITHM_LEXICOGRAPHICAL_COMPARE_HPP_INCLUDED
 #define NANORANGE_ALGORITHM_LEXICOGRAPHICAL_COMPARE_HPP_INCLUDED
 
+#include <nanorange/detail/algorithm/simd_mismatch.hpp>
 #include <nanorange/ranges.hpp>
 
 NANO_BEGIN_NAMESPACE
@@ -20,6 +21,27 @@ private:
     static constexpr bool impl(I1 first1, S1 last1, I2 first2, S2 last2,
                                 Comp& comp, Proj1& proj1, Proj2& proj2)
     {
+        // For contiguous ranges of integers, we can find the first position
+        // at which they differ a vector at a time, and compare there
+        if constexpr (same_as<Comp, ranges::less> &&
+                      sized_sentinel_for<S1, I1> &&
+                      sized_sentinel_for<S2, I2> &&
+                      is_bitwise_comparable<I1, I2, Proj1, Proj2>) {
+            if (!detail::is_constant_evaluated()) {
+                const auto n1 = last1 - first1;
+                const auto n2 = static_cast<iter_difference_t<I1>>(
+                    last2 - first2);
+                const auto n = n1 < n2 ? n1 : n2;
+                const auto i =
+                    detail::first_difference_contiguous(first1, first2, n);
+                if (i != n) {
+                    return first1[i] <
+                           first2[static_cast<iter_difference_t<I2>>(i)];
+                }
+                return n1 < n2;
+            }
+        }
+
         while (first1 != last1 && first2 != last2) {
             if (nano::invoke(comp, nano::invoke(proj1, *first1),
                               nano::invoke(proj2, *first2))) {
@@ -8,6 +8,7 @@
 #define NANORANGE_ALGORITHM_LOWER_BOUND_HPP_INCLUDED
 
 #include <nanorange/algorithm/partition_point.hpp>
+#include <nanorange/detail/algorithm/branchless_search.hpp>
 
 NANO_BEGIN_NAMESPACE
 
@@ -35,6 +36,18 @@ private:
     static constexpr I impl(I first, S last, const T& value, Comp& comp, Proj& proj)
     {
         const auto comparator = compare<Comp, T>{comp, value};
+
+        // Contiguous ranges of scalars can be searched without branches, but
+        // only at run time
+        if constexpr (sized_sentinel_for<S, I> &&
+                      branchless_searchable<I, Proj>) {
+            if (!detail::is_constant_evaluated()) {
+                const auto n = nano::distance(first, std::move(last));
+                return detail::branchless_partition_point(std::move(first), n,
+                                                          comparator, proj);
+            }
+        }
+
         return partition_point_fn::impl(std::move(first), std::move(last),
                                         comparator, proj);
     }
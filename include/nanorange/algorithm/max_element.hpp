@@ -7,6 +7,7 @@
 #ifndef NANORANGE_ALGORITHM_MAX_ELEMENT_HPP_INCLUDED
 #define NANORANGE_ALGORITHM_MAX_ELEMENT_HPP_INCLUDED
 
+#include <nanorange/detail/algorithm/simd_minmax.hpp>
 #include <nanorange/ranges.hpp>
 
 NANO_BEGIN_NAMESPACE
@@ -17,14 +18,23 @@ struct max_element_fn {
     template <typename I, typename S, typename Comp, typename Proj>
     static constexpr I impl(I first, S last, Comp& comp, Proj& proj)
     {
+        if constexpr (simd_minmaxable<I, S, Comp, Proj>) {
+            if (!detail::is_constant_evaluated()) {
+                const auto dist = last - first;
+                return detail::minmax_element_contiguous<
+                    simd_minmax_kind::max>(std::move(first), dist).second;
+            }
+        }
+
         if (first == last) {
             return first;
         }
 
+        // Returns the first of several equal largest elements
         I i = nano::next(first);
         while (i != last) {
-            if (!nano::invoke(comp, nano::invoke(proj, *i),
-                              nano::invoke(proj, *first))) {
+            if (nano::invoke(comp, nano::invoke(proj, *first),
+                             nano::invoke(proj, *i))) {
                 first = i;
             }
             ++i;
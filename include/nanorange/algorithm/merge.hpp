@@ -8,6 +8,7 @@
 #define NANORANGE_ALGORITHM_MERGE_HPP_INCLUDED
 
 #include <nanorange/algorithm/copy.hpp>
+#include <nanorange/detail/algorithm/gallop.hpp>
 #include <nanorange/detail/algorithm/result_types.hpp>
 
 NANO_BEGIN_NAMESPACE
@@ -25,6 +26,19 @@ private:
     impl(I1 first1, S1 last1, I2 first2, S2 last2, O result, Comp& comp,
          Proj1& proj1, Proj2& proj2)
     {
+        // With random access we can gallop through runs from either input
+        if constexpr (random_access_iterator<I1> && sized_sentinel_for<S1, I1> &&
+                      random_access_iterator<I2> && sized_sentinel_for<S2, I2>) {
+            const auto n1 = last1 - first1;
+            const auto n2 = last2 - first2;
+            auto res = detail::gallop_merge<false>(
+                std::move(first1), n1, std::move(first2), n2,
+                std::move(result), comp, proj1, proj2);
+            first1 = std::move(res.in1);
+            first2 = std::move(res.in2);
+            result = std::move(res.out);
+        }
+
         while (first1 != last1) {
             // If we've reached the end of the second range, copy any remaining
             // elements from the first range directly
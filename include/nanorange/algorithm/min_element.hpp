@@ -7,6 +7,7 @@
 #ifndef NANORANGE_ALGORITHM_MIN_ELEMENT_HPP_INCLUDED
 #define NANORANGE_ALGORITHM_MIN_ELEMENT_HPP_INCLUDED
 
+#include <nanorange/detail/algorithm/simd_minmax.hpp>
 #include <nanorange/ranges.hpp>
 
 NANO_BEGIN_NAMESPACE
@@ -15,11 +16,19 @@ namespace detail {
 
 struct min_element_fn {
 private:
-    friend struct nth_element_fn;
-
     template <typename I, typename S, typename Comp, typename Proj>
     static constexpr I impl(I first, S last, Comp& comp, Proj& proj)
     {
+        // Contiguous arrays of arithmetic types can be searched using vector
+        // instructions, but only at run time
+        if constexpr (simd_minmaxable<I, S, Comp, Proj>) {
+            if (!detail::is_constant_evaluated()) {
+                const auto dist = last - first;
+                return detail::minmax_element_contiguous<
+                    simd_minmax_kind::min>(std::move(first), dist).first;
+            }
+        }
+
         if (first == last) {
             return first;
         }
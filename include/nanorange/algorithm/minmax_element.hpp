@@ -11,6 +11,7 @@
 #define NANORANGE_ALGORITHM_MINMAX_ELEMENT_HPP_INCLUDED
 
 #include <nanorange/detail/algorithm/result_types.hpp>
+#include <nanorange/detail/algorithm/simd_minmax.hpp>
 #include <nanorange/ranges.hpp>
 
 NANO_BEGIN_NAMESPACE
@@ -25,6 +26,15 @@ private:
     template <typename I, typename S, typename Comp, typename Proj>
     static constexpr minmax_element_result<I> impl(I first, S last, Comp& comp, Proj& proj)
     {
+        if constexpr (simd_minmaxable<I, S, Comp, Proj>) {
+            if (!detail::is_constant_evaluated()) {
+                const auto dist = last - first;
+                auto res = detail::minmax_element_contiguous<
+                    simd_minmax_kind::minmax>(std::move(first), dist);
+                return {std::move(res.first), std::move(res.second)};
+            }
+        }
+
         minmax_element_result<I> result{first, first};
 
         if (first == last || ++first == last) {
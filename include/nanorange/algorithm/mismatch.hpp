@@ -8,6 +8,7 @@
 #define NANORANGE_ALGORITHM_MISMATCH_HPP_INCLUDED
 
 #include <nanorange/detail/algorithm/result_types.hpp>
+#include <nanorange/detail/algorithm/simd_mismatch.hpp>
 #include <nanorange/ranges.hpp>
 
 NANO_BEGIN_NAMESPACE
@@ -23,11 +24,31 @@ struct mismatch_fn {
 private:
     friend struct is_permutation_fn;
 
+    // Contiguous ranges of integers are compared a vector at a time
+    template <typename I1, typename I2>
+    static mismatch_result<I1, I2>
+    impl_contiguous(I1 first1, I2 first2, iter_difference_t<I1> n)
+    {
+        const auto i = detail::first_difference_contiguous(first1, first2, n);
+        return {first1 + i,
+                first2 + static_cast<iter_difference_t<I2>>(i)};
+    }
+
     template <typename I1, typename S1, typename I2, typename Proj1,
               typename Proj2, typename Pred>
     static constexpr mismatch_result<I1, I2>
     impl3(I1 first1, S1 last1, I2 first2, Pred& pred, Proj1& proj1, Proj2& proj2)
     {
+        if constexpr (same_as<Pred, ranges::equal_to> &&
+                      sized_sentinel_for<S1, I1> &&
+                      is_bitwise_comparable<I1, I2, Proj1, Proj2>) {
+            if (!detail::is_constant_evaluated()) {
+                return mismatch_fn::impl_contiguous(std::move(first1),
+                                                    std::move(first2),
+                                                    last1 - first1);
+            }
+        }
+
         while (first1 != last1 &&
                nano::invoke(pred, nano::invoke(proj1, *first1),
                             nano::invoke(proj2, *first2))) {
@@ -44,6 +65,20 @@ private:
     impl4(I1 first1, S1 last1, I2 first2, S2 last2, Pred& pred, Proj1& proj1,
           Proj2& proj2)
     {
+        if constexpr (same_as<Pred, ranges::equal_to> &&
+                      sized_sentinel_for<S1, I1> &&
+                      sized_sentinel_for<S2, I2> &&
+                      is_bitwise_comparable<I1, I2, Proj1, Proj2>) {
+            if (!detail::is_constant_evaluated()) {
+                const auto n1 = last1 - first1;
+                const auto n2 = static_cast<iter_difference_t<I1>>(
+                    last2 - first2);
+                return mismatch_fn::impl_contiguous(std::move(first1),
+                                                    std::move(first2),
+                                                    n1 < n2 ? n1 : n2);
+            }
+        }
+
         while (first1 != last1 && first2 != last2 &&
                nano::invoke(pred, nano::invoke(proj1, *first1),
                             nano::invoke(proj2, *first2))) {
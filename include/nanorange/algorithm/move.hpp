@@ -7,6 +7,7 @@
 #ifndef NANORANGE_ALGORITHM_MOVE_HPP_INCLUDED
 #define NANORANGE_ALGORITHM_MOVE_HPP_INCLUDED
 
+#include <nanorange/detail/algorithm/memmove.hpp>
 #include <nanorange/detail/algorithm/result_types.hpp>
 #include <nanorange/ranges.hpp>
 
@@ -19,6 +20,20 @@ namespace detail {
 
 struct move_fn {
 private:
+    template <typename I, typename S, typename O>
+    static constexpr std::enable_if_t<is_memmove_assignable<I, S, O, true>,
+                                      move_result<I, O>>
+    impl(I first, S last, O result, priority_tag<2>)
+    {
+        if (!detail::is_constant_evaluated()) {
+            const auto dist = last - first;
+            return detail::memmove_forward(std::move(first), dist,
+                                           std::move(result));
+        }
+        return impl(std::move(first), std::move(last), std::move(result),
+                    priority_tag<1>{});
+    }
+
     template <typename I, typename S, typename O>
     static constexpr std::enable_if_t<sized_sentinel_for<S, I>, move_result<I, O>>
     impl(I first, S last, O result, priority_tag<1>)
@@ -56,7 +71,7 @@ public:
     operator()(I first, S last, O result) const
     {
         return move_fn::impl(std::move(first), std::move(last),
-                             std::move(result), priority_tag<1>{});
+                             std::move(result), priority_tag<2>{});
     }
 
     template <typename Rng, typename O>
@@ -66,7 +81,7 @@ public:
     operator()(Rng&& rng, O result) const
     {
         return move_fn::impl(nano::begin(rng), nano::end(rng),
-                             std::move(result), priority_tag<1>{});
+                             std::move(result), priority_tag<2>{});
     }
 };
 
@@ -84,6 +99,14 @@ private:
     template <typename I, typename O>
     static constexpr move_backward_result<I, O> impl(I first, I last, O result)
     {
+        if constexpr (is_memmove_assignable<I, I, O, true>) {
+            if (!detail::is_constant_evaluated()) {
+                const auto dist = last - first;
+                return detail::memmove_backward(std::move(first), dist,
+                                                std::move(result));
+            }
+        }
+
         auto it = last;
 
         while (it != first) {
@@ -8,6 +8,8 @@
 #define NANORANGE_ALGORITHM_PARTITION_HPP_INCLUDED
 
 #include <nanorange/algorithm/find.hpp>
+#include <nanorange/detail/algorithm/parallel_partition.hpp>
+#include <nanorange/execution/policy.hpp>
 #include <nanorange/views/subrange.hpp>
 
 NANO_BEGIN_NAMESPACE
@@ -38,6 +40,23 @@ private:
         return {std::move(it), std::move(n)};
     }
 
+    // The parallel overloads partition blocks of the range concurrently,
+    // then swap the misplaced elements between them (see
+    // detail::parallel_partition())
+    template <typename EP, typename I, typename Pred, typename Proj>
+    static subrange<I> policy_impl(EP& policy, I first, iter_difference_t<I> n,
+                                   Pred& pred, Proj& proj)
+    {
+        if constexpr (parallel_execution_policy<EP>) {
+            return {detail::parallel_partition(
+                        first, n, pred, proj, policy.get_executor(),
+                        detail::parallel_partition_grain(policy)),
+                    first + n};
+        } else {
+            return partition_fn::impl(first, first + n, pred, proj);
+        }
+    }
+
 public:
     template <typename I, typename S, typename Pred, typename Proj = identity>
     constexpr std::enable_if_t<
@@ -59,6 +78,30 @@ public:
         return partition_fn::impl(nano::begin(rng), nano::end(rng),
                                   pred, proj);
     }
+
+    template <typename EP, typename I, typename S, typename Pred,
+              typename Proj = identity>
+    std::enable_if_t<
+        execution_policy<EP> && random_access_iterator<I> &&
+            sized_sentinel_for<S, I> &&
+            indirect_unary_predicate<Pred, projected<I, Proj>>, subrange<I>>
+    operator()(EP&& policy, I first, S last, Pred pred, Proj proj = Proj{}) const
+    {
+        const auto n = last - first;
+        return partition_fn::policy_impl(policy, std::move(first), n, pred,
+                                         proj);
+    }
+
+    template <typename EP, typename Rng, typename Pred, typename Proj = identity>
+    std::enable_if_t<
+        execution_policy<EP> && random_access_range<Rng> && sized_range<Rng> &&
+            indirect_unary_predicate<Pred, projected<iterator_t<Rng>, Proj>>,
+        borrowed_subrange_t<Rng>>
+    operator()(EP&& policy, Rng&& rng, Pred pred, Proj proj = Proj{}) const
+    {
+        return partition_fn::policy_impl(policy, nano::begin(rng),
+                                         nano::distance(rng), pred, proj);
+    }
 };
 
 }
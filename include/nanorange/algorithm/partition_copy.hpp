@@ -7,7 +7,9 @@
 #ifndef NANORANGE_ALGORITHM_PARTITION_COPY_HPP_INCLUDED
 #define NANORANGE_ALGORITHM_PARTITION_COPY_HPP_INCLUDED
 
+#include <nanorange/detail/algorithm/parallel_partition.hpp>
 #include <nanorange/detail/algorithm/result_types.hpp>
+#include <nanorange/execution/policy.hpp>
 #include <nanorange/ranges.hpp>
 
 NANO_BEGIN_NAMESPACE
@@ -39,6 +41,29 @@ private:
         return {std::move(first), std::move(out_true), std::move(out_false)};
     }
 
+    // The parallel overloads count the elements satisfying pred in each
+    // block of the input, and from those counts copy every block to its
+    // place in the outputs concurrently (see
+    // detail::parallel_partition_copy())
+    template <typename EP, typename I, typename O1, typename O2,
+              typename Pred, typename Proj>
+    static partition_copy_result<I, O1, O2>
+    policy_impl(EP& policy, I first, iter_difference_t<I> n, O1 out_true,
+                O2 out_false, Pred& pred, Proj& proj)
+    {
+        if constexpr (parallel_execution_policy<EP>) {
+            return detail::parallel_partition_copy(
+                std::move(first), n, std::move(out_true), std::move(out_false),
+                pred, proj, policy.get_executor(),
+                detail::parallel_partition_grain(policy));
+        } else {
+            const I last = first + n;
+            return partition_copy_fn::impl(std::move(first), last,
+                                           std::move(out_true),
+                                           std::move(out_false), pred, proj);
+        }
+    }
+
 public:
     template <typename I, typename S, typename O1, typename O2,
               typename Pred, typename Proj = identity>
@@ -74,6 +99,41 @@ public:
                                        std::move(out_true), std::move(out_false),
                                        pred, proj);
     }
+
+    template <typename EP, typename I, typename S, typename O1, typename O2,
+              typename Pred, typename Proj = identity>
+    std::enable_if_t<
+        execution_policy<EP> && random_access_iterator<I> &&
+            sized_sentinel_for<S, I> && random_access_iterator<O1> &&
+            random_access_iterator<O2> &&
+            indirect_unary_predicate<Pred, projected<I, Proj>> &&
+            indirectly_copyable<I, O1> && indirectly_copyable<I, O2>,
+        partition_copy_result<I, O1, O2>>
+    operator()(EP&& policy, I first, S last, O1 out_true, O2 out_false,
+               Pred pred, Proj proj = Proj{}) const
+    {
+        const auto n = last - first;
+        return partition_copy_fn::policy_impl(
+            policy, std::move(first), n, std::move(out_true),
+            std::move(out_false), pred, proj);
+    }
+
+    template <typename EP, typename Rng, typename O1, typename O2,
+              typename Pred, typename Proj = identity>
+    std::enable_if_t<
+        execution_policy<EP> && random_access_range<Rng> && sized_range<Rng> &&
+            random_access_iterator<O1> && random_access_iterator<O2> &&
+            indirect_unary_predicate<Pred, projected<iterator_t<Rng>, Proj>> &&
+            indirectly_copyable<iterator_t<Rng>, O1> &&
+            indirectly_copyable<iterator_t<Rng>, O2>,
+        partition_copy_result<borrowed_iterator_t<Rng>, O1, O2>>
+    operator()(EP&& policy, Rng&& rng, O1 out_true, O2 out_false, Pred pred,
+               Proj proj = Proj{}) const
+    {
+        return partition_copy_fn::policy_impl(
+            policy, nano::begin(rng), nano::distance(rng), std::move(out_true),
+            std::move(out_false), pred, proj);
+    }
 };
 
 }
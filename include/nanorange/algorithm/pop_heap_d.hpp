@@ -0,0 +1,82 @@
+// nanorange/algorithm/pop_heap_d.hpp
+//
+// Copyright (c) 2020 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_ALGORITHM_POP_HEAP_D_HPP_INCLUDED
+#define NANORANGE_ALGORITHM_POP_HEAP_D_HPP_INCLUDED
+
+#include <nanorange/detail/algorithm/heap_sift.hpp>
+#include <nanorange/ranges.hpp>
+
+NANO_BEGIN_NAMESPACE
+
+namespace detail {
+
+// Extension: pop_heap for a heap in which each element has D children
+template <std::size_t D>
+struct pop_heap_d_fn {
+private:
+    static_assert(D >= 2, "A d-ary heap must have arity of at least 2");
+
+    template <std::size_t>
+    friend struct sort_heap_d_fn;
+
+    template <typename I, typename Comp, typename Proj>
+    static constexpr I impl(I first, iter_difference_t<I> n, Comp& comp,
+                            Proj& proj)
+    {
+        if (n > 1) {
+            iter_value_t<I> top = nano::iter_move(first);
+            const auto hole =
+                detail::floyd_sift_down_d<D>(first, n, comp, proj);
+            I hole_i = first + hole;
+            I last = first + (n - 1);
+
+            if (hole_i == last) {
+                *hole_i = std::move(top);
+            } else {
+                *hole_i = nano::iter_move(last);
+                *last = std::move(top);
+                detail::sift_up_d<D>(first, hole + 1, comp, proj);
+            }
+        }
+
+        return first + n;
+    }
+
+public:
+    template <typename I, typename S, typename Comp = ranges::less,
+              typename Proj = identity>
+    constexpr std::enable_if_t<random_access_iterator<I> && sentinel_for<S, I> &&
+                                   sortable<I, Comp, Proj>, I>
+    operator()(I first, S last, Comp comp = Comp{}, Proj proj = Proj{}) const
+    {
+        const auto n = nano::distance(first, last);
+        return pop_heap_d_fn::impl(std::move(first), n, comp, proj);
+    }
+
+    template <typename Rng, typename Comp = ranges::less, typename Proj = identity>
+    constexpr std::enable_if_t<random_access_range<Rng> &&
+                                   sortable<iterator_t<Rng>, Comp, Proj>,
+                               borrowed_iterator_t<Rng>>
+    operator()(Rng&& rng, Comp comp = Comp{}, Proj proj = Proj{}) const
+    {
+        return pop_heap_d_fn::impl(nano::begin(rng), nano::distance(rng),
+                                   comp, proj);
+    }
+};
+
+} // namespace detail
+
+inline namespace function_objects {
+
+template <std::size_t D>
+inline constexpr detail::pop_heap_d_fn<D> pop_heap_d{};
+
+}
+
+NANO_END_NAMESPACE
+
+#endif
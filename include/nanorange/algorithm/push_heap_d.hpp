@@ -0,0 +1,64 @@
+// nanorange/algorithm/push_heap_d.hpp
+//
+// Copyright (c) 2020 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_ALGORITHM_PUSH_HEAP_D_HPP_INCLUDED
+#define NANORANGE_ALGORITHM_PUSH_HEAP_D_HPP_INCLUDED
+
+#include <nanorange/detail/algorithm/heap_sift.hpp>
+#include <nanorange/ranges.hpp>
+
+NANO_BEGIN_NAMESPACE
+
+namespace detail {
+
+// Extension: push_heap for a heap in which each element has D children
+template <std::size_t D>
+struct push_heap_d_fn {
+private:
+    static_assert(D >= 2, "A d-ary heap must have arity of at least 2");
+
+    template <typename I, typename Comp, typename Proj>
+    static constexpr I impl(I first, iter_difference_t<I> n, Comp& comp,
+                            Proj& proj)
+    {
+        detail::sift_up_d<D>(first, n, comp, proj);
+        return first + n;
+    }
+
+public:
+    template <typename I, typename S, typename Comp = ranges::less,
+              typename Proj = identity>
+    constexpr std::enable_if_t<random_access_iterator<I> && sentinel_for<S, I> &&
+                                   sortable<I, Comp, Proj>, I>
+    operator()(I first, S last, Comp comp = Comp{}, Proj proj = Proj{}) const
+    {
+        const auto n = nano::distance(first, last);
+        return push_heap_d_fn::impl(std::move(first), n, comp, proj);
+    }
+
+    template <typename Rng, typename Comp = ranges::less, typename Proj = identity>
+    constexpr std::enable_if_t<random_access_range<Rng> &&
+                                   sortable<iterator_t<Rng>, Comp, Proj>,
+                               borrowed_iterator_t<Rng>>
+    operator()(Rng&& rng, Comp comp = Comp{}, Proj proj = Proj{}) const
+    {
+        return push_heap_d_fn::impl(nano::begin(rng), nano::distance(rng),
+                                    comp, proj);
+    }
+};
+
+} // namespace detail
+
+inline namespace function_objects {
+
+template <std::size_t D>
+inline constexpr detail::push_heap_d_fn<D> push_heap_d{};
+
+}
+
+NANO_END_NAMESPACE
+
+#endif
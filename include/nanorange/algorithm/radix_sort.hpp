@@ -0,0 +1,249 @@
+// nanorange/algorithm/radix_sort.hpp
+//
+// Copyright (c) 2020 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_ALGORITHM_RADIX_SORT_HPP_INCLUDED
+#define NANORANGE_ALGORITHM_RADIX_SORT_HPP_INCLUDED
+
+#include <nanorange/algorithm/move.hpp>
+#include <nanorange/algorithm/stable_sort.hpp>
+#include <nanorange/detail/memory/temporary_vector.hpp>
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <limits>
+
+NANO_BEGIN_NAMESPACE
+
+namespace detail {
+
+// Maps an arithmetic key to an unsigned integer of the same size, such that
+// the unsigned integers sort in the same order as the keys.
+template <typename T, typename = void>
+struct radix_traits {};
+
+template <typename T>
+struct radix_traits<T, std::enable_if_t<std::is_integral<T>::value>> {
+    using key_type = std::make_unsigned_t<
+        detail::conditional_t<same_as<T, bool>, unsigned char, T>>;
+
+    static key_type to_key(T t)
+    {
+        auto k = static_cast<key_type>(t);
+        if constexpr (std::is_signed<T>::value) {
+            // Flip the sign bit so that negative values sort first
+            k ^= key_type(key_type(1) << (8 * sizeof(key_type) - 1));
+        }
+        return k;
+    }
+};
+
+template <typename T>
+struct radix_traits<T, std::enable_if_t<std::is_floating_point<T>::value &&
+                                        std::numeric_limits<T>::is_iec559 &&
+                                        (sizeof(T) == 4 || sizeof(T) == 8)>> {
+    using key_type =
+        detail::conditional_t<sizeof(T) == 4, std::uint32_t, std::uint64_t>;
+
+    static key_type to_key(T t)
+    {
+        // -0.0 and +0.0 compare equal, so they must map to the same key to
+        // keep the sort stable
+        if (t == T(0)) {
+            t = T(0);
+        }
+        key_type k;
+        std::memcpy(&k, &t, sizeof(T));
+        constexpr auto sign_bit = key_type(key_type(1) << (8 * sizeof(T) - 1));
+        // Negative values have their magnitude bits reversed as well as the
+        // sign bit flipped
+        return (k & sign_bit) ? key_type(~k) : key_type(k ^ sign_bit);
+    }
+};
+
+// Tells us which way the comparison orders radix keys, if it's one we know
+template <typename Comp, typename T>
+struct radix_direction {};
+
+template <typename T>
+struct radix_direction<nano::less, T> : std::false_type {};
+
+template <typename T>
+struct radix_direction<nano::greater, T> : std::true_type {};
+
+template <typename T>
+struct radix_direction<std::less<void>, T> : std::false_type {};
+
+template <typename T>
+struct radix_direction<std::greater<void>, T> : std::true_type {};
+
+template <typename T>
+struct radix_direction<std::less<T>, T> : std::false_type {};
+
+template <typename T>
+struct radix_direction<std::greater<T>, T> : std::true_type {};
+
+template <typename T>
+using radix_key_t = typename radix_traits<T>::key_type;
+
+template <typename Comp, typename T>
+using radix_direction_t = typename radix_direction<Comp, T>::type;
+
+template <typename Comp, typename T>
+inline constexpr bool radix_descending_v = radix_direction<Comp, T>::value;
+
+template <typename I, typename Comp, typename Proj,
+          typename Key = iter_value_t<projected<I, Proj>>>
+NANO_CONCEPT radix_sortable =
+    sortable<I, Comp, Proj> && exists_v<radix_key_t, Key> &&
+    exists_v<radix_direction_t, remove_cvref_t<Comp>, Key>;
+
+struct radix_sort_fn {
+private:
+    // Below this size we just use an insertion sort
+    static constexpr std::ptrdiff_t small_sort_threshold = 64;
+
+    static constexpr int radix_bits = 8;
+    static constexpr std::size_t radix_size = 1u << radix_bits;
+
+    template <bool Descending, typename T>
+    static radix_key_t<T> get_key(const T& t)
+    {
+        const auto k = radix_traits<T>::to_key(t);
+        return Descending ? radix_key_t<T>(~k) : k;
+    }
+
+    // Stable-partitions [first, last) into out by the given byte of the key
+    template <bool Descending, typename I, typename O, typename Proj>
+    static void scatter(I first, I last, O out, std::size_t* offsets,
+                        int shift, Proj& proj)
+    {
+        for (; first != last; ++first) {
+            const auto bucket =
+                (get_key<Descending>(nano::invoke(proj, *first)) >> shift) &
+                (radix_size - 1);
+            *(out + static_cast<iter_difference_t<O>>(offsets[bucket]++)) =
+                nano::iter_move(first);
+        }
+    }
+
+    template <bool Descending, typename I, typename Comp, typename Proj>
+    static void impl(I first, I last, Comp& comp, Proj& proj)
+    {
+        using key_t = radix_key_t<iter_value_t<projected<I, Proj>>>;
+        constexpr int num_passes = sizeof(key_t);
+
+        const auto len = last - first;
+
+        if (len < small_sort_threshold) {
+            detail::insertion_sort(std::move(first), std::move(last), comp, proj);
+            return;
+        }
+
+        // Count the occurrences of every byte value in every position with a
+        // single read of the input
+        std::array<std::array<std::size_t, radix_size>, num_passes> counts{};
+        for (I it = first; it != last; ++it) {
+            const auto key = get_key<Descending>(nano::invoke(proj, *it));
+            for (int p = 0; p < num_passes; p++) {
+                ++counts[p][(key >> (p * radix_bits)) & (radix_size - 1)];
+            }
+        }
+
+        // A pass in which every element falls into the same bucket would not
+        // move anything, so we can skip it
+        std::array<int, num_passes> passes{};
+        int num_active = 0;
+        for (int p = 0; p < num_passes; p++) {
+            const auto key = get_key<Descending>(nano::invoke(proj, *first));
+            const auto bucket = (key >> (p * radix_bits)) & (radix_size - 1);
+            if (counts[p][bucket] != static_cast<std::size_t>(len)) {
+                passes[num_active++] = p;
+            }
+        }
+
+        if (num_active == 0) {
+            return;
+        }
+
+        temporary_vector<iter_value_t<I>> buf(static_cast<std::size_t>(len));
+        if (buf.capacity() < static_cast<std::size_t>(len)) {
+            stable_sort_fn{}(std::move(first), std::move(last), std::ref(comp),
+                             std::ref(proj));
+            return;
+        }
+
+        // The elements are moved into the buffer first, so that every pass
+        // can move-assign to a live object, and then ping-pong between the
+        // buffer and the input range
+        for (I it = first; it != last; ++it) {
+            buf.push_back(nano::iter_move(it));
+        }
+
+        bool in_buf = true;
+        for (int i = 0; i < num_active; i++) {
+            const int p = passes[i];
+            std::array<std::size_t, radix_size> offsets;
+            std::size_t sum = 0;
+            for (std::size_t b = 0; b < radix_size; b++) {
+                offsets[b] = sum;
+                sum += counts[p][b];
+            }
+
+            if (in_buf) {
+                scatter<Descending>(buf.begin(), buf.end(), first,
+                                    offsets.data(), p * radix_bits, proj);
+            } else {
+                scatter<Descending>(first, last, buf.begin(), offsets.data(),
+                                    p * radix_bits, proj);
+            }
+            in_buf = !in_buf;
+        }
+
+        if (in_buf) {
+            nano::move(buf.begin(), buf.end(), std::move(first));
+        }
+    }
+
+public:
+    template <typename I, typename S, typename Comp = ranges::less,
+              typename Proj = identity>
+    std::enable_if_t<random_access_iterator<I> && sentinel_for<S, I> &&
+                         radix_sortable<I, Comp, Proj>, I>
+    operator()(I first, S last, Comp comp = Comp{}, Proj proj = Proj{}) const
+    {
+        I last_it = nano::next(first, last);
+        radix_sort_fn::impl<radix_descending_v<Comp, iter_value_t<projected<I, Proj>>>>(
+            std::move(first), last_it, comp, proj);
+        return last_it;
+    }
+
+    template <typename Rng, typename Comp = ranges::less,
+              typename Proj = identity>
+    std::enable_if_t<random_access_range<Rng> &&
+                         radix_sortable<iterator_t<Rng>, Comp, Proj>,
+                     borrowed_iterator_t<Rng>>
+    operator()(Rng&& rng, Comp comp = Comp{}, Proj proj = Proj{}) const
+    {
+        iterator_t<Rng> last_it = nano::next(nano::begin(rng), nano::end(rng));
+        radix_sort_fn::impl<radix_descending_v<
+            Comp, iter_value_t<projected<iterator_t<Rng>, Proj>>>>(
+            nano::begin(rng), last_it, comp, proj);
+        return last_it;
+    }
+};
+
+} // namespace detail
+
+// Stably sorts a random-access range whose projected elements are of
+// arithmetic type, using an LSD radix sort with one pass per byte of the key.
+// Only the standard less and greater comparisons are supported.
+NANO_INLINE_VAR(detail::radix_sort_fn, radix_sort)
+
+NANO_END_NAMESPACE
+
+#endif
@@ -7,6 +7,7 @@
 #ifndef NANORANGE_ALGORITHM_SEARCH_HPP_INCLUDED
 #define NANORANGE_ALGORITHM_SEARCH_HPP_INCLUDED
 
+#include <nanorange/algorithm/searchers.hpp>
 #include <nanorange/ranges.hpp>
 #include <nanorange/views/subrange.hpp>
 
@@ -24,26 +25,42 @@ private:
     impl(I1 first1, S1 last1, I2 first2, S2 last2, Pred& pred, Proj1& proj1,
          Proj2& proj2)
     {
-        while (true) {
-            auto it1 = first1;
-            auto it2 = first2;
-
-            while (true) {
-                if (it2 == last2) {
-                    return {first1, it1};
-                }
-                if (it1 == last1) {
-                    return {it1, it1};
-                }
-                if (!nano::invoke(pred, nano::invoke(proj1, *it1), nano::invoke(proj2, *it2))) {
-                    break;
-                }
-                ++it1; ++it2;
-            }
+        return detail::search_naive(std::move(first1), std::move(last1),
+                                    std::move(first2), std::move(last2),
+                                    pred, proj1, proj2);
+    }
 
+    // Haystacks shorter than this are searched naively, as building a
+    // searcher's tables would cost more than it saves
+    static constexpr std::ptrdiff_t searcher_threshold = 64;
 
-            ++first1;
+    // Random-access ranges compared with == and without projections are
+    // searched with default_searcher, which picks an algorithm that can skip
+    // ahead on a mismatch
+    template <typename I1, typename S1, typename I2, typename S2,
+              typename Pred, typename Proj1, typename Proj2>
+    static constexpr subrange<I1>
+    select_impl(I1 first1, S1 last1, I2 first2, S2 last2, Pred& pred,
+                Proj1& proj1, Proj2& proj2)
+    {
+        if constexpr (random_access_iterator<I1> &&
+                      sized_sentinel_for<S1, I1> &&
+                      random_access_iterator<I2> &&
+                      sized_sentinel_for<S2, I2> &&
+                      same_as<Pred, ranges::equal_to> &&
+                      same_as<Proj1, identity> && same_as<Proj2, identity>) {
+            if (!detail::is_constant_evaluated() &&
+                last1 - first1 >= searcher_threshold) {
+                const auto m = last2 - first2;
+                const default_searcher<subrange<I2>> searcher{
+                    subrange<I2>{first2, first2 + m}};
+                return searcher(std::move(first1), std::move(last1));
+            }
         }
+
+        return search_fn::impl(std::move(first1), std::move(last1),
+                               std::move(first2), std::move(last2),
+                               pred, proj1, proj2);
     }
 
 public:
@@ -58,9 +75,9 @@ public:
     operator()(I1 first1, S1 last1, I2 first2, S2 last2,
                Pred pred = Pred{}, Proj1 proj1 = Proj1{}, Proj2 proj2 = Proj2{}) const
     {
-        return search_fn::impl(std::move(first1), std::move(last1),
-                               std::move(first2), std::move(last2),
-                               pred, proj1, proj2);
+        return search_fn::select_impl(std::move(first1), std::move(last1),
+                                      std::move(first2), std::move(last2),
+                                      pred, proj1, proj2);
     }
 
     template <typename Rng1, typename Rng2, typename Pred = ranges::equal_to,
@@ -72,9 +89,31 @@ public:
     operator()(Rng1&& rng1, Rng2&& rng2, Pred pred = Pred{},
                Proj1 proj1 = Proj1{}, Proj2 proj2 = Proj2{}) const
     {
-        return search_fn::impl(nano::begin(rng1), nano::end(rng1),
-                               nano::begin(rng2), nano::end(rng2),
-                               pred, proj1, proj2);
+        return search_fn::select_impl(nano::begin(rng1), nano::end(rng1),
+                                      nano::begin(rng2), nano::end(rng2),
+                                      pred, proj1, proj2);
+    }
+
+    // Extension: search using a searcher object
+    template <typename I, typename S, typename Searcher>
+    constexpr std::enable_if_t<
+        forward_iterator<I> && sentinel_for<S, I> &&
+            detail::is_searcher<Searcher> &&
+            invocable<const Searcher&, I, S>,
+        subrange<I>>
+    operator()(I first, S last, const Searcher& searcher) const
+    {
+        return searcher(std::move(first), std::move(last));
+    }
+
+    template <typename Rng, typename Searcher>
+    constexpr std::enable_if_t<
+        forward_range<Rng> && detail::is_searcher<Searcher> &&
+            invocable<const Searcher&, iterator_t<Rng>, sentinel_t<Rng>>,
+        borrowed_subrange_t<Rng>>
+    operator()(Rng&& rng, const Searcher& searcher) const
+    {
+        return searcher(nano::begin(rng), nano::end(rng));
     }
 };
 
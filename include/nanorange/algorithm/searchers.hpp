@@ -0,0 +1,533 @@
+// nanorange/algorithm/searchers.hpp
+//
+// Copyright (c) 2020 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_ALGORITHM_SEARCHERS_HPP_INCLUDED
+#define NANORANGE_ALGORITHM_SEARCHERS_HPP_INCLUDED
+
+#include <nanorange/algorithm/equal.hpp>
+#include <nanorange/algorithm/find.hpp>
+#include <nanorange/views/all.hpp>
+#include <nanorange/views/subrange.hpp>
+
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <unordered_map>
+#include <utility>
+
+NANO_BEGIN_NAMESPACE
+
+// Searchers are function objects which hold a pattern, and which can be
+// called with a haystack iterator and sentinel to find the first occurrence
+// of that pattern, returning it as a subrange (or an empty subrange at the
+// end of the haystack if there is none). They can be passed to
+// nano::search and views::split.
+
+namespace detail {
+
+template <typename I1, typename S1, typename I2, typename S2,
+          typename Pred, typename Proj1, typename Proj2>
+constexpr subrange<I1> search_naive(I1 first1, S1 last1, I2 first2, S2 last2,
+                                    Pred& pred, Proj1& proj1, Proj2& proj2)
+{
+    while (true) {
+        auto it1 = first1;
+        auto it2 = first2;
+
+        while (true) {
+            if (it2 == last2) {
+                return {first1, it1};
+            }
+            if (it1 == last1) {
+                return {it1, it1};
+            }
+            if (!nano::invoke(pred, nano::invoke(proj1, *it1), nano::invoke(proj2, *it2))) {
+                break;
+            }
+            ++it1; ++it2;
+        }
+
+
+        ++first1;
+    }
+}
+
+// Types small enough that a Boyer-Moore-Horspool skip table can be indexed
+// directly by value, rather than needing a hash map
+template <typename T>
+inline constexpr bool is_byte_like =
+    (std::is_integral<T>::value && sizeof(T) == 1) || same_as<T, std::byte>;
+
+template <typename T, typename = void>
+inline constexpr bool is_searcher = false;
+
+template <typename T>
+inline constexpr bool is_searcher<T, std::void_t<typename T::pattern_type>> =
+    true;
+
+} // namespace detail
+
+// Tries every position in turn. Works with forward ranges and any
+// predicate, but takes O(N*M) time in the worst case.
+template <typename P, typename Pred = ranges::equal_to>
+struct naive_searcher {
+private:
+    static_assert(forward_range<const P>);
+    static_assert(view<P>);
+
+    P pattern_ = P();
+    Pred pred_ = Pred{};
+
+public:
+    using pattern_type = P;
+
+    naive_searcher() = default;
+
+    template <typename R,
+              std::enable_if_t<viewable_range<R> &&
+                               constructible_from<P, all_view<R>>, int> = 0>
+    constexpr explicit naive_searcher(R&& pattern, Pred pred = Pred{})
+        : pattern_(views::all(std::forward<R>(pattern))),
+          pred_(std::move(pred))
+    {}
+
+    constexpr const P& pattern() const { return pattern_; }
+
+    template <typename I, typename S>
+    constexpr std::enable_if_t<
+        forward_iterator<I> && sentinel_for<S, I> &&
+            indirectly_comparable<I, iterator_t<const P>, const Pred&>,
+        subrange<I>>
+    operator()(I first, S last) const
+    {
+        identity id{};
+        return detail::search_naive(std::move(first), std::move(last),
+                                    nano::begin(pattern_), nano::end(pattern_),
+                                    pred_, id, id);
+    }
+};
+
+template <typename R>
+naive_searcher(R&&) -> naive_searcher<all_view<R>>;
+
+template <typename R, typename Pred>
+naive_searcher(R&&, Pred) -> naive_searcher<all_view<R>, Pred>;
+
+// Boyer-Moore-Horspool: compares the last element of the window first, and
+// on a mismatch skips ahead according to where that element last appears in
+// the pattern. Byte-sized patterns compared with == use a 256-entry table;
+// other patterns use an unordered_map with the given Hash and Pred.
+// Requires random-access ranges of the same value type, and takes O(N/M) time
+// on typical inputs, but O(N*M) in the worst case.
+template <typename P, typename Hash = std::hash<range_value_t<P>>,
+          typename Pred = ranges::equal_to>
+struct boyer_moore_horspool_searcher {
+private:
+    static_assert(random_access_range<const P> && sized_range<const P>);
+    static_assert(view<P>);
+
+    using value_type = range_value_t<const P>;
+    using difference_type = range_difference_t<const P>;
+
+    static constexpr bool use_byte_table =
+        detail::is_byte_like<value_type> && same_as<Pred, ranges::equal_to>;
+
+    // Byte table entries are capped at 255 so that the table stays small
+    // enough to copy around with views::split. A smaller skip is always safe.
+    using table_type = detail::conditional_t<
+        use_byte_table, std::array<unsigned char, 256>,
+        std::unordered_map<value_type, difference_type, Hash, Pred>>;
+
+    P pattern_ = P();
+    Pred pred_ = Pred{};
+    table_type table_{};
+
+    template <typename T>
+    constexpr difference_type skip(const T& val, difference_type m) const
+    {
+        if constexpr (use_byte_table) {
+            return table_[static_cast<unsigned char>(val)];
+        } else {
+            const auto it = table_.find(val);
+            return it == table_.end() ? m : it->second;
+        }
+    }
+
+public:
+    using pattern_type = P;
+
+    boyer_moore_horspool_searcher() = default;
+
+    template <typename R,
+              std::enable_if_t<viewable_range<R> &&
+                               constructible_from<P, all_view<R>>, int> = 0>
+    constexpr explicit boyer_moore_horspool_searcher(R&& pattern,
+                                                     Hash hf = Hash{},
+                                                     Pred pred = Pred{})
+        : pattern_(views::all(std::forward<R>(pattern))),
+          pred_(std::move(pred)),
+          table_(make_table(pattern_, std::move(hf), pred_))
+    {}
+
+    constexpr const P& pattern() const { return pattern_; }
+
+    template <typename I, typename S>
+    constexpr std::enable_if_t<
+        random_access_iterator<I> && sized_sentinel_for<S, I> &&
+            same_as<iter_value_t<I>, value_type> &&
+            indirectly_comparable<I, iterator_t<const P>, const Pred&>,
+        subrange<I>>
+    operator()(I first, S last) const
+    {
+        using D = iter_difference_t<I>;
+        const D n = last - first;
+        const D m = static_cast<D>(nano::distance(pattern_));
+        I end = first + n;
+
+        if (m == 0) {
+            return {first, first};
+        }
+        if (m > n) {
+            return {end, end};
+        }
+
+        const auto pfirst = nano::begin(pattern_);
+
+        // A single element is better found with find, which is vectorised
+        // for contiguous ranges
+        if constexpr (same_as<Pred, ranges::equal_to>) {
+            if (m == 1) {
+                I it = nano::find(first, end, *pfirst);
+                return {it, it == end ? it : it + 1};
+            }
+        }
+
+        const auto& plast = pfirst[static_cast<difference_type>(m - 1)];
+
+        D j = 0;
+        while (j <= n - m) {
+            const auto& c = first[j + m - 1];
+            if (nano::invoke(pred_, c, plast) &&
+                nano::equal(first + j, first + (j + m - 1),
+                            pfirst, pfirst + static_cast<difference_type>(m - 1),
+                            pred_)) {
+                return {first + j, first + (j + m)};
+            }
+            j += static_cast<D>(skip(c, static_cast<difference_type>(m)));
+        }
+
+        return {end, end};
+    }
+
+private:
+    static constexpr table_type make_table(const P& pattern, Hash hf,
+                                           const Pred& pred)
+    {
+        const difference_type m = nano::distance(pattern);
+        const auto pfirst = nano::begin(pattern);
+
+        if constexpr (use_byte_table) {
+            (void) hf;
+            (void) pred;
+            table_type table{};
+            const auto def = static_cast<unsigned char>(m < 255 ? m : 255);
+            for (std::size_t i = 0; i < table.size(); ++i) {
+                table[i] = def;
+            }
+            for (difference_type i = 0; i < m - 1; ++i) {
+                const difference_type s = m - 1 - i;
+                table[static_cast<unsigned char>(pfirst[i])] =
+                    static_cast<unsigned char>(s < 255 ? s : 255);
+            }
+            return table;
+        } else {
+            table_type table(0, std::move(hf), pred);
+            for (difference_type i = 0; i < m - 1; ++i) {
+                table[pfirst[i]] = m - 1 - i;
+            }
+            return table;
+        }
+    }
+};
+
+template <typename R>
+boyer_moore_horspool_searcher(R&&)
+    -> boyer_moore_horspool_searcher<all_view<R>>;
+
+template <typename R, typename Hash>
+boyer_moore_horspool_searcher(R&&, Hash)
+    -> boyer_moore_horspool_searcher<all_view<R>, Hash>;
+
+template <typename R, typename Hash, typename Pred>
+boyer_moore_horspool_searcher(R&&, Hash, Pred)
+    -> boyer_moore_horspool_searcher<all_view<R>, Hash, Pred>;
+
+// Two-way string matching (Crochemore and Perrin, 1991). The pattern is split
+// at a critical factorisation; the right half is matched forwards and the
+// left half backwards, which together with knowledge of the pattern's period
+// gives O(N + M) time and O(1) extra space in all cases. Requires the
+// pattern's value type to be totally ordered, and random-access ranges.
+template <typename P>
+struct two_way_searcher {
+private:
+    static_assert(random_access_range<const P> && sized_range<const P>);
+    static_assert(view<P>);
+    static_assert(totally_ordered<range_value_t<const P>>);
+
+    using difference_type = range_difference_t<const P>;
+
+    P pattern_ = P();
+    difference_type suffix_ = 0;
+    difference_type period_ = 1;
+    bool periodic_ = false;
+
+    // Computes the maximal suffix of the pattern under the ordering given by
+    // comp, returning its starting position minus one and its period
+    template <typename Comp>
+    static constexpr std::pair<difference_type, difference_type>
+    maximal_suffix(const P& pattern, Comp comp)
+    {
+        const difference_type m = nano::distance(pattern);
+        const auto p = nano::begin(pattern);
+
+        difference_type ms = -1;
+        difference_type j = 0;
+        difference_type k = 1;
+        difference_type per = 1;
+
+        while (j + k < m) {
+            const auto& a = p[j + k];
+            const auto& b = p[ms + k];
+            if (comp(a, b)) {
+                j += k;
+                k = 1;
+                per = j - ms;
+            } else if (a == b) {
+                if (k != per) {
+                    ++k;
+                } else {
+                    j += per;
+                    k = 1;
+                }
+            } else {
+                ms = j++;
+                k = per = 1;
+            }
+        }
+
+        return {ms, per};
+    }
+
+    constexpr void factorise()
+    {
+        const difference_type m = nano::distance(pattern_);
+        if (m == 0) {
+            return;
+        }
+
+        const auto [ms1, p1] = maximal_suffix(pattern_, ranges::less{});
+        const auto [ms2, p2] = maximal_suffix(pattern_, ranges::greater{});
+
+        // Choose the longer of the two suffixes
+        if (ms1 > ms2) {
+            suffix_ = ms1 + 1;
+            period_ = p1;
+        } else {
+            suffix_ = ms2 + 1;
+            period_ = p2;
+        }
+
+        // The period of the maximal suffix is the period of the whole pattern
+        // exactly when the part to the left of the split also repeats with it
+        const auto p = nano::begin(pattern_);
+        periodic_ = nano::equal(p, p + suffix_, p + period_,
+                                p + (period_ + suffix_));
+        if (!periodic_) {
+            period_ = (suffix_ > m - suffix_ ? suffix_ : m - suffix_) + 1;
+        }
+    }
+
+public:
+    using pattern_type = P;
+
+    two_way_searcher() = default;
+
+    template <typename R,
+              std::enable_if_t<viewable_range<R> &&
+                               constructible_from<P, all_view<R>>, int> = 0>
+    constexpr explicit two_way_searcher(R&& pattern)
+        : pattern_(views::all(std::forward<R>(pattern)))
+    {
+        factorise();
+    }
+
+    constexpr const P& pattern() const { return pattern_; }
+
+    template <typename I, typename S>
+    constexpr std::enable_if_t<
+        random_access_iterator<I> && sized_sentinel_for<S, I> &&
+            indirectly_comparable<I, iterator_t<const P>, ranges::equal_to>,
+        subrange<I>>
+    operator()(I first, S last) const
+    {
+        using D = iter_difference_t<I>;
+        const D n = last - first;
+        const D m = static_cast<D>(nano::distance(pattern_));
+        I end = first + n;
+
+        if (m == 0) {
+            return {first, first};
+        }
+        if (m > n) {
+            return {end, end};
+        }
+
+        const auto p = nano::begin(pattern_);
+        const auto pat = [&p](D i) -> decltype(auto) {
+            return p[static_cast<difference_type>(i)];
+        };
+        const D suffix = suffix_;
+        const D period = period_;
+
+        D j = 0;
+        if (periodic_) {
+            // Elements before memory are known to match from the last
+            // attempt, as we shifted by exactly one period
+            D memory = 0;
+            while (j <= n - m) {
+                D i = suffix > memory ? suffix : memory;
+                while (i < m && pat(i) == first[i + j]) {
+                    ++i;
+                }
+                if (i >= m) {
+                    i = suffix - 1;
+                    while (i >= memory && pat(i) == first[i + j]) {
+                        --i;
+                    }
+                    if (i < memory) {
+                        return {first + j, first + (j + m)};
+                    }
+                    j += period;
+                    memory = m - period;
+                } else {
+                    j += i - suffix + 1;
+                    memory = 0;
+                }
+            }
+        } else {
+            while (j <= n - m) {
+                D i = suffix;
+                while (i < m && pat(i) == first[i + j]) {
+                    ++i;
+                }
+                if (i >= m) {
+                    i = suffix - 1;
+                    while (i >= 0 && pat(i) == first[i + j]) {
+                        --i;
+                    }
+                    if (i < 0) {
+                        return {first + j, first + (j + m)};
+                    }
+                    j += period;
+                } else {
+                    j += i - suffix + 1;
+                }
+            }
+        }
+
+        return {end, end};
+    }
+};
+
+template <typename R>
+two_way_searcher(R&&) -> two_way_searcher<all_view<R>>;
+
+namespace detail {
+
+template <typename P, typename Pred, typename = void>
+struct default_searcher_impl {
+    using type = naive_searcher<P, Pred>;
+};
+
+template <typename P>
+struct default_searcher_impl<
+    P, ranges::equal_to,
+    std::enable_if_t<random_access_range<const P> && sized_range<const P>>> {
+    using type = detail::conditional_t<
+        is_byte_like<range_value_t<const P>>,
+        boyer_moore_horspool_searcher<P>,
+        detail::conditional_t<totally_ordered<range_value_t<const P>>,
+                              two_way_searcher<P>, naive_searcher<P>>>;
+};
+
+} // namespace detail
+
+// Picks a searcher based on the pattern type: Boyer-Moore-Horspool for
+// byte-sized elements, two-way for other totally ordered elements, and the
+// naive searcher otherwise or when a custom predicate is used. Haystacks
+// which the chosen searcher cannot handle (that is, those which are not
+// random-access and sized) fall back to the naive algorithm.
+template <typename P, typename Pred = ranges::equal_to>
+struct default_searcher {
+private:
+    using impl_type = typename detail::default_searcher_impl<P, Pred>::type;
+
+    impl_type impl_ = impl_type();
+
+public:
+    using pattern_type = P;
+
+    default_searcher() = default;
+
+    template <typename R,
+              std::enable_if_t<viewable_range<R> &&
+                               constructible_from<P, all_view<R>>, int> = 0>
+    constexpr explicit default_searcher(R&& pattern, Pred pred = Pred{})
+        : impl_(make_impl(std::forward<R>(pattern), std::move(pred)))
+    {}
+
+    constexpr const P& pattern() const { return impl_.pattern(); }
+
+    template <typename I, typename S>
+    constexpr std::enable_if_t<
+        forward_iterator<I> && sentinel_for<S, I> &&
+            indirectly_comparable<I, iterator_t<const P>, const Pred&>,
+        subrange<I>>
+    operator()(I first, S last) const
+    {
+        if constexpr (invocable<const impl_type&, I, S>) {
+            return impl_(std::move(first), std::move(last));
+        } else {
+            // The specialised searchers are only chosen for ranges::equal_to
+            ranges::equal_to pred{};
+            identity id{};
+            return detail::search_naive(std::move(first), std::move(last),
+                                        nano::begin(pattern()),
+                                        nano::end(pattern()), pred, id, id);
+        }
+    }
+
+private:
+    template <typename R>
+    static constexpr impl_type make_impl(R&& pattern, Pred pred)
+    {
+        if constexpr (same_as<impl_type, naive_searcher<P, Pred>>) {
+            return impl_type(std::forward<R>(pattern), std::move(pred));
+        } else {
+            return impl_type(std::forward<R>(pattern));
+        }
+    }
+};
+
+template <typename R>
+default_searcher(R&&) -> default_searcher<all_view<R>>;
+
+template <typename R, typename Pred>
+default_searcher(R&&, Pred) -> default_searcher<all_view<R>, Pred>;
+
+NANO_END_NAMESPACE
+
+#endif
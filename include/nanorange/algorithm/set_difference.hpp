@@ -10,6 +10,7 @@
 #include <nanorange/ranges.hpp>
 
 #include <nanorange/algorithm/copy.hpp>
+#include <nanorange/detail/algorithm/gallop.hpp>
 #include <nanorange/detail/algorithm/result_types.hpp>
 
 NANO_BEGIN_NAMESPACE
@@ -21,12 +22,76 @@ namespace detail {
 
 struct set_difference_fn {
 private:
+    // Looks up each element of the smaller range in the larger one, copying
+    // the runs of the first range which lie between matches
+    template <typename I1, typename I2, typename O, typename Comp,
+              typename Proj1, typename Proj2>
+    static constexpr set_difference_result<I1, O>
+    gallop_impl(I1 first1, iter_difference_t<I1> n1, I2 first2,
+                iter_difference_t<I2> n2, O result, Comp& comp, Proj1& proj1,
+                Proj2& proj2)
+    {
+        const auto pred1 = [&](auto&& elem) {
+            return nano::invoke(comp, std::forward<decltype(elem)>(elem),
+                                nano::invoke(proj2, *first2));
+        };
+        const auto pred2 = [&](auto&& elem) {
+            return nano::invoke(comp, std::forward<decltype(elem)>(elem),
+                                nano::invoke(proj1, *first1));
+        };
+
+        if (n1 <= n2) {
+            for (; n1 > 0; ++first1, --n1) {
+                const I2 pos =
+                    detail::gallop_partition_point(first2, n2, pred2, proj2);
+                n2 -= pos - first2;
+                first2 = pos;
+                if (n2 > 0 &&
+                    !nano::invoke(comp, nano::invoke(proj1, *first1),
+                                  nano::invoke(proj2, *first2))) {
+                    ++first2;
+                    --n2;
+                } else {
+                    *result = *first1;
+                    ++result;
+                }
+            }
+            return {std::move(first1), std::move(result)};
+        }
+
+        for (; n2 > 0 && n1 > 0; ++first2, --n2) {
+            const I1 pos =
+                detail::gallop_partition_point(first1, n1, pred1, proj1);
+            n1 -= pos - first1;
+            result = nano::copy(std::move(first1), pos, std::move(result)).out;
+            first1 = pos;
+            if (n1 > 0 && !nano::invoke(comp, nano::invoke(proj2, *first2),
+                                        nano::invoke(proj1, *first1))) {
+                ++first1;
+                --n1;
+            }
+        }
+
+        return nano::copy_n(std::move(first1), n1, std::move(result));
+    }
+
     template <typename I1, typename S1, typename I2, typename S2, typename O,
               typename Comp, typename Proj1, typename Proj2>
     static constexpr set_difference_result<I1, O>
     impl(I1 first1, S1 last1, I2 first2, S2 last2, O result,
          Comp& comp, Proj1& proj1, Proj2& proj2)
     {
+        if constexpr (random_access_iterator<I1> && sized_sentinel_for<S1, I1> &&
+                      random_access_iterator<I2> && sized_sentinel_for<S2, I2>) {
+            const auto n1 = last1 - first1;
+            const auto n2 = last2 - first2;
+            if (detail::gallop_worthwhile(n1, n2)) {
+                return set_difference_fn::gallop_impl(
+                    std::move(first1), n1, std::move(first2), n2,
+                    std::move(result), comp, proj1, proj2);
+            }
+        }
+
         while (first1 != last1) {
             if (first2 == last2) {
                 // We've reached the end of range2, so copy all the remaining
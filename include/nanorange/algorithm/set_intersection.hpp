@@ -7,19 +7,100 @@
 #ifndef NANORANGE_ALGORITHM_SET_INTERSECTION_HPP_INCLUDED
 #define NANORANGE_ALGORITHM_SET_INTERSECTION_HPP_INCLUDED
 
+#include <nanorange/detail/algorithm/gallop.hpp>
+#include <nanorange/detail/algorithm/simd_set.hpp>
 #include <nanorange/ranges.hpp>
 
 NANO_BEGIN_NAMESPACE
 
 namespace detail {
 
+// When one input is much longer than the other, each element of the shorter
+// is looked up in the longer by galloping (see
+// detail::gallop_partition_point()). Otherwise, sorted contiguous ranges of
+// integers are intersected a vector at a time (see
+// detail::simd_set_intersection()) before finishing with the usual merge.
 struct set_intersection_fn {
 private:
+    // Looks up each element of the smaller range in the larger one, starting
+    // from just after the previous match
+    template <typename I1, typename I2, typename O, typename Comp,
+              typename Proj1, typename Proj2>
+    static constexpr O gallop_impl(I1 first1, iter_difference_t<I1> n1,
+                                   I2 first2, iter_difference_t<I2> n2,
+                                   O result, Comp& comp, Proj1& proj1,
+                                   Proj2& proj2)
+    {
+        if (n1 <= n2) {
+            const auto pred = [&](auto&& elem) {
+                return nano::invoke(comp, std::forward<decltype(elem)>(elem),
+                                    nano::invoke(proj1, *first1));
+            };
+            for (; n1 > 0 && n2 > 0; ++first1, --n1) {
+                const I2 pos =
+                    detail::gallop_partition_point(first2, n2, pred, proj2);
+                n2 -= pos - first2;
+                first2 = pos;
+                if (n2 > 0 &&
+                    !nano::invoke(comp, nano::invoke(proj1, *first1),
+                                  nano::invoke(proj2, *first2))) {
+                    *result = *first1;
+                    ++result;
+                    ++first2;
+                    --n2;
+                }
+            }
+        } else {
+            const auto pred = [&](auto&& elem) {
+                return nano::invoke(comp, std::forward<decltype(elem)>(elem),
+                                    nano::invoke(proj2, *first2));
+            };
+            for (; n1 > 0 && n2 > 0; ++first2, --n2) {
+                const I1 pos =
+                    detail::gallop_partition_point(first1, n1, pred, proj1);
+                n1 -= pos - first1;
+                first1 = pos;
+                if (n1 > 0 &&
+                    !nano::invoke(comp, nano::invoke(proj2, *first2),
+                                  nano::invoke(proj1, *first1))) {
+                    *result = *first1;
+                    ++result;
+                    ++first1;
+                    --n1;
+                }
+            }
+        }
+
+        return result;
+    }
+
     template <typename I1, typename S1, typename I2, typename S2, typename O,
               typename Comp, typename Proj1, typename Proj2>
     static constexpr O impl(I1 first1, S1 last1, I2 first2, S2 last2,
                             O result, Comp& comp, Proj1& proj1, Proj2& proj2)
     {
+        if constexpr (random_access_iterator<I1> && sized_sentinel_for<S1, I1> &&
+                      random_access_iterator<I2> && sized_sentinel_for<S2, I2>) {
+            const auto n1 = last1 - first1;
+            const auto n2 = last2 - first2;
+            if (detail::gallop_worthwhile(n1, n2)) {
+                return set_intersection_fn::gallop_impl(
+                    std::move(first1), n1, std::move(first2), n2,
+                    std::move(result), comp, proj1, proj2);
+            }
+
+            if constexpr (simd_set_intersectable<I1, I2, Comp, Proj1, Proj2>) {
+                if (!detail::is_constant_evaluated()) {
+                    auto res = detail::simd_set_intersection(
+                        std::move(first1), n1, std::move(first2), n2,
+                        std::move(result));
+                    first1 = std::move(res.in1);
+                    first2 = std::move(res.in2);
+                    result = std::move(res.out);
+                }
+            }
+        }
+
         while (first1 != last1 && first2 != last2)
         {
             if (nano::invoke(comp, nano::invoke(proj1, *first1),
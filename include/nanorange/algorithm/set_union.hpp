@@ -8,6 +8,7 @@
 #define NANORANGE_ALGORITHM_SET_UNION_HPP_INCLUDED
 
 #include <nanorange/algorithm/copy.hpp>
+#include <nanorange/detail/algorithm/gallop.hpp>
 #include <nanorange/detail/algorithm/result_types.hpp>
 
 NANO_BEGIN_NAMESPACE
@@ -19,12 +20,86 @@ namespace detail {
 
 struct set_union_fn {
 private:
+    // Looks up each element of the smaller range in the larger one, copying
+    // the runs of the larger range which lie between them
+    template <typename I1, typename I2, typename O, typename Comp,
+              typename Proj1, typename Proj2>
+    static constexpr set_union_result<I1, I2, O>
+    gallop_impl(I1 first1, iter_difference_t<I1> n1, I2 first2,
+                iter_difference_t<I2> n2, O result, Comp& comp, Proj1& proj1,
+                Proj2& proj2)
+    {
+        const auto pred1 = [&](auto&& elem) {
+            return nano::invoke(comp, std::forward<decltype(elem)>(elem),
+                                nano::invoke(proj2, *first2));
+        };
+        const auto pred2 = [&](auto&& elem) {
+            return nano::invoke(comp, std::forward<decltype(elem)>(elem),
+                                nano::invoke(proj1, *first1));
+        };
+
+        if (n1 <= n2) {
+            for (; n1 > 0; ++first1, --n1) {
+                const I2 pos =
+                    detail::gallop_partition_point(first2, n2, pred2, proj2);
+                n2 -= pos - first2;
+                result =
+                    nano::copy(std::move(first2), pos, std::move(result)).out;
+                first2 = pos;
+                // Of two equivalent elements, the one from the first range
+                // is output
+                if (n2 > 0 &&
+                    !nano::invoke(comp, nano::invoke(proj1, *first1),
+                                  nano::invoke(proj2, *first2))) {
+                    ++first2;
+                    --n2;
+                }
+                *result = *first1;
+                ++result;
+            }
+        } else {
+            for (; n2 > 0; ++first2, --n2) {
+                const I1 pos =
+                    detail::gallop_partition_point(first1, n1, pred1, proj1);
+                n1 -= pos - first1;
+                result =
+                    nano::copy(std::move(first1), pos, std::move(result)).out;
+                first1 = pos;
+                if (n1 > 0 &&
+                    !nano::invoke(comp, nano::invoke(proj2, *first2),
+                                  nano::invoke(proj1, *first1))) {
+                    *result = *first1;
+                    ++first1;
+                    --n1;
+                } else {
+                    *result = *first2;
+                }
+                ++result;
+            }
+        }
+
+        auto res1 = nano::copy_n(std::move(first1), n1, std::move(result));
+        auto res2 = nano::copy_n(std::move(first2), n2, std::move(res1.out));
+        return {std::move(res1.in), std::move(res2.in), std::move(res2.out)};
+    }
+
     template <typename I1, typename S1, typename I2, typename S2, typename O,
               typename Comp, typename Proj1, typename Proj2>
     static constexpr set_union_result<I1, I2, O>
     impl(I1 first1, S1 last1, I2 first2, S2 last2, O result, Comp& comp,
          Proj1& proj1, Proj2& proj2)
     {
+        if constexpr (random_access_iterator<I1> && sized_sentinel_for<S1, I1> &&
+                      random_access_iterator<I2> && sized_sentinel_for<S2, I2>) {
+            const auto n1 = last1 - first1;
+            const auto n2 = last2 - first2;
+            if (detail::gallop_worthwhile(n1, n2)) {
+                return set_union_fn::gallop_impl(
+                    std::move(first1), n1, std::move(first2), n2,
+                    std::move(result), comp, proj1, proj2);
+            }
+        }
+
         while (first1 != last1) {
             // If we've reached the end of the second range, copy any remaining
             // elements from the first range and quit
@@ -44,15 +119,16 @@ private:
                              nano::invoke(proj2, *first2))) {
                 *result = *first1;
                 ++first1;
-            } else {
-                // Now, we know that !(r1 < r2). If we also have !(r2 < r1) then
-                // the elements compare equal, so skip it
-                if (!nano::invoke(comp, nano::invoke(proj2, *first2),
-                                  nano::invoke(proj1, *first1))) {
-                    ++first1;
-                }
+            } else if (nano::invoke(comp, nano::invoke(proj2, *first2),
+                                    nano::invoke(proj1, *first1))) {
                 *result = *first2;
                 ++first2;
+            } else {
+                // The elements are equivalent, so output the one from r1 and
+                // skip the other
+                *result = *first1;
+                ++first1;
+                ++first2;
             }
             ++result;
         }
@@ -7,13 +7,29 @@
 #ifndef NANORANGE_ALGORITHM_SORT_HPP_INCLUDED
 #define NANORANGE_ALGORITHM_SORT_HPP_INCLUDED
 
+#include <nanorange/detail/algorithm/parallel_pdqsort.hpp>
 #include <nanorange/detail/algorithm/pdqsort.hpp>
+#include <nanorange/execution/policy.hpp>
 
 NANO_BEGIN_NAMESPACE
 
 namespace detail {
 
 struct sort_fn {
+private:
+    template <typename EP, typename I, typename Comp, typename Proj>
+    static void policy_impl(EP& policy, I first, I last, Comp& comp, Proj& proj)
+    {
+        if constexpr (parallel_execution_policy<EP>) {
+            detail::parallel_pdqsort(std::move(first), std::move(last), comp,
+                                     proj, policy.get_executor(),
+                                     detail::parallel_pdqsort_grain(policy));
+        } else {
+            detail::pdqsort(std::move(first), std::move(last), comp, proj);
+        }
+    }
+
+public:
     template <typename I, typename S, typename Comp = ranges::less, typename Proj = identity>
     constexpr std::enable_if_t<random_access_iterator<I> && sentinel_for<S, I> &&
                                    sortable<I, Comp, Proj>, I>
@@ -34,6 +50,31 @@ struct sort_fn {
         detail::pdqsort(nano::begin(rng), last_it, comp, proj);
         return last_it;
     }
+
+    template <typename EP, typename I, typename S, typename Comp = ranges::less,
+              typename Proj = identity>
+    std::enable_if_t<execution_policy<EP> && random_access_iterator<I> &&
+                         sentinel_for<S, I> && sortable<I, Comp, Proj>, I>
+    operator()(EP&& policy, I first, S last, Comp comp = Comp{},
+               Proj proj = Proj{}) const
+    {
+        I last_it = nano::next(first, last);
+        sort_fn::policy_impl(policy, std::move(first), last_it, comp, proj);
+        return last_it;
+    }
+
+    template <typename EP, typename Rng, typename Comp = ranges::less,
+              typename Proj = identity>
+    std::enable_if_t<execution_policy<EP> && random_access_range<Rng> &&
+                         sortable<iterator_t<Rng>, Comp, Proj>,
+                     borrowed_iterator_t<Rng>>
+    operator()(EP&& policy, Rng&& rng, Comp comp = Comp{},
+               Proj proj = Proj{}) const
+    {
+        iterator_t<Rng> last_it = nano::next(nano::begin(rng), nano::end(rng));
+        sort_fn::policy_impl(policy, nano::begin(rng), last_it, comp, proj);
+        return last_it;
+    }
 };
 
 }
@@ -0,0 +1,68 @@
+// nanorange/algorithm/sort_heap_d.hpp
+//
+// Copyright (c) 2020 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_ALGORITHM_SORT_HEAP_D_HPP_INCLUDED
+#define NANORANGE_ALGORITHM_SORT_HEAP_D_HPP_INCLUDED
+
+#include <nanorange/algorithm/pop_heap_d.hpp>
+
+NANO_BEGIN_NAMESPACE
+
+namespace detail {
+
+// Extension: sort_heap for a heap in which each element has D children
+template <std::size_t D>
+struct sort_heap_d_fn {
+private:
+    template <typename I, typename Comp, typename Proj>
+    static constexpr I impl(I first, iter_difference_t<I> n, Comp& comp,
+                            Proj& proj)
+    {
+        if (n < 2) {
+            return first + n;
+        }
+
+        for (auto i = n; i > 1; --i) {
+            pop_heap_d_fn<D>::impl(first, i, comp, proj);
+        }
+
+        return first + n;
+    }
+
+public:
+    template <typename I, typename S, typename Comp = ranges::less,
+              typename Proj = identity>
+    constexpr std::enable_if_t<random_access_iterator<I> && sentinel_for<S, I> &&
+                                   sortable<I, Comp, Proj>, I>
+    operator()(I first, S last, Comp comp = Comp{}, Proj proj = Proj{}) const
+    {
+        const auto n = nano::distance(first, last);
+        return sort_heap_d_fn::impl(std::move(first), n, comp, proj);
+    }
+
+    template <typename Rng, typename Comp = ranges::less, typename Proj = identity>
+    constexpr std::enable_if_t<random_access_range<Rng> &&
+                                   sortable<iterator_t<Rng>, Comp, Proj>,
+                               borrowed_iterator_t<Rng>>
+    operator()(Rng&& rng, Comp comp = Comp{}, Proj proj = Proj{}) const
+    {
+        return sort_heap_d_fn::impl(nano::begin(rng), nano::distance(rng),
+                                    comp, proj);
+    }
+};
+
+} // namespace detail
+
+inline namespace function_objects {
+
+template <std::size_t D>
+inline constexpr detail::sort_heap_d_fn<D> sort_heap_d{};
+
+}
+
+NANO_END_NAMESPACE
+
+#endif
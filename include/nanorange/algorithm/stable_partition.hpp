@@ -25,7 +25,9 @@
 #include <nanorange/iterator/reverse_iterator.hpp>
 #include <nanorange/views/subrange.hpp>
 
+#include <nanorange/detail/algorithm/parallel_partition.hpp>
 #include <nanorange/detail/memory/temporary_vector.hpp>
+#include <nanorange/execution/policy.hpp>
 
 NANO_BEGIN_NAMESPACE
 
@@ -106,6 +108,7 @@ private:
                 auto rot = nano::rotate(first_false, middle, ++last);
                 return {std::move(rot.begin()), nano::next(last)};
             }
+            --len_half;
         }
 
         const I last_false = impl_unbuffered(m1, last, len_half, pred, proj).begin();
@@ -128,7 +131,7 @@ private:
                              nano::make_reverse_iterator(first),
                              std::ref(pred), std::ref(proj)).base();
         if (it == first) {
-            return {std::move(first), std::move(it)};
+            return {std::move(first), std::move(last)};
         }
 
         const auto dist = nano::distance(first, it);
@@ -147,6 +150,36 @@ private:
         return impl(first, nano::next(first, last), pred, proj);
     }
 
+    // The parallel overloads count the elements satisfying pred in each
+    // block, then move every element to its final place in a temporary
+    // buffer and back again, concurrently (see
+    // detail::parallel_stable_partition()). If the buffer can't be
+    // allocated, or moving an element might throw, they run sequentially.
+    template <typename EP, typename I, typename Pred, typename Proj>
+    static subrange<I> policy_impl(EP& policy, I first, iter_difference_t<I> n,
+                                   Pred& pred, Proj& proj)
+    {
+        const I last = first + n;
+
+        if constexpr (parallel_execution_policy<EP> &&
+                      parallel_stable_partitionable<I>) {
+            executor& ex = policy.get_executor();
+            const auto grain = detail::parallel_partition_grain(policy);
+            if (detail::parallel_partition_blocks(n, grain, ex) > 1) {
+                auto buf = detail::temporary_vector<iter_value_t<I>>(
+                    static_cast<std::size_t>(n));
+                if (buf.capacity() >= static_cast<std::size_t>(n)) {
+                    return {detail::parallel_stable_partition(
+                                std::move(first), n, buf.begin(), pred, proj,
+                                ex, grain),
+                            last};
+                }
+            }
+        }
+
+        return stable_partition_fn::impl(std::move(first), last, pred, proj);
+    }
+
 public:
     template <typename I, typename S, typename Pred, typename Proj = identity>
     std::enable_if_t<bidirectional_iterator<I> && sentinel_for<S, I> &&
@@ -169,6 +202,32 @@ public:
         return stable_partition_fn::impl(nano::begin(rng), nano::end(rng),
                                          pred, proj);
     }
+
+    template <typename EP, typename I, typename S, typename Pred,
+              typename Proj = identity>
+    std::enable_if_t<execution_policy<EP> && random_access_iterator<I> &&
+                         sized_sentinel_for<S, I> &&
+                         indirect_unary_predicate<Pred, projected<I, Proj>> &&
+                         permutable<I>, subrange<I>>
+    operator()(EP&& policy, I first, S last, Pred pred, Proj proj = Proj{}) const
+    {
+        const auto n = last - first;
+        return stable_partition_fn::policy_impl(policy, std::move(first), n,
+                                                pred, proj);
+    }
+
+    template <typename EP, typename Rng, typename Pred, typename Proj = identity>
+    std::enable_if_t<
+        execution_policy<EP> && random_access_range<Rng> && sized_range<Rng> &&
+            indirect_unary_predicate<Pred, projected<iterator_t<Rng>, Proj>> &&
+            permutable<iterator_t<Rng>>,
+        borrowed_subrange_t<Rng>>
+    operator()(EP&& policy, Rng&& rng, Pred pred, Proj proj = Proj{}) const
+    {
+        return stable_partition_fn::policy_impl(policy, nano::begin(rng),
+                                                nano::distance(rng), pred,
+                                                proj);
+    }
 };
 
 }
@@ -39,9 +39,58 @@
 
 #include <nanorange/algorithm/inplace_merge.hpp>
 #include <nanorange/detail/algorithm/pdqsort.hpp>
+#include <nanorange/execution/policy.hpp>
+#include <nanorange/memory/destroy.hpp>
+
+#include <new>
+#include <vector>
 
 NANO_BEGIN_NAMESPACE
 
+namespace detail {
+struct stable_sort_fn;
+}
+
+// Scratch space for stable_sort(), which can be passed to it in place of the
+// buffer it would otherwise allocate. The buffer is grown if necessary, so
+// reusing it avoids allocating on every call. A buffer with capacity for n
+// elements is always enough to sort a range of n elements. Storage is taken
+// from the temporary resource (see get_temporary_resource()) in effect when
+// the buffer grows, which must outlive it.
+template <typename T>
+class stable_sort_buffer {
+public:
+    stable_sort_buffer() = default;
+
+    explicit stable_sort_buffer(std::size_t capacity) { reserve(capacity); }
+
+    void reserve(std::size_t capacity)
+    {
+        if (!try_reserve(capacity)) {
+            throw std::bad_alloc{};
+        }
+    }
+
+    std::size_t capacity() const noexcept { return storage_.capacity(); }
+
+private:
+    friend struct detail::stable_sort_fn;
+
+    bool try_reserve(std::size_t capacity)
+    {
+        if (capacity > storage_.capacity()) {
+            detail::temporary_vector<T> storage(capacity);
+            if (storage.capacity() < capacity) {
+                return false;
+            }
+            storage_ = std::move(storage);
+        }
+        return true;
+    }
+
+    detail::temporary_vector<T> storage_;
+};
+
 namespace detail {
 
 struct stable_sort_fn {
@@ -139,20 +188,323 @@ private:
                 result, std::ref(comp), std::ref(proj), std::ref(proj));
     }
 
+    template <typename I, typename Buf, typename Comp, typename Proj>
+    static void sort_with_buffer(I first, I last, Buf& buf, Comp& comp,
+                                 Proj& proj)
+    {
+        if (buf.capacity() != 0) {
+            stable_sort_adaptive(std::move(first), std::move(last), buf, comp, proj);
+        } else {
+            inplace_stable_sort(std::move(first), std::move(last), comp, proj);
+        }
+    }
+
     template <typename I, typename Comp, typename Proj>
-    static void impl(I first, I last, Comp& comp, Proj& proj)
+    static void impl(I first, I last,
+                     stable_sort_buffer<iter_value_t<I>>* user_buf,
+                     Comp& comp, Proj& proj)
     {
         auto len = last - first;
         if (len == 0) {
             return;
         }
 
-        temporary_vector<iter_value_t<I>> buf(len > 256 ? len : 0);
+        // The merges never need to buffer more than half of the range, but
+        // they do need that much: a smaller buffer would overflow
+        const auto half = static_cast<std::size_t>((len + 1) / 2);
+        const auto buf_len = len > 256 ? half : std::size_t{0};
 
-        if (buf.capacity() != 0) {
-            stable_sort_adaptive(std::move(first), std::move(last), buf, comp, proj);
+        // If the user's buffer can't grow big enough, carry on as though
+        // there were none
+        if (user_buf && user_buf->try_reserve(buf_len) &&
+            user_buf->capacity() >= half) {
+            temporary_vector<iter_value_t<I>> buf(user_buf->storage_.begin(),
+                                                  user_buf->capacity());
+            sort_with_buffer(std::move(first), std::move(last), buf, comp, proj);
         } else {
-            inplace_stable_sort(std::move(first), std::move(last), comp, proj);
+            temporary_vector<iter_value_t<I>> buf(buf_len);
+            sort_with_buffer(std::move(first), std::move(last), buf, comp, proj);
+        }
+    }
+
+    // Chunks smaller than this are not worth sorting or merging in parallel,
+    // unless the policy sets a grain size
+    static constexpr std::ptrdiff_t parallel_grain_size = 1 << 14;
+
+    static std::ptrdiff_t parallel_grain(const parallel_policy& policy)
+    {
+        return policy.grain_size() > 0
+                   ? static_cast<std::ptrdiff_t>(policy.grain_size())
+                   : parallel_grain_size;
+    }
+
+    // Returns the number of elements from the sorted range [a, a + a_len)
+    // which are among the first n elements of its stable merge with
+    // [b, b + b_len)
+    template <typename I, typename Comp, typename Proj>
+    static iter_difference_t<I> co_rank(I a, iter_difference_t<I> a_len,
+                                        I b, iter_difference_t<I> b_len,
+                                        iter_difference_t<I> n,
+                                        Comp& comp, Proj& proj)
+    {
+        using diff_t = iter_difference_t<I>;
+
+        diff_t lo = n > b_len ? n - b_len : 0;
+        diff_t hi = nano::min(n, a_len);
+
+        while (lo < hi) {
+            const diff_t i = lo + (hi - lo) / 2;
+            // Elements of [a, a + a_len) come first when equal, so a[i] is
+            // among the first n unless b[n - i - 1] is strictly less than it
+            if (!nano::invoke(comp, nano::invoke(proj, *(b + (n - i - 1))),
+                              nano::invoke(proj, *(a + i)))) {
+                lo = i + 1;
+            } else {
+                hi = i;
+            }
+        }
+
+        return lo;
+    }
+
+    // Merges each pair of adjacent sorted runs of the given width in
+    // [src, src + len) into the corresponding positions of dst. Each merge is
+    // split into pieces of roughly equal size by co-ranking, so that all of
+    // the pieces can run in parallel. If Construct is true, dst is
+    // uninitialised storage.
+    template <bool Construct, typename I, typename O, typename Comp,
+              typename Proj>
+    static void parallel_merge_round(I src, O dst, iter_difference_t<I> len,
+                                     iter_difference_t<I> width, Comp& comp,
+                                     Proj& proj, executor& ex,
+                                     std::ptrdiff_t grain)
+    {
+        using diff_t = iter_difference_t<I>;
+        using value_t = iter_value_t<I>;
+
+        struct piece {
+            // The number of elements of the left-hand run which come before
+            // the piece's part of the output
+            diff_t rank = 0;
+            // Whether the piece's part of dst has been constructed
+            bool done = false;
+        };
+
+        const diff_t num_pairs = (len + 2 * width - 1) / (2 * width);
+        const diff_t pieces_per_pair =
+            (2 * width + static_cast<diff_t>(grain) - 1) /
+            static_cast<diff_t>(grain);
+        std::vector<piece> pieces(
+            static_cast<std::size_t>(num_pairs * pieces_per_pair));
+        const auto num_pieces = static_cast<std::ptrdiff_t>(pieces.size());
+
+        // The start of the ith of n roughly equal parts of [0, size)
+        const auto split = [](diff_t size, diff_t n, diff_t i) {
+            return (size / n) * i + nano::min(i, size % n);
+        };
+
+        const auto left_length = [&](diff_t pair) {
+            return nano::min(width, len - 2 * width * pair);
+        };
+
+        const auto right_length = [&](diff_t pair) {
+            return nano::min(width, len - 2 * width * pair - left_length(pair));
+        };
+
+        // The ranks must all be found before any elements are moved
+        const auto find_rank = [&](std::ptrdiff_t idx) {
+            const diff_t pair = static_cast<diff_t>(idx) / pieces_per_pair;
+            const diff_t part = static_cast<diff_t>(idx) % pieces_per_pair;
+            const I a = src + 2 * width * pair;
+            const diff_t a_len = left_length(pair);
+            const diff_t b_len = right_length(pair);
+
+            pieces[static_cast<std::size_t>(idx)].rank =
+                co_rank(a, a_len, a + a_len, b_len,
+                        split(a_len + b_len, pieces_per_pair, part), comp, proj);
+        };
+
+        const auto merge = [&](std::ptrdiff_t idx) {
+            const diff_t pair = static_cast<diff_t>(idx) / pieces_per_pair;
+            const diff_t part = static_cast<diff_t>(idx) % pieces_per_pair;
+            const I a = src + 2 * width * pair;
+            const diff_t a_len = left_length(pair);
+            const diff_t total = a_len + right_length(pair);
+
+            const diff_t o_first = split(total, pieces_per_pair, part);
+            const diff_t o_last = split(total, pieces_per_pair, part + 1);
+            const diff_t rank_first = pieces[static_cast<std::size_t>(idx)].rank;
+            const diff_t rank_last =
+                part + 1 == pieces_per_pair
+                    ? a_len
+                    : pieces[static_cast<std::size_t>(idx) + 1].rank;
+
+            I first1 = a + rank_first;
+            const I last1 = a + rank_last;
+            I first2 = a + a_len + (o_first - rank_first);
+            const I last2 = a + a_len + (o_last - rank_last);
+            const O out_first = dst + 2 * width * pair + o_first;
+            O out = out_first;
+
+            const auto put = [&out](I& it) {
+                if constexpr (Construct) {
+                    ::new (static_cast<void*>(std::addressof(*out)))
+                        value_t(nano::iter_move(it));
+                } else {
+                    *out = nano::iter_move(it);
+                }
+                ++it;
+                ++out;
+            };
+
+            try {
+                while (first1 != last1 && first2 != last2) {
+                    if (nano::invoke(comp, nano::invoke(proj, *first2),
+                                     nano::invoke(proj, *first1))) {
+                        put(first2);
+                    } else {
+                        put(first1);
+                    }
+                }
+                while (first1 != last1) {
+                    put(first1);
+                }
+                while (first2 != last2) {
+                    put(first2);
+                }
+            } catch (...) {
+                if constexpr (Construct) {
+                    nano::destroy(out_first, out);
+                }
+                throw;
+            }
+
+            pieces[static_cast<std::size_t>(idx)].done = true;
+        };
+
+        detail::parallel_for(ex, num_pieces, find_rank);
+
+        try {
+            detail::parallel_for(ex, num_pieces, merge);
+        } catch (...) {
+            if constexpr (Construct) {
+                for (std::ptrdiff_t idx = 0; idx < num_pieces; idx++) {
+                    if (pieces[static_cast<std::size_t>(idx)].done) {
+                        const diff_t pair = static_cast<diff_t>(idx) / pieces_per_pair;
+                        const diff_t part = static_cast<diff_t>(idx) % pieces_per_pair;
+                        const diff_t total = left_length(pair) + right_length(pair);
+                        const O out = dst + 2 * width * pair;
+                        nano::destroy(out + split(total, pieces_per_pair, part),
+                                      out + split(total, pieces_per_pair, part + 1));
+                    }
+                }
+            }
+            throw;
+        }
+    }
+
+    // Sorts a power-of-two number of chunks in parallel, each using its own
+    // part of a shared scratch buffer as temporary space, and then merges
+    // pairs of sorted runs in parallel, back and forth between the range and
+    // the buffer, until a single run remains
+    template <typename I, typename Comp, typename Proj>
+    static void parallel_impl(I first, I last,
+                              stable_sort_buffer<iter_value_t<I>>* user_buf,
+                              Comp& comp, Proj& proj, executor& ex,
+                              std::ptrdiff_t grain)
+    {
+        using diff_t = iter_difference_t<I>;
+        using value_t = iter_value_t<I>;
+
+        const diff_t len = last - first;
+        const auto concurrency = static_cast<diff_t>(ex.concurrency());
+
+        diff_t num_chunks = 1;
+        while (num_chunks < concurrency &&
+               len / (2 * num_chunks) >= static_cast<diff_t>(grain)) {
+            num_chunks *= 2;
+        }
+
+        if (num_chunks == 1) {
+            impl(std::move(first), std::move(last), user_buf, comp, proj);
+            return;
+        }
+
+        const auto buf_len = static_cast<std::size_t>(len);
+        temporary_vector<value_t> local_buf;
+        value_t* scratch = nullptr;
+        if (user_buf) {
+            if (user_buf->try_reserve(buf_len)) {
+                scratch = user_buf->storage_.begin();
+            }
+        } else {
+            local_buf = temporary_vector<value_t>(buf_len);
+            if (local_buf.capacity() >= buf_len) {
+                scratch = local_buf.begin();
+            }
+        }
+
+        if (!scratch) {
+            impl(std::move(first), std::move(last), user_buf, comp, proj);
+            return;
+        }
+
+        const diff_t chunk_size = (len + num_chunks - 1) / num_chunks;
+
+        const auto sort_chunk = [&](std::ptrdiff_t i) {
+            const diff_t lo = nano::min(static_cast<diff_t>(i) * chunk_size, len);
+            const diff_t hi = nano::min(lo + chunk_size, len);
+            temporary_vector<value_t> buf(scratch + lo,
+                                          static_cast<std::size_t>(hi - lo));
+            sort_with_buffer(first + lo, first + hi, buf, comp, proj);
+        };
+        detail::parallel_for(ex, static_cast<std::ptrdiff_t>(num_chunks),
+                             sort_chunk);
+
+        // The first round of merging constructs the elements of the buffer,
+        // which then live until we're finished
+        parallel_merge_round<true>(first, scratch, len, chunk_size, comp, proj,
+                                   ex, grain);
+
+        struct buffer_guard {
+            value_t* first;
+            value_t* last;
+            ~buffer_guard() { nano::destroy(first, last); }
+        } guard{scratch, scratch + len};
+
+        bool in_buf = true;
+        for (diff_t width = 2 * chunk_size; width < len; width *= 2) {
+            if (in_buf) {
+                parallel_merge_round<false>(scratch, first, len, width, comp,
+                                            proj, ex, grain);
+            } else {
+                parallel_merge_round<false>(first, scratch, len, width, comp,
+                                            proj, ex, grain);
+            }
+            in_buf = !in_buf;
+        }
+
+        if (in_buf) {
+            const auto block = static_cast<diff_t>(grain);
+            const auto move_back = [&](std::ptrdiff_t i) {
+                const diff_t lo = static_cast<diff_t>(i) * block;
+                const diff_t hi = nano::min(diff_t(lo + block), len);
+                nano::move(scratch + lo, scratch + hi, first + lo);
+            };
+            detail::parallel_for(ex, (len + block - 1) / block, move_back);
+        }
+    }
+
+    template <typename EP, typename I, typename Comp, typename Proj>
+    static void policy_impl(EP& policy, I first, I last,
+                            stable_sort_buffer<iter_value_t<I>>* buf,
+                            Comp& comp, Proj& proj)
+    {
+        if constexpr (parallel_execution_policy<EP>) {
+            parallel_impl(std::move(first), std::move(last), buf, comp, proj,
+                          policy.get_executor(), parallel_grain(policy));
+        } else {
+            impl(std::move(first), std::move(last), buf, comp, proj);
         }
     }
 
@@ -163,7 +515,7 @@ public:
     operator()(I first, S last, Comp comp = Comp{}, Proj proj = Proj{}) const
     {
         const auto ilast = nano::next(first, last);
-        impl(std::move(first), ilast, comp, proj);
+        impl(std::move(first), ilast, nullptr, comp, proj);
         return ilast;
     }
 
@@ -175,7 +527,85 @@ public:
     {
         auto first = nano::begin(rng);
         const auto last = nano::next(first, nano::end(rng));
-        impl(std::move(first), last, comp, proj);
+        impl(std::move(first), last, nullptr, comp, proj);
+        return last;
+    }
+
+    template <typename I, typename S, typename Comp = ranges::less, typename Proj = identity>
+    std::enable_if_t<random_access_iterator<I> && sentinel_for<S, I> &&
+                         sortable<I, Comp, Proj>, I>
+    operator()(I first, S last, stable_sort_buffer<iter_value_t<I>>& buf,
+               Comp comp = Comp{}, Proj proj = Proj{}) const
+    {
+        const auto ilast = nano::next(first, last);
+        impl(std::move(first), ilast, &buf, comp, proj);
+        return ilast;
+    }
+
+    template <typename Rng, typename Comp = ranges::less, typename Proj = identity>
+    std::enable_if_t<random_access_range<Rng> &&
+                         sortable<iterator_t<Rng>, Comp, Proj>,
+                     borrowed_iterator_t<Rng>>
+    operator()(Rng&& rng, stable_sort_buffer<range_value_t<Rng>>& buf,
+               Comp comp = Comp{}, Proj proj = Proj{}) const
+    {
+        auto first = nano::begin(rng);
+        const auto last = nano::next(first, nano::end(rng));
+        impl(std::move(first), last, &buf, comp, proj);
+        return last;
+    }
+
+    template <typename EP, typename I, typename S, typename Comp = ranges::less,
+              typename Proj = identity>
+    std::enable_if_t<execution_policy<EP> && random_access_iterator<I> &&
+                         sentinel_for<S, I> && sortable<I, Comp, Proj>, I>
+    operator()(EP&& policy, I first, S last, Comp comp = Comp{},
+               Proj proj = Proj{}) const
+    {
+        const auto ilast = nano::next(first, last);
+        policy_impl(policy, std::move(first), ilast, nullptr, comp, proj);
+        return ilast;
+    }
+
+    template <typename EP, typename Rng, typename Comp = ranges::less,
+              typename Proj = identity>
+    std::enable_if_t<execution_policy<EP> && random_access_range<Rng> &&
+                         sortable<iterator_t<Rng>, Comp, Proj>,
+                     borrowed_iterator_t<Rng>>
+    operator()(EP&& policy, Rng&& rng, Comp comp = Comp{},
+               Proj proj = Proj{}) const
+    {
+        auto first = nano::begin(rng);
+        const auto last = nano::next(first, nano::end(rng));
+        policy_impl(policy, std::move(first), last, nullptr, comp, proj);
+        return last;
+    }
+
+    template <typename EP, typename I, typename S, typename Comp = ranges::less,
+              typename Proj = identity>
+    std::enable_if_t<execution_policy<EP> && random_access_iterator<I> &&
+                         sentinel_for<S, I> && sortable<I, Comp, Proj>, I>
+    operator()(EP&& policy, I first, S last,
+               stable_sort_buffer<iter_value_t<I>>& buf, Comp comp = Comp{},
+               Proj proj = Proj{}) const
+    {
+        const auto ilast = nano::next(first, last);
+        policy_impl(policy, std::move(first), ilast, &buf, comp, proj);
+        return ilast;
+    }
+
+    template <typename EP, typename Rng, typename Comp = ranges::less,
+              typename Proj = identity>
+    std::enable_if_t<execution_policy<EP> && random_access_range<Rng> &&
+                         sortable<iterator_t<Rng>, Comp, Proj>,
+                     borrowed_iterator_t<Rng>>
+    operator()(EP&& policy, Rng&& rng,
+               stable_sort_buffer<range_value_t<Rng>>& buf,
+               Comp comp = Comp{}, Proj proj = Proj{}) const
+    {
+        auto first = nano::begin(rng);
+        const auto last = nano::next(first, nano::end(rng));
+        policy_impl(policy, std::move(first), last, &buf, comp, proj);
         return last;
     }
 };
@@ -7,6 +7,7 @@
 #ifndef NANORANGE_ALGORITHM_TRANSFORM_HPP_INCLUDED
 #define NANORANGE_ALGORITHM_TRANSFORM_HPP_INCLUDED
 
+#include <nanorange/detail/algorithm/parallel_chunks.hpp>
 #include <nanorange/detail/algorithm/result_types.hpp>
 #include <nanorange/ranges.hpp>
 
@@ -69,6 +70,51 @@ private:
         return {std::move(first1), std::move(first2), std::move(result)};
     }
 
+    // The parallel overloads split the output into chunks, and call the same
+    // op from every task
+    template <typename EP, typename I, typename O, typename F, typename Proj>
+    static unary_transform_result<I, O>
+    unary_policy_impl(EP& policy, I first, iter_difference_t<I> n, O result,
+                      F& op, Proj& proj)
+    {
+        if constexpr (parallel_execution_policy<EP>) {
+            using D = iter_difference_t<O>;
+            auto run = [&](D lo, D hi) {
+                transform_fn::unary_impl(first + lo, first + hi, result + lo,
+                                         op, proj);
+            };
+            detail::parallel_chunks(policy, result, static_cast<D>(n), run);
+            return {first + n, result + static_cast<D>(n)};
+        } else {
+            return transform_fn::unary_impl(first, first + n, std::move(result),
+                                            op, proj);
+        }
+    }
+
+    template <typename EP, typename I1, typename I2, typename O, typename F,
+              typename Proj1, typename Proj2>
+    static binary_transform_result<I1, I2, O>
+    binary_policy_impl(EP& policy, I1 first1, I2 first2,
+                       iter_difference_t<I1> n, O result, F& op, Proj1& proj1,
+                       Proj2& proj2)
+    {
+        if constexpr (parallel_execution_policy<EP>) {
+            using D = iter_difference_t<O>;
+            auto run = [&](D lo, D hi) {
+                transform_fn::binary_impl3(first1 + lo, first1 + hi,
+                                           first2 + lo, result + lo, op, proj1,
+                                           proj2);
+            };
+            detail::parallel_chunks(policy, result, static_cast<D>(n), run);
+            return {first1 + n, first2 + n, result + static_cast<D>(n)};
+        } else {
+            return transform_fn::binary_impl3(first1, first1 + n,
+                                              std::move(first2),
+                                              std::move(result), op, proj1,
+                                              proj2);
+        }
+    }
+
 public:
     // Unary op, iterators
     template <typename I, typename S, typename O, typename F,
@@ -134,6 +180,90 @@ public:
                                           std::move(result), op, proj1, proj2);
     }
 
+    // Unary op, iterators, with execution policy
+    template <typename EP, typename I, typename S, typename O, typename F,
+              typename Proj = identity>
+    std::enable_if_t<
+        execution_policy<EP> && random_access_iterator<I> &&
+            sized_sentinel_for<S, I> && random_access_iterator<O> &&
+            copy_constructible<F> &&
+            writable<O, indirect_result_t<F&, projected<I, Proj>>>,
+        unary_transform_result<I, O>>
+    operator()(EP&& policy, I first, S last, O result, F op,
+               Proj proj = Proj{}) const
+    {
+        const auto n = last - first;
+        return transform_fn::unary_policy_impl(policy, std::move(first), n,
+                                               std::move(result), op, proj);
+    }
+
+    // Unary op, range, with execution policy
+    template <typename EP, typename Rng, typename O, typename F,
+              typename Proj = identity>
+    std::enable_if_t<
+        execution_policy<EP> && random_access_range<Rng> && sized_range<Rng> &&
+            random_access_iterator<O> && copy_constructible<F> &&
+            writable<O,
+                     indirect_result_t<F&, projected<iterator_t<Rng>, Proj>>>,
+        unary_transform_result<borrowed_iterator_t<Rng>, O>>
+    operator()(EP&& policy, Rng&& rng, O result, F op, Proj proj = Proj{}) const
+    {
+        return transform_fn::unary_policy_impl(policy, nano::begin(rng),
+                                               nano::distance(rng),
+                                               std::move(result), op, proj);
+    }
+
+    // Binary op, four-legged, with execution policy
+    template <typename EP, typename I1, typename S1, typename I2, typename S2,
+              typename O, typename F, typename Proj1 = identity,
+              typename Proj2 = identity>
+    std::enable_if_t<
+        execution_policy<EP> && random_access_iterator<I1> &&
+            sized_sentinel_for<S1, I1> && random_access_iterator<I2> &&
+            sized_sentinel_for<S2, I2> && random_access_iterator<O> &&
+            copy_constructible<F> &&
+            writable<O, indirect_result_t<F&, projected<I1, Proj1>,
+                                          projected<I2, Proj2>>>,
+        binary_transform_result<I1, I2, O>>
+    operator()(EP&& policy, I1 first1, S1 last1, I2 first2, S2 last2, O result,
+               F op, Proj1 proj1 = Proj1{}, Proj2 proj2 = Proj2{}) const
+    {
+        using D = iter_difference_t<I1>;
+        const auto n1 = static_cast<D>(last1 - first1);
+        const auto n2 = static_cast<D>(last2 - first2);
+        const D n = n2 < n1 ? n2 : n1;
+        return transform_fn::binary_policy_impl(policy, std::move(first1),
+                                                std::move(first2), n,
+                                                std::move(result), op, proj1,
+                                                proj2);
+    }
+
+    // Binary op, two ranges, with execution policy
+    template <typename EP, typename Rng1, typename Rng2, typename O,
+              typename F, typename Proj1 = identity, typename Proj2 = identity>
+    std::enable_if_t<
+        execution_policy<EP> && random_access_range<Rng1> &&
+            sized_range<Rng1> && random_access_range<Rng2> &&
+            sized_range<Rng2> && random_access_iterator<O> &&
+            copy_constructible<F> &&
+            writable<O,
+                     indirect_result_t<F&, projected<iterator_t<Rng1>, Proj1>,
+                                       projected<iterator_t<Rng2>, Proj2>>>,
+        binary_transform_result<borrowed_iterator_t<Rng1>,
+                                borrowed_iterator_t<Rng2>, O>>
+    operator()(EP&& policy, Rng1&& rng1, Rng2&& rng2, O result, F op,
+               Proj1 proj1 = Proj1{}, Proj2 proj2 = Proj2{}) const
+    {
+        using D = range_difference_t<Rng1>;
+        const auto n1 = static_cast<D>(nano::distance(rng1));
+        const auto n2 = static_cast<D>(nano::distance(rng2));
+        const D n = n2 < n1 ? n2 : n1;
+        return transform_fn::binary_policy_impl(policy, nano::begin(rng1),
+                                                nano::begin(rng2), n,
+                                                std::move(result), op, proj1,
+                                                proj2);
+    }
+
     // Binary op, three-legged
     template <typename I1, typename S1, typename I2, typename O, typename F,
               typename Proj1 = identity, typename Proj2 = identity>
@@ -0,0 +1,158 @@
+// nanorange/detail/algorithm/branchless_search.hpp
+//
+// Copyright (c) 2020 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_DETAIL_ALGORITHM_BRANCHLESS_SEARCH_HPP_INCLUDED
+#define NANORANGE_DETAIL_ALGORITHM_BRANCHLESS_SEARCH_HPP_INCLUDED
+
+#include <nanorange/detail/algorithm/memmove.hpp>
+#include <nanorange/detail/algorithm/result_types.hpp>
+#include <nanorange/detail/algorithm/simd.hpp>
+
+#include <memory>
+
+NANO_BEGIN_NAMESPACE
+
+namespace detail {
+
+// Binary searches over fewer elements than this are assumed to be in cache,
+// and so are not worth prefetching for
+constexpr std::ptrdiff_t branchless_search_prefetch_threshold = 1 << 12;
+
+// The number of searches detail::batch_bound() runs side by side
+constexpr int batch_search_width = 16;
+
+// Hints that *p will be read soon
+inline void prefetch(const void* p) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(p);
+#elif defined(NANO_HAS_X86_SIMD)
+    _mm_prefetch(static_cast<const char*>(p), _MM_HINT_T0);
+#else
+    (void) p;
+#endif
+}
+
+// Whether lower_bound() and friends over [I, I + n) with Proj should use
+// branchless_partition_point(). Comparisons of scalars are cheap enough that
+// the extra one it needs is outweighed by never mispredicting a branch.
+template <typename I, typename Proj, typename = void>
+inline constexpr bool branchless_searchable = false;
+
+template <typename I, typename Proj>
+inline constexpr bool branchless_searchable<
+    I, Proj, std::enable_if_t<known_contiguous_iterator<I>>> =
+    std::is_scalar<remove_cvref_t<indirect_result_t<Proj&, I>>>::value;
+
+// Returns the first element of the partitioned range [first, first + n) for
+// which pred(proj(elem)) is false. Each step of the search halves the length
+// of the range unconditionally and moves its start with a conditional move
+// rather than a branch, so the loop runs exactly log2(n) times whatever the
+// data. While the range is large, the two places the next step may look at
+// are prefetched.
+template <typename I, typename Pred, typename Proj>
+I branchless_partition_point(I first, iter_difference_t<I> n, Pred& pred,
+                             Proj& proj)
+{
+    using D = iter_difference_t<I>;
+
+    if (n == 0) {
+        return first;
+    }
+
+    // The partition point always lies in [first, first + n]
+    while (n > static_cast<D>(branchless_search_prefetch_threshold)) {
+        const D half = n / 2;
+        detail::prefetch(std::addressof(first[half / 2]));
+        detail::prefetch(std::addressof(first[half + half / 2]));
+        first += nano::invoke(pred, nano::invoke(proj, first[half])) ? half
+                                                                      : D{0};
+        n -= half;
+    }
+
+    while (n > 1) {
+        const D half = n / 2;
+        first += nano::invoke(pred, nano::invoke(proj, first[half])) ? half
+                                                                      : D{0};
+        n -= half;
+    }
+
+    return first + static_cast<D>(nano::invoke(pred, nano::invoke(proj, *first)));
+}
+
+// Writes to out, for each key in [kfirst, klast), the first element of the
+// sorted range [first, first + n) which is not less than the key (or, if
+// Upper is true, which is greater than it). The keys are taken
+// batch_search_width at a time, and the steps of their searches interleaved:
+// every search over the same range takes the same number of steps of the
+// same lengths, and as they are independent of each other the processor can
+// have all of their loads in flight at once.
+template <bool Upper, typename I, typename KI, typename KS, typename O,
+          typename Comp, typename Proj>
+in_out_result<KI, O> batch_bound(I first, iter_difference_t<I> n, KI kfirst,
+                                 KS klast, O out, Comp& comp, Proj& proj)
+{
+    using D = iter_difference_t<I>;
+
+    const auto goes_right = [&comp, &proj](auto&& elem, auto&& key) -> bool {
+        if constexpr (Upper) {
+            return !nano::invoke(comp, std::forward<decltype(key)>(key),
+                                 nano::invoke(proj,
+                                              std::forward<decltype(elem)>(elem)));
+        } else {
+            return nano::invoke(comp,
+                                nano::invoke(proj,
+                                             std::forward<decltype(elem)>(elem)),
+                                std::forward<decltype(key)>(key));
+        }
+    };
+
+    KI keys[batch_search_width];
+    I bases[batch_search_width];
+
+    while (kfirst != klast) {
+        int count = 0;
+        for (; count < batch_search_width && kfirst != klast; ++count) {
+            keys[count] = kfirst;
+            bases[count] = first;
+            ++kfirst;
+        }
+
+        D len = n;
+        while (len > 1) {
+            const D half = len / 2;
+            if constexpr (known_contiguous_iterator<I>) {
+                if (len > static_cast<D>(branchless_search_prefetch_threshold)) {
+                    for (int i = 0; i < count; ++i) {
+                        detail::prefetch(std::addressof(bases[i][half / 2]));
+                        detail::prefetch(
+                            std::addressof(bases[i][half + half / 2]));
+                    }
+                }
+            }
+            for (int i = 0; i < count; ++i) {
+                bases[i] += goes_right(bases[i][half], *keys[i]) ? half : D{0};
+            }
+            len -= half;
+        }
+
+        for (int i = 0; i < count; ++i) {
+            if (len == 1) {
+                bases[i] += static_cast<D>(goes_right(*bases[i], *keys[i]));
+            }
+            *out = bases[i];
+            ++out;
+        }
+    }
+
+    return {std::move(kfirst), std::move(out)};
+}
+
+} // namespace detail
+
+NANO_END_NAMESPACE
+
+#endif
@@ -0,0 +1,182 @@
+// nanorange/detail/algorithm/gallop.hpp
+//
+// Copyright (c) 2020 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_DETAIL_ALGORITHM_GALLOP_HPP_INCLUDED
+#define NANORANGE_DETAIL_ALGORITHM_GALLOP_HPP_INCLUDED
+
+#include <nanorange/algorithm/copy.hpp>
+#include <nanorange/algorithm/move.hpp>
+#include <nanorange/detail/algorithm/result_types.hpp>
+#include <nanorange/detail/functional/invoke.hpp>
+#include <nanorange/detail/iterator/concepts.hpp>
+#include <nanorange/detail/iterator/iter_move.hpp>
+
+#include <type_traits>
+
+NANO_BEGIN_NAMESPACE
+
+namespace detail {
+
+// The set operations switch from stepping through both inputs together to
+// looking up each element of the smaller input in the larger one when the
+// larger is at least this many times the size of the smaller
+constexpr int gallop_ratio = 32;
+
+template <typename D1, typename D2>
+constexpr bool gallop_worthwhile(D1 n1, D2 n2)
+{
+    using D = std::common_type_t<D1, D2>;
+    const D a = static_cast<D>(n1);
+    const D b = static_cast<D>(n2);
+    return a > 0 && b > 0 && (a / gallop_ratio >= b || b / gallop_ratio >= a);
+}
+
+// Returns the first element of the partitioned range [first, first + n) for
+// which pred(proj(elem)) is false. The search looks at first[0], first[1],
+// first[3], first[7] and so on until it overshoots, and then binary searches
+// the last gap, so it takes O(log k) steps when the result is k elements in.
+// Looking up a sorted sequence of keys one after the other, starting each
+// search from the previous result, is therefore never much slower than
+// stepping through the range.
+template <typename I, typename Pred, typename Proj>
+constexpr I gallop_partition_point(I first, iter_difference_t<I> n, Pred& pred,
+                                   Proj& proj)
+{
+    using D = iter_difference_t<I>;
+
+    // The partition point lies in [first + lo, first + hi]
+    D lo = 0;
+    D hi = 0;
+    D step = 1;
+    while (hi < n && nano::invoke(pred, nano::invoke(proj, first[hi]))) {
+        lo = hi + 1;
+        hi += step < n - hi ? step : n - hi;
+        step *= 2;
+    }
+
+    first += lo;
+    n = hi - lo;
+    while (n > 0) {
+        const D half = n / 2;
+        if (nano::invoke(pred, nano::invoke(proj, first[half]))) {
+            first += half + 1;
+            n -= half + 1;
+        } else {
+            n = half;
+        }
+    }
+    return first;
+}
+
+// The merges switch to galloping once one input has supplied this many
+// elements in a row, as in TimSort
+constexpr int gallop_min_run = 7;
+
+// Merges [first1, first1 + n1) and [first2, first2 + n2) into result as
+// nano::merge() does, copying the elements or, if Move, moving them. Once one
+// input has won gallop_min_run comparisons in a row, the rest of its current
+// run is found with gallop_partition_point() and transferred in one go, so
+// inputs made of long ordered runs cost a few comparisons per run rather than
+// one per element. Stops as soon as either input runs out.
+//
+// A gallop which finds no run reuses its one comparison to transfer the
+// other input's element, but one which does find a run may need up to twice
+// its logarithm, so unlike the standard's merge this can make more than
+// n1 + n2 - 1 comparisons on inputs whose runs are mostly short.
+template <bool Move, typename I1, typename I2, typename O, typename Comp,
+          typename Proj1, typename Proj2>
+constexpr in_in_out_result<I1, I2, O>
+gallop_merge(I1 first1, iter_difference_t<I1> n1, I2 first2,
+             iter_difference_t<I2> n2, O result, Comp& comp, Proj1& proj1,
+             Proj2& proj2)
+{
+    const auto transfer = [](auto first, auto last, O out) {
+        if constexpr (Move) {
+            return nano::move(std::move(first), std::move(last),
+                              std::move(out)).out;
+        } else {
+            return nano::copy(std::move(first), std::move(last),
+                              std::move(out)).out;
+        }
+    };
+
+    const auto transfer_one = [](auto& it, O& out) {
+        if constexpr (Move) {
+            *out = nano::iter_move(it);
+        } else {
+            *out = *it;
+        }
+        ++it;
+        ++out;
+    };
+
+    // Elements of the first range go before the current element of the
+    // second unless they compare greater; those of the second go before the
+    // current element of the first only if they compare less
+    const auto pred1 = [&](auto&& elem) {
+        return !nano::invoke(comp, nano::invoke(proj2, *first2),
+                             std::forward<decltype(elem)>(elem));
+    };
+    const auto pred2 = [&](auto&& elem) {
+        return nano::invoke(comp, std::forward<decltype(elem)>(elem),
+                            nano::invoke(proj1, *first1));
+    };
+
+    int wins1 = 0;
+    int wins2 = 0;
+
+    while (n1 > 0 && n2 > 0) {
+        if (nano::invoke(comp, nano::invoke(proj2, *first2),
+                         nano::invoke(proj1, *first1))) {
+            transfer_one(first2, result);
+            --n2;
+            wins1 = 0;
+            if (++wins2 == gallop_min_run) {
+                const I2 pos =
+                    detail::gallop_partition_point(first2, n2, pred2, proj2);
+                wins2 = 0;
+                if (pos == first2 && n2 > 0) {
+                    // The comparison which ended the gallop already shows
+                    // that *first1 goes next
+                    transfer_one(first1, result);
+                    --n1;
+                    wins1 = 1;
+                } else {
+                    n2 -= pos - first2;
+                    result = transfer(first2, pos, std::move(result));
+                    first2 = pos;
+                }
+            }
+        } else {
+            transfer_one(first1, result);
+            --n1;
+            wins2 = 0;
+            if (++wins1 == gallop_min_run) {
+                const I1 pos =
+                    detail::gallop_partition_point(first1, n1, pred1, proj1);
+                wins1 = 0;
+                if (pos == first1 && n1 > 0) {
+                    // As above, *first2 goes next
+                    transfer_one(first2, result);
+                    --n2;
+                    wins2 = 1;
+                } else {
+                    n1 -= pos - first1;
+                    result = transfer(first1, pos, std::move(result));
+                    first1 = pos;
+                }
+            }
+        }
+    }
+
+    return {std::move(first1), std::move(first2), std::move(result)};
+}
+
+} // namespace detail
+
+NANO_END_NAMESPACE
+
+#endif
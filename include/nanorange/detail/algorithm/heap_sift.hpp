@@ -32,8 +32,10 @@
 #include <nanorange/detail/iterator/iter_move.hpp>
 #include <nanorange/functional.hpp>
 
+#include <cstddef>
+
 ///////////////////////////////////////////////////////////////////////////
-// detail::sift_up_n and detail::sift_down_n
+// detail::sift_up_n and detail::sift_down_n, and their d-ary counterparts
 // (heap implementation details)
 //
 
@@ -124,6 +126,138 @@ constexpr void sift_down_n(I first, iter_difference_t<I> n, I start, Comp& comp,
     *start = std::move(top);
 }
 
+///////////////////////////////////////////////////////////////////////////
+// d-ary heaps: the children of element i are at D * i + 1 to D * i + D, so
+// with D = 2 this is the same layout as above. Larger D makes the heap
+// shallower, and the D children of a node are adjacent in memory, so
+// sifting down touches far fewer cache lines than with a binary heap.
+//
+
+// Returns the index of the greatest of the children of the element at
+// index parent, of which there must be at least one
+template <std::size_t D, typename I, typename Comp, typename Proj>
+constexpr iter_difference_t<I> greatest_child_d(I first,
+                                                iter_difference_t<I> parent,
+                                                iter_difference_t<I> n,
+                                                Comp& comp, Proj& proj)
+{
+    using diff_t = iter_difference_t<I>;
+    constexpr auto d = static_cast<diff_t>(D);
+
+    diff_t best = d * parent + 1;
+
+    if (n - best >= d) {
+        // All D children are present, which is the common case. A fixed trip
+        // count lets the compiler unroll this.
+        const diff_t last = best + d;
+        for (diff_t c = best + 1; c != last; ++c) {
+            if (nano::invoke(comp, nano::invoke(proj, *(first + best)),
+                             nano::invoke(proj, *(first + c)))) {
+                best = c;
+            }
+        }
+    } else {
+        for (diff_t c = best + 1; c < n; ++c) {
+            if (nano::invoke(comp, nano::invoke(proj, *(first + best)),
+                             nano::invoke(proj, *(first + c)))) {
+                best = c;
+            }
+        }
+    }
+
+    return best;
+}
+
+template <std::size_t D, typename I, typename Comp, typename Proj>
+constexpr void sift_up_d(I first, iter_difference_t<I> n, Comp& comp,
+                         Proj& proj)
+{
+    using diff_t = iter_difference_t<I>;
+    constexpr auto d = static_cast<diff_t>(D);
+
+    if (n < 2) {
+        return;
+    }
+
+    diff_t hole = n - 1;
+    diff_t parent = (hole - 1) / d;
+
+    if (!nano::invoke(comp, nano::invoke(proj, *(first + parent)),
+                      nano::invoke(proj, *(first + hole)))) {
+        return;
+    }
+
+    iter_value_t<I> v = nano::iter_move(first + hole);
+    do {
+        *(first + hole) = nano::iter_move(first + parent);
+        hole = parent;
+        if (hole == 0) {
+            break;
+        }
+        parent = (hole - 1) / d;
+    } while (nano::invoke(comp, nano::invoke(proj, *(first + parent)),
+                          nano::invoke(proj, v)));
+    *(first + hole) = std::move(v);
+}
+
+template <std::size_t D, typename I, typename Comp, typename Proj>
+constexpr void sift_down_d(I first, iter_difference_t<I> n,
+                           iter_difference_t<I> start, Comp& comp, Proj& proj)
+{
+    using diff_t = iter_difference_t<I>;
+    constexpr auto d = static_cast<diff_t>(D);
+
+    // The last element with any children is at (n - 2) / D
+    if (n < 2 || (n - 2) / d < start) {
+        return;
+    }
+
+    diff_t child = detail::greatest_child_d<D>(first, start, n, comp, proj);
+
+    if (nano::invoke(comp, nano::invoke(proj, *(first + child)),
+                     nano::invoke(proj, *(first + start)))) {
+        return;
+    }
+
+    iter_value_t<I> top = nano::iter_move(first + start);
+    diff_t hole = start;
+    do {
+        *(first + hole) = nano::iter_move(first + child);
+        hole = child;
+
+        if ((n - 2) / d < hole) {
+            break;
+        }
+
+        child = detail::greatest_child_d<D>(first, hole, n, comp, proj);
+    } while (!nano::invoke(comp, nano::invoke(proj, *(first + child)),
+                           nano::invoke(proj, top)));
+    *(first + hole) = std::move(top);
+}
+
+// Moves the hole left by removing the top element all the way down to a
+// leaf, always promoting the greatest child, and returns its index. This
+// takes D - 1 comparisons per level rather than D (Floyd's heapsort
+// optimisation); the caller then sifts the element placed into the hole up,
+// which rarely has far to go.
+template <std::size_t D, typename I, typename Comp, typename Proj>
+constexpr iter_difference_t<I> floyd_sift_down_d(I first,
+                                                 iter_difference_t<I> n,
+                                                 Comp& comp, Proj& proj)
+{
+    using diff_t = iter_difference_t<I>;
+    constexpr auto d = static_cast<diff_t>(D);
+
+    diff_t hole = 0;
+    while (hole <= (n - 2) / d) {
+        const diff_t child =
+            detail::greatest_child_d<D>(first, hole, n, comp, proj);
+        *(first + hole) = nano::iter_move(first + child);
+        hole = child;
+    }
+    return hole;
+}
+
 } // namespace detail
 
 NANO_END_NAMESPACE
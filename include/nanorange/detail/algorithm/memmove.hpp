@@ -0,0 +1,108 @@
+// nanorange/detail/algorithm/memmove.hpp
+//
+// Copyright (c) 2020 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_DETAIL_ALGORITHM_MEMMOVE_HPP_INCLUDED
+#define NANORANGE_DETAIL_ALGORITHM_MEMMOVE_HPP_INCLUDED
+
+#include <nanorange/detail/algorithm/result_types.hpp>
+#include <nanorange/iterator/concepts.hpp>
+
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+NANO_BEGIN_NAMESPACE
+
+namespace detail {
+
+template <typename T>
+inline constexpr bool is_char_type =
+    same_as<T, char> || same_as<T, wchar_t> || same_as<T, char16_t> ||
+    same_as<T, char32_t>;
+
+// Pre-C++20 standard libraries don't tag their iterators as contiguous, so in
+// addition to the contiguous_iterator concept we recognise the iterators of
+// vector and string directly.
+template <typename I, typename V>
+constexpr bool is_std_contiguous_iterator_of()
+{
+    constexpr bool is_vector_iter =
+        !same_as<V, bool> &&
+        (same_as<I, typename std::vector<V>::iterator> ||
+         same_as<I, typename std::vector<V>::const_iterator>);
+
+    if constexpr (is_char_type<V>) {
+        return is_vector_iter ||
+               same_as<I, typename std::basic_string<V>::iterator> ||
+               same_as<I, typename std::basic_string<V>::const_iterator>;
+    } else {
+        return is_vector_iter;
+    }
+}
+
+template <typename I, typename = void>
+inline constexpr bool is_std_contiguous_iterator = false;
+
+template <typename I>
+inline constexpr bool is_std_contiguous_iterator<
+    I, std::enable_if_t<std::is_trivially_copyable<iter_value_t<I>>::value>> =
+    is_std_contiguous_iterator_of<I, iter_value_t<I>>();
+
+template <typename I>
+NANO_CONCEPT known_contiguous_iterator =
+    contiguous_iterator<I> || is_std_contiguous_iterator<I>;
+
+// Whether copying (or moving, if Move is true) from [I, S) to O can be done
+// with a single memmove, because both are contiguous ranges of the same
+// trivially assignable type. Volatile elements must be accessed one by one.
+template <typename I, typename S, typename O, bool Move = false,
+          typename = void>
+inline constexpr bool is_memmove_assignable = false;
+
+template <typename I, typename S, typename O, bool Move>
+inline constexpr bool is_memmove_assignable<
+    I, S, O, Move,
+    std::enable_if_t<known_contiguous_iterator<I> &&
+                     known_contiguous_iterator<O> &&
+                     sized_sentinel_for<S, I>>> =
+    same_as<iter_value_t<I>, iter_value_t<O>> &&
+    std::is_lvalue_reference<iter_reference_t<I>>::value &&
+    !std::is_volatile<std::remove_reference_t<iter_reference_t<I>>>::value &&
+    !std::is_volatile<std::remove_reference_t<iter_reference_t<O>>>::value &&
+    same_as<remove_cvref_t<iter_reference_t<I>>, iter_value_t<I>> &&
+    same_as<iter_reference_t<O>, iter_value_t<O>&> &&
+    (Move ? std::is_trivially_move_assignable<iter_value_t<O>>::value
+          : std::is_trivially_copy_assignable<iter_value_t<O>>::value);
+
+// Copies n elements starting at first to the range starting at result
+template <typename I, typename O>
+in_out_result<I, O> memmove_forward(I first, iter_difference_t<I> n, O result)
+{
+    if (n > 0) {
+        std::memmove(std::addressof(*result), std::addressof(*first),
+                     static_cast<std::size_t>(n) * sizeof(iter_value_t<I>));
+    }
+    return {first + n, result + n};
+}
+
+// Copies n elements starting at first to the range ending at result
+template <typename I, typename O>
+in_out_result<I, O> memmove_backward(I first, iter_difference_t<I> n, O result)
+{
+    if (n > 0) {
+        result -= n;
+        std::memmove(std::addressof(*result), std::addressof(*first),
+                     static_cast<std::size_t>(n) * sizeof(iter_value_t<I>));
+    }
+    return {first + n, result};
+}
+
+} // namespace detail
+
+NANO_END_NAMESPACE
+
+#endif
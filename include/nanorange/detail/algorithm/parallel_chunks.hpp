@@ -0,0 +1,98 @@
+// nanorange/detail/algorithm/parallel_chunks.hpp
+//
+// Copyright (c) 2020 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_DETAIL_ALGORITHM_PARALLEL_CHUNKS_HPP_INCLUDED
+#define NANORANGE_DETAIL_ALGORITHM_PARALLEL_CHUNKS_HPP_INCLUDED
+
+#include <nanorange/detail/algorithm/memmove.hpp>
+#include <nanorange/execution/policy.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+NANO_BEGIN_NAMESPACE
+
+namespace detail {
+
+// When the elements written are contiguous, chunks start on boundaries of
+// this many bytes, so that no two tasks write to the same cache line
+constexpr std::size_t parallel_cache_line_size = 64;
+
+// The smallest chunk used by the element-wise parallel algorithms, unless
+// the policy sets a grain size
+constexpr std::size_t parallel_chunk_grain_size = 1 << 14;
+
+// Calls f(lo, hi) for consecutive ranges of indices [lo, hi) which together
+// make up [0, n), as tasks on the policy's executor. out is the start of the
+// elements which the calls write to. Returns once every call has finished,
+// and then rethrows the first exception (if any) that one of them threw.
+template <typename I, typename F>
+void parallel_chunks(const parallel_policy& policy, const I& out,
+                     iter_difference_t<I> n, F& f)
+{
+    using D = iter_difference_t<I>;
+
+    executor& ex = policy.get_executor();
+    const std::size_t grain = policy.grain_size() > 0
+                                  ? policy.grain_size()
+                                  : parallel_chunk_grain_size;
+
+    if (ex.concurrency() == 1 || static_cast<std::size_t>(n) <= grain) {
+        f(D{0}, n);
+        return;
+    }
+
+    // Aim for a few chunks per thread, so that idle threads can steal work
+    D chunk = n / static_cast<D>(4 * ex.concurrency());
+    if (chunk < static_cast<D>(grain)) {
+        chunk = static_cast<D>(grain);
+    }
+
+    // The first chunk runs up to the first cache line boundary past its
+    // nominal end, and the rest are whole numbers of cache lines long
+    D head = 0;
+    if constexpr (known_contiguous_iterator<I>) {
+        using T = iter_value_t<I>;
+        if constexpr (parallel_cache_line_size % sizeof(T) == 0) {
+            constexpr D per_line =
+                static_cast<D>(parallel_cache_line_size / sizeof(T));
+            chunk = (chunk + per_line - 1) / per_line * per_line;
+
+            const auto offset = reinterpret_cast<std::uintptr_t>(
+                                    std::addressof(*out)) %
+                                parallel_cache_line_size;
+            if (offset % sizeof(T) == 0) {
+                head = static_cast<D>(
+                    (parallel_cache_line_size - offset) %
+                    parallel_cache_line_size / sizeof(T));
+            }
+        }
+    }
+
+    // The whole range fits before the first boundary
+    if (n <= head) {
+        f(D{0}, n);
+        return;
+    }
+
+    const D num_chunks = (n - head + chunk - 1) / chunk;
+
+    auto run = [&](std::ptrdiff_t k) {
+        const D idx = static_cast<D>(k);
+        const D lo = idx == 0 ? D{0} : head + idx * chunk;
+        const D hi = idx + 1 == num_chunks ? n : head + (idx + 1) * chunk;
+        f(lo, hi);
+    };
+
+    detail::parallel_for(ex, static_cast<std::ptrdiff_t>(num_chunks), run);
+}
+
+} // namespace detail
+
+NANO_END_NAMESPACE
+
+#endif
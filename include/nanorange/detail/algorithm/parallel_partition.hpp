@@ -0,0 +1,352 @@
+// nanorange/detail/algorithm/parallel_partition.hpp
+//
+// Copyright (c) 2020 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_DETAIL_ALGORITHM_PARALLEL_PARTITION_HPP_INCLUDED
+#define NANORANGE_DETAIL_ALGORITHM_PARALLEL_PARTITION_HPP_INCLUDED
+
+#include <nanorange/algorithm/max.hpp>
+#include <nanorange/algorithm/min.hpp>
+#include <nanorange/algorithm/swap_ranges.hpp>
+#include <nanorange/detail/algorithm/result_types.hpp>
+#include <nanorange/execution/policy.hpp>
+#include <nanorange/memory/destroy.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+NANO_BEGIN_NAMESPACE
+
+namespace detail {
+
+// Each task of the parallel partitioning algorithms handles at least this
+// many elements, unless the policy sets a grain size
+constexpr std::ptrdiff_t parallel_partition_grain_size = 1 << 14;
+
+inline std::ptrdiff_t parallel_partition_grain(const parallel_policy& policy)
+{
+    return policy.grain_size() > 0
+               ? static_cast<std::ptrdiff_t>(policy.grain_size())
+               : parallel_partition_grain_size;
+}
+
+// The number of blocks into which the parallel partitioning algorithms split
+// n elements: a few per thread, so that idle threads can steal work, but
+// none smaller than grain. Less than two means the work isn't worth
+// splitting.
+template <typename D>
+D parallel_partition_blocks(D n, std::ptrdiff_t grain, const executor& ex)
+{
+    if (ex.concurrency() == 1) {
+        return 1;
+    }
+    return (nano::min)(n / static_cast<D>(grain),
+                       static_cast<D>(4 * ex.concurrency()));
+}
+
+// Partitions [first, last) by swapping the first element which fails pred
+// with the last which satisfies it until the two scans meet, which swaps
+// only the elements that are out of place
+template <typename I, typename Pred, typename Proj>
+I hoare_partition(I first, I last, Pred& pred, Proj& proj)
+{
+    while (true) {
+        while (true) {
+            if (first == last) {
+                return first;
+            }
+            if (!nano::invoke(pred, nano::invoke(proj, *first))) {
+                break;
+            }
+            ++first;
+        }
+        do {
+            --last;
+            if (first == last) {
+                return first;
+            }
+        } while (!nano::invoke(pred, nano::invoke(proj, *last)));
+        nano::iter_swap(first, last);
+        ++first;
+    }
+}
+
+// Partitions [first, first + n) so that the elements satisfying pred come
+// first, and returns the partition point. The range is split into blocks
+// which are partitioned concurrently. The elements then on the wrong side of
+// the overall partition point form two sets of runs of equal total length,
+// which are swapped with each other, again concurrently. The relative order
+// of elements is not preserved.
+template <typename I, typename Pred, typename Proj>
+I parallel_partition(I first, iter_difference_t<I> n, Pred& pred, Proj& proj,
+                     executor& ex,
+                     std::ptrdiff_t grain = parallel_partition_grain_size)
+{
+    using D = iter_difference_t<I>;
+
+    const D num_blocks = detail::parallel_partition_blocks(n, grain, ex);
+
+    if (num_blocks < 2) {
+        return detail::hoare_partition(first, first + n, pred, proj);
+    }
+
+    const auto block_begin = [n, num_blocks](D k) {
+        return k * n / num_blocks;
+    };
+
+    // First pass: the position of the partition point within each block
+    std::vector<D> mids(static_cast<std::size_t>(num_blocks));
+    auto partition_block = [&](std::ptrdiff_t k) {
+        const D begin = block_begin(static_cast<D>(k));
+        const D end = block_begin(static_cast<D>(k) + 1);
+        mids[static_cast<std::size_t>(k)] =
+            detail::hoare_partition(first + begin, first + end, pred, proj) -
+            first;
+    };
+    detail::parallel_for(ex, static_cast<std::ptrdiff_t>(num_blocks),
+                         partition_block);
+
+    D split = 0;
+    for (D k = 0; k < num_blocks; ++k) {
+        split += mids[static_cast<std::size_t>(k)] - block_begin(k);
+    }
+
+    // The runs of each block which lie on the wrong side of split, in order,
+    // with the number of misplaced elements before each
+    struct run {
+        D begin;
+        D end;
+        D offset;
+    };
+    std::vector<run> left, right;
+    D misplaced = 0;
+    for (D k = 0; k < num_blocks; ++k) {
+        const D lo = mids[static_cast<std::size_t>(k)];
+        const D hi = (nano::min)(block_begin(k + 1), split);
+        if (lo < hi) {
+            left.push_back({lo, hi, misplaced});
+            misplaced += hi - lo;
+        }
+    }
+    D count = 0;
+    for (D k = 0; k < num_blocks; ++k) {
+        const D lo = (nano::max)(block_begin(k), split);
+        const D hi = mids[static_cast<std::size_t>(k)];
+        if (lo < hi) {
+            right.push_back({lo, hi, count});
+            count += hi - lo;
+        }
+    }
+
+    if (misplaced == 0) {
+        return first + split;
+    }
+
+    // Second pass: swap the i-th misplaced element on the left with the i-th
+    // on the right, for each i in a share of [0, misplaced)
+    const D num_tasks = (nano::min)(
+        num_blocks,
+        (misplaced + static_cast<D>(grain) - 1) / static_cast<D>(grain));
+
+    const auto find_run = [](const std::vector<run>& runs, D i) {
+        return std::upper_bound(runs.begin(), runs.end(), i,
+                                [](D j, const run& r) {
+                                    return j < r.offset;
+                                }) -
+               1;
+    };
+
+    auto swap_share = [&](std::ptrdiff_t t) {
+        D i = static_cast<D>(t) * misplaced / num_tasks;
+        const D end = (static_cast<D>(t) + 1) * misplaced / num_tasks;
+        auto l = find_run(left, i);
+        auto r = find_run(right, i);
+        D l_pos = l->begin + (i - l->offset);
+        D r_pos = r->begin + (i - r->offset);
+
+        while (i < end) {
+            const D step = (nano::min)(
+                {end - i, l->end - l_pos, r->end - r_pos});
+            nano::swap_ranges(first + l_pos, first + (l_pos + step),
+                              first + r_pos, first + (r_pos + step));
+            i += step;
+            l_pos += step;
+            r_pos += step;
+            if (l_pos == l->end && i < end) {
+                l_pos = (++l)->begin;
+            }
+            if (r_pos == r->end && i < end) {
+                r_pos = (++r)->begin;
+            }
+        }
+    };
+    detail::parallel_for(ex, static_cast<std::ptrdiff_t>(num_tasks),
+                         swap_share);
+
+    return first + split;
+}
+
+// Evaluates pred for each element of [first, first + n), split into
+// num_blocks blocks as in parallel_partition(), storing the results in
+// flags. Returns the number of elements satisfying pred in each block.
+template <typename I, typename Pred, typename Proj>
+std::vector<iter_difference_t<I>>
+parallel_partition_flags(I first, iter_difference_t<I> n,
+                         iter_difference_t<I> num_blocks,
+                         std::vector<unsigned char>& flags, Pred& pred,
+                         Proj& proj, executor& ex)
+{
+    using D = iter_difference_t<I>;
+
+    flags.resize(static_cast<std::size_t>(n));
+    std::vector<D> counts(static_cast<std::size_t>(num_blocks));
+
+    auto flag_block = [&](std::ptrdiff_t k) {
+        const D begin = static_cast<D>(k) * n / num_blocks;
+        const D end = (static_cast<D>(k) + 1) * n / num_blocks;
+        D count = 0;
+        for (D i = begin; i != end; ++i) {
+            const bool flag = nano::invoke(pred, nano::invoke(proj, first[i]));
+            flags[static_cast<std::size_t>(i)] = flag;
+            count += flag;
+        }
+        counts[static_cast<std::size_t>(k)] = count;
+    };
+    detail::parallel_for(ex, static_cast<std::ptrdiff_t>(num_blocks),
+                         flag_block);
+
+    return counts;
+}
+
+// Copies the elements of [first, first + n) which satisfy pred to out_true
+// and the others to out_false, as partition_copy() does. A first pass counts
+// the elements satisfying pred in each block, and from those counts a second
+// pass knows where each block's elements go, so both passes run
+// concurrently.
+template <typename I, typename O1, typename O2, typename Pred, typename Proj>
+in_out_out_result<I, O1, O2>
+parallel_partition_copy(I first, iter_difference_t<I> n, O1 out_true,
+                        O2 out_false, Pred& pred, Proj& proj,
+                        executor& ex, std::ptrdiff_t grain)
+{
+    using D = iter_difference_t<I>;
+
+    const D num_blocks = detail::parallel_partition_blocks(n, grain, ex);
+
+    if (num_blocks < 2) {
+        for (D i = 0; i != n; ++i) {
+            auto&& val = first[i];
+            if (nano::invoke(pred, nano::invoke(proj, val))) {
+                *out_true = std::forward<decltype(val)>(val);
+                ++out_true;
+            } else {
+                *out_false = std::forward<decltype(val)>(val);
+                ++out_false;
+            }
+        }
+        return {first + n, std::move(out_true), std::move(out_false)};
+    }
+
+    std::vector<unsigned char> flags;
+    std::vector<D> trues = detail::parallel_partition_flags(
+        first, n, num_blocks, flags, pred, proj, ex);
+
+    // Turn the counts into the offsets at which each block's elements go
+    D total = 0;
+    for (D& count : trues) {
+        total += std::exchange(count, total);
+    }
+
+    auto copy_block = [&](std::ptrdiff_t k) {
+        const D begin = static_cast<D>(k) * n / num_blocks;
+        const D end = (static_cast<D>(k) + 1) * n / num_blocks;
+        D t = trues[static_cast<std::size_t>(k)];
+        D f = begin - t;
+        for (D i = begin; i != end; ++i) {
+            if (flags[static_cast<std::size_t>(i)]) {
+                out_true[static_cast<iter_difference_t<O1>>(t++)] = first[i];
+            } else {
+                out_false[static_cast<iter_difference_t<O2>>(f++)] = first[i];
+            }
+        }
+    };
+    detail::parallel_for(ex, static_cast<std::ptrdiff_t>(num_blocks),
+                         copy_block);
+
+    return {first + n, out_true + static_cast<iter_difference_t<O1>>(total),
+            out_false + static_cast<iter_difference_t<O2>>(n - total)};
+}
+
+// Whether parallel_stable_partition() can be used with I: it moves every
+// element out to a buffer and back again, and can't put the range back
+// together if one of those moves throws
+template <typename I>
+constexpr bool parallel_stable_partitionable =
+    std::is_nothrow_constructible<iter_value_t<I>,
+                                  iter_rvalue_reference_t<I>>::value &&
+    std::is_nothrow_assignable<iter_reference_t<I>, iter_value_t<I>&&>::value;
+
+// Partitions [first, first + n) as stable_partition() does, using buf, which
+// must be uninitialised storage for n elements. After counting the elements
+// which satisfy pred in each block, every block moves its elements to their
+// final positions in buf, and then they are moved back, both concurrently.
+// pred is applied to each element once.
+template <typename I, typename Pred, typename Proj>
+I parallel_stable_partition(I first, iter_difference_t<I> n,
+                            iter_value_t<I>* buf, Pred& pred, Proj& proj,
+                            executor& ex, std::ptrdiff_t grain)
+{
+    using D = iter_difference_t<I>;
+    using T = iter_value_t<I>;
+
+    const D num_blocks = (nano::max)(
+        detail::parallel_partition_blocks(n, grain, ex), D{1});
+
+    std::vector<unsigned char> flags;
+    std::vector<D> trues = detail::parallel_partition_flags(
+        first, n, num_blocks, flags, pred, proj, ex);
+
+    D total = 0;
+    for (D& count : trues) {
+        total += std::exchange(count, total);
+    }
+
+    // The moves below can't throw, so every element makes it back
+    auto scatter_block = [&](std::ptrdiff_t k) {
+        const D begin = static_cast<D>(k) * n / num_blocks;
+        const D end = (static_cast<D>(k) + 1) * n / num_blocks;
+        D t = trues[static_cast<std::size_t>(k)];
+        D f = total + begin - t;
+        for (D i = begin; i != end; ++i) {
+            const D pos = flags[static_cast<std::size_t>(i)] ? t++ : f++;
+            ::new (static_cast<void*>(buf + pos)) T(nano::iter_move(first + i));
+        }
+    };
+    detail::parallel_for(ex, static_cast<std::ptrdiff_t>(num_blocks),
+                         scatter_block);
+
+    auto gather_block = [&](std::ptrdiff_t k) {
+        const D begin = static_cast<D>(k) * n / num_blocks;
+        const D end = (static_cast<D>(k) + 1) * n / num_blocks;
+        for (D i = begin; i != end; ++i) {
+            first[i] = std::move(buf[i]);
+        }
+        nano::destroy(buf + begin, buf + end);
+    };
+    detail::parallel_for(ex, static_cast<std::ptrdiff_t>(num_blocks),
+                         gather_block);
+
+    return first + total;
+}
+
+} // namespace detail
+
+NANO_END_NAMESPACE
+
+#endif
@@ -0,0 +1,92 @@
+// nanorange/detail/algorithm/parallel_pdqselect.hpp
+//
+// Copyright (c) 2020 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_DETAIL_ALGORITHM_PARALLEL_PDQSELECT_HPP_INCLUDED
+#define NANORANGE_DETAIL_ALGORITHM_PARALLEL_PDQSELECT_HPP_INCLUDED
+
+#include <nanorange/detail/algorithm/parallel_partition.hpp>
+#include <nanorange/detail/algorithm/pdqselect.hpp>
+
+NANO_BEGIN_NAMESPACE
+
+namespace detail {
+
+// Ranges smaller than this are finished by the sequential pdqselect(),
+// unless the policy sets a grain size, in which case those too small to be
+// partitioned as two blocks of that size are
+constexpr std::ptrdiff_t parallel_pdqselect_grain_size = 1 << 16;
+
+// As pdqselect(), except that while the range holding nth is large, each
+// partition step is a parallel_partition() around the pdqsort pivot.
+template <typename I, typename Comp, typename Proj>
+void parallel_pdqselect(I begin, I nth, I end, Comp& comp, Proj& proj,
+                        const parallel_policy& policy)
+{
+    using diff_t = iter_difference_t<I>;
+
+    executor& ex = policy.get_executor();
+    const std::ptrdiff_t grain = detail::parallel_partition_grain(policy);
+    const auto cutoff = static_cast<diff_t>(
+        policy.grain_size() > 0 ? 2 * grain : parallel_pdqselect_grain_size);
+
+    int bad_allowed = pdqselect_bad_partition_limit;
+
+    while (nth != end && end - begin >= cutoff && ex.concurrency() > 1) {
+        const diff_t size = end - begin;
+
+        // The pivot stays at *begin, out of the way of the partitions
+        pdqsort_choose_pivot(begin, end, size, comp, proj);
+        auto&& pivot = nano::invoke(proj, *begin);
+
+        auto less_than_pivot = [&comp, &pivot](auto&& x) {
+            return nano::invoke(comp, std::forward<decltype(x)>(x), pivot);
+        };
+        I mid = detail::parallel_partition(begin + 1, size - 1,
+                                           less_than_pivot, proj, ex, grain);
+
+        // Only a few elements less than the pivot suggests that many are
+        // equal to it, so split those off too before narrowing to the right
+        I equal_end = mid;
+        if (nth >= mid && mid - begin < size / 8) {
+            auto not_greater_than_pivot = [&comp, &pivot](auto&& x) {
+                return !nano::invoke(comp, pivot,
+                                     std::forward<decltype(x)>(x));
+            };
+            equal_end = detail::parallel_partition(
+                mid, end - mid, not_greater_than_pivot, proj, ex, grain);
+        }
+
+        // [begin, pivot_pos) < pivot == [pivot_pos, equal_end)
+        I pivot_pos = mid - 1;
+        nano::iter_swap(begin, pivot_pos);
+        if (pivot_pos <= nth && nth < equal_end) {
+            return;
+        }
+
+        const diff_t l_size = pivot_pos - begin;
+        const diff_t r_size = end - equal_end;
+
+        if (nth < pivot_pos) {
+            end = pivot_pos;
+        } else {
+            begin = equal_end;
+        }
+
+        // Leave repeated bad pivots to the sequential fallback
+        if ((l_size < size / 8 || r_size < size / 8) && --bad_allowed == 0) {
+            break;
+        }
+    }
+
+    detail::pdqselect(std::move(begin), std::move(nth), std::move(end), comp,
+                      proj);
+}
+
+} // namespace detail
+
+NANO_END_NAMESPACE
+
+#endif
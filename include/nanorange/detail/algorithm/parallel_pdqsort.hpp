@@ -0,0 +1,130 @@
+// nanorange/detail/algorithm/parallel_pdqsort.hpp
+//
+// Copyright (c) 2020 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_DETAIL_ALGORITHM_PARALLEL_PDQSORT_HPP_INCLUDED
+#define NANORANGE_DETAIL_ALGORITHM_PARALLEL_PDQSORT_HPP_INCLUDED
+
+#include <nanorange/detail/algorithm/pdqsort.hpp>
+#include <nanorange/execution/policy.hpp>
+#include <nanorange/execution/executor.hpp>
+
+#include <algorithm>
+
+NANO_BEGIN_NAMESPACE
+
+namespace detail {
+
+// Partitions smaller than this are sorted sequentially rather than being
+// split further, unless the policy sets a grain size
+constexpr std::ptrdiff_t parallel_pdqsort_grain_size = 1 << 14;
+
+// The policy's grain size, if any, but never so small that partitions reach
+// pdqsort_loop()'s insertion sort cutoff before being handed to it
+inline std::ptrdiff_t parallel_pdqsort_grain(const parallel_policy& policy)
+{
+    if (policy.grain_size() == 0) {
+        return parallel_pdqsort_grain_size;
+    }
+    return std::max(static_cast<std::ptrdiff_t>(policy.grain_size()),
+                    static_cast<std::ptrdiff_t>(pdqsort_insertion_sort_threshold));
+}
+
+// This is pdqsort_loop(), except that rather than recursing into the left-hand
+// partition we fork it as a new task in group. Each task owns a disjoint
+// subrange, so the only element shared between tasks is the pivot at
+// *(begin - 1), which is read but never written once it is in place.
+template <bool Branchless, typename I, typename Comp, typename Proj>
+void parallel_pdqsort_loop(I begin, I end, Comp& comp, Proj& proj,
+                           int bad_allowed, bool leftmost, executor& ex,
+                           std::ptrdiff_t grain, task_group& group)
+{
+    using diff_t = iter_difference_t<I>;
+
+    while (true) {
+        diff_t size = end - begin;
+
+        if (size < grain) {
+            detail::pdqsort_loop<Branchless>(begin, end, comp, proj,
+                                             bad_allowed, leftmost);
+            return;
+        }
+
+        pdqsort_choose_pivot(begin, end, size, comp, proj);
+
+        if (!leftmost && !nano::invoke(comp, nano::invoke(proj, *(begin - 1)),
+                                       nano::invoke(proj, *begin))) {
+            begin = partition_left(begin, end, comp, proj) + 1;
+            continue;
+        }
+
+        std::pair<I, bool> part_result =
+            Branchless ? partition_right_branchless(begin, end, comp, proj)
+                       : partition_right(begin, end, comp, proj);
+        I pivot_pos = part_result.first;
+        bool already_partitioned = part_result.second;
+
+        diff_t l_size = pivot_pos - begin;
+        diff_t r_size = end - (pivot_pos + 1);
+        bool highly_unbalanced = l_size < size / 8 || r_size < size / 8;
+
+        if (highly_unbalanced) {
+            if (--bad_allowed == 0) {
+                nano::make_heap(begin, end, comp, proj);
+                nano::sort_heap(begin, end, comp, proj);
+                return;
+            }
+
+            pdqsort_break_patterns(begin, pivot_pos, end);
+        } else {
+            if (already_partitioned &&
+                partial_insertion_sort(begin, pivot_pos, comp, proj) &&
+                partial_insertion_sort(pivot_pos + 1, end, comp, proj))
+                return;
+        }
+
+        ex.fork(group, [begin, pivot_pos, &comp, &proj, bad_allowed,
+                        leftmost, &ex, grain, &group] {
+            detail::parallel_pdqsort_loop<Branchless>(
+                begin, pivot_pos, comp, proj, bad_allowed, leftmost, ex,
+                grain, group);
+        });
+        begin = pivot_pos + 1;
+        leftmost = false;
+    }
+}
+
+template <typename I, typename Comp, typename Proj,
+          bool Branchless = is_default_compare_v<std::remove_const_t<Comp>>&&
+              same_as<Proj, identity>&& std::is_arithmetic<iter_value_t<I>>::value>
+void parallel_pdqsort(I begin, I end, Comp& comp, Proj& proj,
+                      executor& ex, std::ptrdiff_t grain)
+{
+    const auto size = end - begin;
+
+    if (size < grain || ex.concurrency() == 1) {
+        detail::pdqsort(std::move(begin), std::move(end), comp, proj);
+        return;
+    }
+
+    task_group group;
+    try {
+        detail::parallel_pdqsort_loop<Branchless>(
+            std::move(begin), std::move(end), comp, proj, detail::log2(size),
+            true, ex, grain, group);
+    } catch (...) {
+        // Outstanding tasks refer to comp, proj and group, so they must
+        // finish before we unwind
+        ex.wait(group);
+        throw;
+    }
+    ex.join(group);
+}
+
+} // namespace detail
+
+NANO_END_NAMESPACE
+
+#endif
@@ -0,0 +1,168 @@
+// nanorange/detail/algorithm/pdqselect.hpp
+//
+// Copyright (c) 2020 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_DETAIL_ALGORITHM_PDQSELECT_HPP_INCLUDED
+#define NANORANGE_DETAIL_ALGORITHM_PDQSELECT_HPP_INCLUDED
+
+#include <nanorange/detail/algorithm/pdqsort.hpp>
+
+NANO_BEGIN_NAMESPACE
+
+namespace detail {
+
+// The number of highly unbalanced partitions pdqselect_loop() tolerates before
+// switching to median_of_medians_select(). Every other partition shrinks the
+// range by at least an eighth, so a constant limit keeps the total work
+// linear in the worst case.
+constexpr int pdqselect_bad_partition_limit = 4;
+
+// Rearranges [begin, end) so that *nth is the element that would be there if
+// the range were sorted, using the median of the medians of groups of five as
+// the pivot. This is slower than pdqselect_loop() on typical inputs, but runs
+// in linear time on any input. If leftmost is false, *(begin - 1) must be no
+// greater than any element of [begin, end).
+template <typename I, typename Comp, typename Proj>
+constexpr void median_of_medians_select(I begin, I nth, I end, Comp& comp,
+                                        Proj& proj, bool leftmost = true)
+{
+    while (end - begin >= pdqsort_insertion_sort_threshold) {
+        // Gather the median of each group of five at the front...
+        I medians = begin;
+        for (I group = begin; end - group >= 5; group += 5) {
+            detail::insertion_sort(group, group + 5, comp, proj);
+            nano::iter_swap(medians, group + 2);
+            ++medians;
+        }
+
+        // ...and select their median as the pivot. At least three tenths of
+        // the range lies on either side of it.
+        I mid = begin + (medians - begin) / 2;
+        detail::median_of_medians_select(begin, mid, medians, comp, proj);
+        nano::iter_swap(begin, mid);
+
+        // As in pdqsort_loop(), a pivot equal to the element before the range
+        // means that the range is full of equal elements
+        if (!leftmost && !nano::invoke(comp, nano::invoke(proj, *(begin - 1)),
+                                       nano::invoke(proj, *begin))) {
+            begin = detail::partition_left(begin, end, comp, proj) + 1;
+            if (nth < begin) {
+                return;
+            }
+            continue;
+        }
+
+        I pivot_pos = detail::partition_right(begin, end, comp, proj).first;
+        if (pivot_pos == nth) {
+            return;
+        }
+
+        if (nth < pivot_pos) {
+            end = pivot_pos;
+        } else {
+            begin = pivot_pos + 1;
+            leftmost = false;
+        }
+    }
+
+    if (leftmost) {
+        detail::insertion_sort(begin, end, comp, proj);
+    } else {
+        detail::unguarded_insertion_sort(begin, end, comp, proj);
+    }
+}
+
+// Quickselect using the pivot selection and partitioning of pdqsort_loop(),
+// narrowing into whichever side of each pivot holds nth.
+template <bool Branchless, typename I, typename Comp, typename Proj>
+constexpr void pdqselect_loop(I begin, I nth, I end, Comp& comp, Proj& proj,
+                              int bad_allowed, bool leftmost = true)
+{
+    using diff_t = iter_difference_t<I>;
+
+    while (true) {
+        diff_t size = end - begin;
+
+        if (size < pdqsort_insertion_sort_threshold) {
+            if (leftmost) {
+                insertion_sort(begin, end, comp, proj);
+            } else {
+                unguarded_insertion_sort(begin, end, comp, proj);
+            }
+            return;
+        }
+
+        pdqsort_choose_pivot(begin, end, size, comp, proj);
+
+        // Every element of [begin, partition_left()] is equal to the pivot,
+        // so we are done if nth lies among them
+        if (!leftmost && !nano::invoke(comp, nano::invoke(proj, *(begin - 1)),
+                                       nano::invoke(proj, *begin))) {
+            begin = partition_left(begin, end, comp, proj) + 1;
+            if (nth < begin) {
+                return;
+            }
+            continue;
+        }
+
+        std::pair<I, bool> part_result =
+            Branchless ? partition_right_branchless(begin, end, comp, proj)
+                       : partition_right(begin, end, comp, proj);
+        I pivot_pos = part_result.first;
+        bool already_partitioned = part_result.second;
+
+        if (pivot_pos == nth) {
+            return;
+        }
+
+        diff_t l_size = pivot_pos - begin;
+        diff_t r_size = end - (pivot_pos + 1);
+        bool highly_unbalanced = l_size < size / 8 || r_size < size / 8;
+
+        if (highly_unbalanced) {
+            if (--bad_allowed == 0) {
+                detail::median_of_medians_select(begin, nth, end, comp, proj,
+                                                 leftmost);
+                return;
+            }
+
+            pdqsort_break_patterns(begin, pivot_pos, end);
+        } else if (already_partitioned) {
+            // Only the side holding nth needs to be in order
+            if (nth < pivot_pos
+                    ? partial_insertion_sort(begin, pivot_pos, comp, proj)
+                    : partial_insertion_sort(pivot_pos + 1, end, comp, proj)) {
+                return;
+            }
+        }
+
+        if (nth < pivot_pos) {
+            end = pivot_pos;
+        } else {
+            begin = pivot_pos + 1;
+            leftmost = false;
+        }
+    }
+}
+
+template <typename I, typename Comp, typename Proj,
+          bool Branchless = is_default_compare_v<std::remove_const_t<Comp>>&&
+              same_as<Proj, identity>&& std::is_arithmetic<iter_value_t<I>>::value>
+constexpr void pdqselect(I begin, I nth, I end, Comp& comp, Proj& proj)
+{
+    if (nth == end) {
+        return;
+    }
+
+    detail::pdqselect_loop<Branchless>(std::move(begin), std::move(nth),
+                                       std::move(end), comp, proj,
+                                       pdqselect_bad_partition_limit);
+}
+
+} // namespace detail
+
+NANO_END_NAMESPACE
+
+#endif
@@ -527,6 +527,57 @@ constexpr I partition_left(I begin, I end, Comp& comp, Proj& proj)
     return pivot_pos;
 }
 
+// Chooses a pivot for [begin, end) as the median of 3 or the pseudomedian of 9
+// elements, and moves it to *begin.
+template <typename I, typename Comp, typename Proj>
+constexpr void pdqsort_choose_pivot(I begin, I end, iter_difference_t<I> size,
+                                    Comp& comp, Proj& proj)
+{
+    iter_difference_t<I> s2 = size / 2;
+    if (size > pdqsort_ninther_threshold) {
+        sort3(begin, begin + s2, end - 1, comp, proj);
+        sort3(begin + 1, begin + (s2 - 1), end - 2, comp, proj);
+        sort3(begin + 2, begin + (s2 + 1), end - 3, comp, proj);
+        sort3(begin + (s2 - 1), begin + s2, begin + (s2 + 1), comp, proj);
+        nano::iter_swap(begin, begin + s2);
+    } else {
+        sort3(begin + s2, begin, end - 1, comp, proj);
+    }
+}
+
+// After a highly unbalanced partition around pivot_pos, swaps some elements
+// of each side to break up the pattern which caused it.
+template <typename I>
+constexpr void pdqsort_break_patterns(I begin, I pivot_pos, I end)
+{
+    iter_difference_t<I> l_size = pivot_pos - begin;
+    iter_difference_t<I> r_size = end - (pivot_pos + 1);
+
+    if (l_size >= pdqsort_insertion_sort_threshold) {
+        nano::iter_swap(begin, begin + l_size / 4);
+        nano::iter_swap(pivot_pos - 1, pivot_pos - l_size / 4);
+
+        if (l_size > pdqsort_ninther_threshold) {
+            nano::iter_swap(begin + 1, begin + (l_size / 4 + 1));
+            nano::iter_swap(begin + 2, begin + (l_size / 4 + 2));
+            nano::iter_swap(pivot_pos - 2, pivot_pos - (l_size / 4 + 1));
+            nano::iter_swap(pivot_pos - 3, pivot_pos - (l_size / 4 + 2));
+        }
+    }
+
+    if (r_size >= pdqsort_insertion_sort_threshold) {
+        nano::iter_swap(pivot_pos + 1, pivot_pos + (1 + r_size / 4));
+        nano::iter_swap(end - 1, end - r_size / 4);
+
+        if (r_size > pdqsort_ninther_threshold) {
+            nano::iter_swap(pivot_pos + 2, pivot_pos + (2 + r_size / 4));
+            nano::iter_swap(pivot_pos + 3, pivot_pos + (3 + r_size / 4));
+            nano::iter_swap(end - 2, end - (1 + r_size / 4));
+            nano::iter_swap(end - 3, end - (2 + r_size / 4));
+        }
+    }
+}
+
 template <bool Branchless, typename I, typename Comp, typename Proj>
 constexpr void pdqsort_loop(I begin, I end, Comp& comp, Proj& proj,
                             int bad_allowed, bool leftmost = true)
@@ -547,17 +598,7 @@ constexpr void pdqsort_loop(I begin, I end, Comp& comp, Proj& proj,
             return;
         }
 
-        // Choose pivot as median of 3 or pseudomedian of 9.
-        diff_t s2 = size / 2;
-        if (size > pdqsort_ninther_threshold) {
-            sort3(begin, begin + s2, end - 1, comp, proj);
-            sort3(begin + 1, begin + (s2 - 1), end - 2, comp, proj);
-            sort3(begin + 2, begin + (s2 + 1), end - 3, comp, proj);
-            sort3(begin + (s2 - 1), begin + s2, begin + (s2 + 1), comp, proj);
-            nano::iter_swap(begin, begin + s2);
-        } else {
-            sort3(begin + s2, begin, end - 1, comp, proj);
-        }
+        pdqsort_choose_pivot(begin, end, size, comp, proj);
 
         // If *(begin - 1) is the end of the right partition of a previous
         // partition operation there is no element in [begin, end) that is
@@ -594,33 +635,7 @@ constexpr void pdqsort_loop(I begin, I end, Comp& comp, Proj& proj,
                 return;
             }
 
-            if (l_size >= pdqsort_insertion_sort_threshold) {
-                nano::iter_swap(begin, begin + l_size / 4);
-                nano::iter_swap(pivot_pos - 1, pivot_pos - l_size / 4);
-
-                if (l_size > pdqsort_ninther_threshold) {
-                    nano::iter_swap(begin + 1, begin + (l_size / 4 + 1));
-                    nano::iter_swap(begin + 2, begin + (l_size / 4 + 2));
-                    nano::iter_swap(pivot_pos - 2,
-                                    pivot_pos - (l_size / 4 + 1));
-                    nano::iter_swap(pivot_pos - 3,
-                                    pivot_pos - (l_size / 4 + 2));
-                }
-            }
-
-            if (r_size >= pdqsort_insertion_sort_threshold) {
-                nano::iter_swap(pivot_pos + 1, pivot_pos + (1 + r_size / 4));
-                nano::iter_swap(end - 1, end - r_size / 4);
-
-                if (r_size > pdqsort_ninther_threshold) {
-                    nano::iter_swap(pivot_pos + 2,
-                                    pivot_pos + (2 + r_size / 4));
-                    nano::iter_swap(pivot_pos + 3,
-                                    pivot_pos + (3 + r_size / 4));
-                    nano::iter_swap(end - 2, end - (1 + r_size / 4));
-                    nano::iter_swap(end - 3, end - (2 + r_size / 4));
-                }
-            }
+            pdqsort_break_patterns(begin, pivot_pos, end);
         } else {
             // If we were decently balanced and we tried to sort an already
             // partitioned sequence try to use insertion sort.
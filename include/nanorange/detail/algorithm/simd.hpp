@@ -0,0 +1,87 @@
+// nanorange/detail/algorithm/simd.hpp
+//
+// Copyright (c) 2020 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_DETAIL_ALGORITHM_SIMD_HPP_INCLUDED
+#define NANORANGE_DETAIL_ALGORITHM_SIMD_HPP_INCLUDED
+
+#include <nanorange/detail/macros.hpp>
+
+// Vectorised algorithm kernels are provided for x86 processors with SSE2.
+// Define NANORANGE_NO_SIMD to always use the generic implementations.
+#if !defined(NANORANGE_NO_SIMD) &&                                            \
+    (defined(__SSE2__) || defined(_M_X64) ||                                   \
+     (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define NANO_HAS_X86_SIMD 1
+#endif
+
+#ifdef NANO_HAS_X86_SIMD
+
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+// GCC and Clang need to be told that a function may use AVX2 instructions;
+// MSVC allows the intrinsics anywhere.
+#if defined(__GNUC__) || defined(__clang__)
+#define NANO_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define NANO_TARGET_AVX2
+#endif
+
+NANO_BEGIN_NAMESPACE
+
+namespace detail {
+
+// Whether the CPU we are running on (and the operating system) supports AVX2.
+// This is checked once and then cached.
+inline bool cpu_has_avx2() noexcept
+{
+#if defined(__AVX2__)
+    return true;
+#elif defined(_MSC_VER) && !defined(__clang__)
+    static const bool result = [] {
+        int info[4];
+        __cpuid(info, 0);
+        if (info[0] < 7) {
+            return false;
+        }
+        // The OS must save the YMM registers on a context switch
+        __cpuid(info, 1);
+        constexpr int osxsave_avx = (1 << 27) | (1 << 28);
+        if ((info[2] & osxsave_avx) != osxsave_avx ||
+            (_xgetbv(0) & 0x6) != 0x6) {
+            return false;
+        }
+        __cpuidex(info, 7, 0);
+        return (info[1] & (1 << 5)) != 0;
+    }();
+    return result;
+#else
+    static const bool result = __builtin_cpu_supports("avx2");
+    return result;
+#endif
+}
+
+// Index of the lowest set bit of a non-zero movemask result
+inline int simd_ctz(unsigned mask) noexcept
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    unsigned long idx;
+    _BitScanForward(&idx, mask);
+    return static_cast<int>(idx);
+#else
+    return __builtin_ctz(mask);
+#endif
+}
+
+} // namespace detail
+
+NANO_END_NAMESPACE
+
+#endif // NANO_HAS_X86_SIMD
+
+#endif
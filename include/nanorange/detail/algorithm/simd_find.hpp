@@ -0,0 +1,390 @@
+// nanorange/detail/algorithm/simd_find.hpp
+//
+// Copyright (c) 2020 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_DETAIL_ALGORITHM_SIMD_FIND_HPP_INCLUDED
+#define NANORANGE_DETAIL_ALGORITHM_SIMD_FIND_HPP_INCLUDED
+
+#include <nanorange/detail/algorithm/memmove.hpp>
+#include <nanorange/detail/algorithm/simd.hpp>
+#include <nanorange/detail/functional/identity.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+
+NANO_BEGIN_NAMESPACE
+
+namespace detail {
+
+template <typename T>
+inline constexpr bool is_simd_element =
+    (std::is_integral<T>::value &&
+     (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8)) ||
+    same_as<T, float> || same_as<T, double>;
+
+// Whether searching a range of V for a value of type T can be done by
+// comparing the bit patterns of elements. Mixed integer types are fine, since
+// the value is converted to V first; floating point values must match the
+// element type exactly.
+template <typename V, typename T>
+inline constexpr bool is_simd_find_value =
+    is_simd_element<V> &&
+    ((std::is_integral<V>::value && std::is_integral<T>::value) ||
+     same_as<V, T>);
+
+// Whether find(first, last, value, proj) and count() can use the vectorised
+// kernels below
+template <typename I, typename S, typename T, typename Proj,
+          typename = void>
+inline constexpr bool simd_findable = false;
+
+template <typename I, typename S, typename T, typename Proj>
+inline constexpr bool simd_findable<
+    I, S, T, Proj,
+    std::enable_if_t<known_contiguous_iterator<I> && sized_sentinel_for<S, I>>> =
+    same_as<Proj, identity> &&
+    std::is_lvalue_reference<iter_reference_t<I>>::value &&
+    !std::is_volatile<std::remove_reference_t<iter_reference_t<I>>>::value &&
+    same_as<remove_cvref_t<iter_reference_t<I>>, iter_value_t<I>> &&
+    is_simd_find_value<iter_value_t<I>, remove_cvref_t<T>>;
+
+#ifdef NANO_HAS_X86_SIMD
+
+// Unsigned integer type used to count matches in each lane
+template <typename T>
+using simd_lane_t = std::conditional_t<
+    sizeof(T) == 1, std::uint8_t,
+    std::conditional_t<sizeof(T) == 2, std::uint16_t,
+                       std::conditional_t<sizeof(T) == 4, std::uint32_t,
+                                          std::uint64_t>>>;
+
+// A lane counter can be incremented this many times before it might overflow
+template <typename T>
+constexpr std::ptrdiff_t simd_max_count_block = sizeof(T) == 1 ? 255 : 65535;
+
+template <typename T>
+std::size_t simd_sum_lanes(const void* acc, std::size_t bytes)
+{
+    simd_lane_t<T> lanes[32 / sizeof(T)];
+    std::memcpy(lanes, acc, bytes);
+    std::size_t sum = 0;
+    for (std::size_t i = 0; i < bytes / sizeof(T); i++) {
+        sum += lanes[i];
+    }
+    return sum;
+}
+
+// SSE2 ---------------------------------------------------------------------
+
+template <typename T>
+__m128i sse2_broadcast(T value)
+{
+    if constexpr (same_as<T, float>) {
+        return _mm_castps_si128(_mm_set1_ps(value));
+    } else if constexpr (same_as<T, double>) {
+        return _mm_castpd_si128(_mm_set1_pd(value));
+    } else if constexpr (sizeof(T) == 1) {
+        return _mm_set1_epi8(static_cast<char>(value));
+    } else if constexpr (sizeof(T) == 2) {
+        return _mm_set1_epi16(static_cast<short>(value));
+    } else if constexpr (sizeof(T) == 4) {
+        return _mm_set1_epi32(static_cast<int>(value));
+    } else {
+        return _mm_set1_epi64x(static_cast<long long>(value));
+    }
+}
+
+// Returns all ones in each lane where the element at p equals the needle
+template <typename T>
+__m128i sse2_compare(const T* p, __m128i needle)
+{
+    const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+
+    if constexpr (same_as<T, float>) {
+        return _mm_castps_si128(
+            _mm_cmpeq_ps(_mm_castsi128_ps(v), _mm_castsi128_ps(needle)));
+    } else if constexpr (same_as<T, double>) {
+        return _mm_castpd_si128(
+            _mm_cmpeq_pd(_mm_castsi128_pd(v), _mm_castsi128_pd(needle)));
+    } else if constexpr (sizeof(T) == 1) {
+        return _mm_cmpeq_epi8(v, needle);
+    } else if constexpr (sizeof(T) == 2) {
+        return _mm_cmpeq_epi16(v, needle);
+    } else if constexpr (sizeof(T) == 4) {
+        return _mm_cmpeq_epi32(v, needle);
+    } else {
+        // There is no 64-bit compare in SSE2, so compare the 32-bit halves
+        // and require both to match
+        const __m128i eq = _mm_cmpeq_epi32(v, needle);
+        return _mm_and_si128(eq, _mm_shuffle_epi32(eq, _MM_SHUFFLE(2, 3, 0, 1)));
+    }
+}
+
+template <typename T>
+__m128i sse2_sub(__m128i a, __m128i b)
+{
+    if constexpr (sizeof(T) == 1) {
+        return _mm_sub_epi8(a, b);
+    } else if constexpr (sizeof(T) == 2) {
+        return _mm_sub_epi16(a, b);
+    } else if constexpr (sizeof(T) == 4) {
+        return _mm_sub_epi32(a, b);
+    } else {
+        return _mm_sub_epi64(a, b);
+    }
+}
+
+template <typename T>
+const T* simd_find_sse2(const T* first, const T* last, T value)
+{
+    constexpr std::ptrdiff_t lanes = 16 / sizeof(T);
+    const __m128i needle = detail::sse2_broadcast(value);
+
+    for (; last - first >= lanes; first += lanes) {
+        const auto mask = static_cast<unsigned>(
+            _mm_movemask_epi8(detail::sse2_compare(first, needle)));
+        if (mask != 0) {
+            return first + detail::simd_ctz(mask) / int(sizeof(T));
+        }
+    }
+
+    while (first != last && !(*first == value)) {
+        ++first;
+    }
+    return first;
+}
+
+template <typename T>
+std::size_t simd_count_sse2(const T* first, const T* last, T value)
+{
+    constexpr std::ptrdiff_t lanes = 16 / sizeof(T);
+    const __m128i needle = detail::sse2_broadcast(value);
+    std::size_t count = 0;
+
+    // Matching lanes compare as -1, so subtracting the comparison result
+    // counts matches in each lane. The lane counters are summed before they
+    // can overflow.
+    while (last - first >= lanes) {
+        auto n = (last - first) / lanes;
+        if (n > simd_max_count_block<T>) {
+            n = simd_max_count_block<T>;
+        }
+        __m128i acc = _mm_setzero_si128();
+        for (; n > 0; --n, first += lanes) {
+            acc = detail::sse2_sub<T>(acc, detail::sse2_compare(first, needle));
+        }
+        count += detail::simd_sum_lanes<T>(&acc, sizeof(acc));
+    }
+
+    for (; first != last; ++first) {
+        if (*first == value) {
+            ++count;
+        }
+    }
+    return count;
+}
+
+// AVX2 ---------------------------------------------------------------------
+
+template <typename T>
+NANO_TARGET_AVX2 __m256i avx2_broadcast(T value)
+{
+    if constexpr (same_as<T, float>) {
+        return _mm256_castps_si256(_mm256_set1_ps(value));
+    } else if constexpr (same_as<T, double>) {
+        return _mm256_castpd_si256(_mm256_set1_pd(value));
+    } else if constexpr (sizeof(T) == 1) {
+        return _mm256_set1_epi8(static_cast<char>(value));
+    } else if constexpr (sizeof(T) == 2) {
+        return _mm256_set1_epi16(static_cast<short>(value));
+    } else if constexpr (sizeof(T) == 4) {
+        return _mm256_set1_epi32(static_cast<int>(value));
+    } else {
+        return _mm256_set1_epi64x(static_cast<long long>(value));
+    }
+}
+
+template <typename T>
+NANO_TARGET_AVX2 __m256i avx2_compare(const T* p, __m256i needle)
+{
+    const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+
+    if constexpr (same_as<T, float>) {
+        return _mm256_castps_si256(_mm256_cmp_ps(
+            _mm256_castsi256_ps(v), _mm256_castsi256_ps(needle), _CMP_EQ_OQ));
+    } else if constexpr (same_as<T, double>) {
+        return _mm256_castpd_si256(_mm256_cmp_pd(
+            _mm256_castsi256_pd(v), _mm256_castsi256_pd(needle), _CMP_EQ_OQ));
+    } else if constexpr (sizeof(T) == 1) {
+        return _mm256_cmpeq_epi8(v, needle);
+    } else if constexpr (sizeof(T) == 2) {
+        return _mm256_cmpeq_epi16(v, needle);
+    } else if constexpr (sizeof(T) == 4) {
+        return _mm256_cmpeq_epi32(v, needle);
+    } else {
+        return _mm256_cmpeq_epi64(v, needle);
+    }
+}
+
+template <typename T>
+NANO_TARGET_AVX2 __m256i avx2_sub(__m256i a, __m256i b)
+{
+    if constexpr (sizeof(T) == 1) {
+        return _mm256_sub_epi8(a, b);
+    } else if constexpr (sizeof(T) == 2) {
+        return _mm256_sub_epi16(a, b);
+    } else if constexpr (sizeof(T) == 4) {
+        return _mm256_sub_epi32(a, b);
+    } else {
+        return _mm256_sub_epi64(a, b);
+    }
+}
+
+template <typename T>
+NANO_TARGET_AVX2 const T* simd_find_avx2(const T* first, const T* last,
+                                         T value)
+{
+    constexpr std::ptrdiff_t lanes = 32 / sizeof(T);
+    const __m256i needle = detail::avx2_broadcast(value);
+
+    for (; last - first >= lanes; first += lanes) {
+        const auto mask = static_cast<unsigned>(
+            _mm256_movemask_epi8(detail::avx2_compare(first, needle)));
+        if (mask != 0) {
+            return first + detail::simd_ctz(mask) / int(sizeof(T));
+        }
+    }
+
+    while (first != last && !(*first == value)) {
+        ++first;
+    }
+    return first;
+}
+
+template <typename T>
+NANO_TARGET_AVX2 std::size_t simd_count_avx2(const T* first, const T* last,
+                                             T value)
+{
+    constexpr std::ptrdiff_t lanes = 32 / sizeof(T);
+    const __m256i needle = detail::avx2_broadcast(value);
+    std::size_t count = 0;
+
+    while (last - first >= lanes) {
+        auto n = (last - first) / lanes;
+        if (n > simd_max_count_block<T>) {
+            n = simd_max_count_block<T>;
+        }
+        __m256i acc = _mm256_setzero_si256();
+        for (; n > 0; --n, first += lanes) {
+            acc = detail::avx2_sub<T>(acc, detail::avx2_compare(first, needle));
+        }
+        count += detail::simd_sum_lanes<T>(&acc, sizeof(acc));
+    }
+
+    for (; first != last; ++first) {
+        if (*first == value) {
+            ++count;
+        }
+    }
+    return count;
+}
+
+#endif // NANO_HAS_X86_SIMD
+
+template <typename T>
+const T* simd_find(const T* first, const T* last, T value)
+{
+#ifdef NANO_HAS_X86_SIMD
+    if (detail::cpu_has_avx2()) {
+        return detail::simd_find_avx2(first, last, value);
+    }
+    return detail::simd_find_sse2(first, last, value);
+#else
+    while (first != last && !(*first == value)) {
+        ++first;
+    }
+    return first;
+#endif
+}
+
+template <typename T>
+std::size_t simd_count(const T* first, const T* last, T value)
+{
+#ifdef NANO_HAS_X86_SIMD
+    if (detail::cpu_has_avx2()) {
+        return detail::simd_count_avx2(first, last, value);
+    }
+    return detail::simd_count_sse2(first, last, value);
+#else
+    std::size_t count = 0;
+    for (; first != last; ++first) {
+        if (*first == value) {
+            ++count;
+        }
+    }
+    return count;
+#endif
+}
+
+// t == value, as used by the scalar paths of find() and count(). Mixed
+// integer types are compared after the usual arithmetic conversions, written
+// out so that comparing (say) an int with an unsigned value doesn't warn; the
+// vectorised kernels give the same answers.
+template <typename U, typename T>
+constexpr bool find_equal(const U& t, const T& value)
+{
+    if constexpr (std::is_integral<U>::value && std::is_integral<T>::value) {
+        using C = std::common_type_t<U, T>;
+        return static_cast<C>(t) == static_cast<C>(value);
+    } else {
+        return t == value;
+    }
+}
+
+// If value converts to V and back without changing, then an element compares
+// equal to value exactly when it is equal to the converted value. Otherwise,
+// no element can compare equal to it.
+template <typename V, typename T>
+constexpr bool simd_can_convert(const T& value)
+{
+    return static_cast<T>(static_cast<V>(value)) == value;
+}
+
+template <typename I, typename T>
+I find_contiguous(I first, iter_difference_t<I> n, const T& value)
+{
+    using V = iter_value_t<I>;
+
+    if (n <= 0 || !detail::simd_can_convert<V>(value)) {
+        return first + (n > 0 ? n : 0);
+    }
+
+    const V* p = std::addressof(*first);
+    return first + (detail::simd_find(p, p + n, static_cast<V>(value)) - p);
+}
+
+template <typename I, typename T>
+iter_difference_t<I> count_contiguous(I first, iter_difference_t<I> n,
+                                      const T& value)
+{
+    using V = iter_value_t<I>;
+
+    if (n <= 0 || !detail::simd_can_convert<V>(value)) {
+        return 0;
+    }
+
+    const V* p = std::addressof(*first);
+    return static_cast<iter_difference_t<I>>(
+        detail::simd_count(p, p + n, static_cast<V>(value)));
+}
+
+} // namespace detail
+
+NANO_END_NAMESPACE
+
+#endif
@@ -0,0 +1,313 @@
+// nanorange/detail/algorithm/simd_minmax.hpp
+//
+// Copyright (c) 2020 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_DETAIL_ALGORITHM_SIMD_MINMAX_HPP_INCLUDED
+#define NANORANGE_DETAIL_ALGORITHM_SIMD_MINMAX_HPP_INCLUDED
+
+#include <nanorange/detail/algorithm/simd_find.hpp>
+#include <nanorange/detail/functional/comparisons.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+NANO_BEGIN_NAMESPACE
+
+namespace detail {
+
+// Whether min_element(first, last, comp, proj) and friends can use the
+// vectorised kernels below. Only the default ordering is supported, since an
+// arbitrary comparator can't be evaluated in vector registers.
+template <typename I, typename S, typename Comp, typename Proj,
+          typename = void>
+inline constexpr bool simd_minmaxable = false;
+
+template <typename I, typename S, typename Comp, typename Proj>
+inline constexpr bool simd_minmaxable<
+    I, S, Comp, Proj,
+    std::enable_if_t<known_contiguous_iterator<I> && sized_sentinel_for<S, I>>> =
+    same_as<Comp, ranges::less> && same_as<Proj, identity> &&
+    std::is_lvalue_reference<iter_reference_t<I>>::value &&
+    !std::is_volatile<std::remove_reference_t<iter_reference_t<I>>>::value &&
+    same_as<remove_cvref_t<iter_reference_t<I>>, iter_value_t<I>> &&
+    is_simd_element<iter_value_t<I>>;
+
+// Which extrema to look for. min_element and max_element return the first
+// smallest and first largest elements respectively; minmax_element returns
+// the first smallest and the *last* largest.
+enum class simd_minmax_kind { min, max, minmax };
+
+template <typename T>
+struct simd_minmax_result {
+    const T* min;
+    const T* max;
+};
+
+// Folds a candidate position into the running result, preferring earlier
+// positions among equal minima (and among equal maxima, unless we want the
+// last one)
+template <simd_minmax_kind Kind, typename T>
+void simd_minmax_update(simd_minmax_result<T>& res, const T* min_pos,
+                        const T* max_pos)
+{
+    if constexpr (Kind != simd_minmax_kind::max) {
+        if (*min_pos < *res.min ||
+            (!(*res.min < *min_pos) && min_pos < res.min)) {
+            res.min = min_pos;
+        }
+    }
+
+    if constexpr (Kind == simd_minmax_kind::max) {
+        if (*res.max < *max_pos ||
+            (!(*max_pos < *res.max) && max_pos < res.max)) {
+            res.max = max_pos;
+        }
+    } else if constexpr (Kind == simd_minmax_kind::minmax) {
+        if (!(*max_pos < *res.max) && (*res.max < *max_pos || max_pos > res.max)) {
+            res.max = max_pos;
+        }
+    }
+}
+
+template <simd_minmax_kind Kind, typename T>
+void simd_minmax_tail(simd_minmax_result<T>& res, const T* first,
+                      const T* last)
+{
+    for (; first != last; ++first) {
+        detail::simd_minmax_update<Kind>(res, first, first);
+    }
+}
+
+#ifdef NANO_HAS_X86_SIMD
+
+// Each lane records the block in which it last found a new extremum, using
+// an unsigned counter of the same width as the elements. Blocks are
+// processed in runs short enough that the counter can't wrap.
+template <typename T>
+constexpr std::ptrdiff_t simd_max_index_block =
+    sizeof(T) == 1 ? 256 : sizeof(T) == 2 ? 65536 : std::ptrdiff_t(1) << 30;
+
+// Reduces the lanes of a run starting at block to the running result
+template <simd_minmax_kind Kind, typename T, typename Vec>
+void simd_minmax_reduce(simd_minmax_result<T>& res, const T* block,
+                        const Vec& min_idx, const Vec& max_idx)
+{
+    constexpr std::ptrdiff_t lanes = sizeof(Vec) / sizeof(T);
+    simd_lane_t<T> mins[lanes];
+    simd_lane_t<T> maxs[lanes];
+    std::memcpy(mins, &min_idx, sizeof(Vec));
+    std::memcpy(maxs, &max_idx, sizeof(Vec));
+
+    for (std::ptrdiff_t i = 0; i < lanes; i++) {
+        detail::simd_minmax_update<Kind>(
+            res, block + std::ptrdiff_t(mins[i]) * lanes + i,
+            block + std::ptrdiff_t(maxs[i]) * lanes + i);
+    }
+}
+
+// SSE2 ---------------------------------------------------------------------
+
+// SSE2 has no 64-bit integer ordering comparison
+template <typename T>
+inline constexpr bool sse2_minmax_element =
+    !std::is_integral<T>::value || sizeof(T) < 8;
+
+// Returns all ones in each lane where a < b
+template <typename T>
+__m128i sse2_less(__m128i a, __m128i b)
+{
+    if constexpr (same_as<T, float>) {
+        return _mm_castps_si128(
+            _mm_cmplt_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(b)));
+    } else if constexpr (same_as<T, double>) {
+        return _mm_castpd_si128(
+            _mm_cmplt_pd(_mm_castsi128_pd(a), _mm_castsi128_pd(b)));
+    } else if constexpr (std::is_unsigned<T>::value) {
+        // Flipping the sign bit maps unsigned order onto signed order
+        using S = std::make_signed_t<simd_lane_t<T>>;
+        const __m128i bias = detail::sse2_broadcast(
+            static_cast<S>(std::make_unsigned_t<S>(1) << (sizeof(T) * 8 - 1)));
+        return detail::sse2_less<S>(_mm_xor_si128(a, bias),
+                                    _mm_xor_si128(b, bias));
+    } else if constexpr (sizeof(T) == 1) {
+        return _mm_cmpgt_epi8(b, a);
+    } else if constexpr (sizeof(T) == 2) {
+        return _mm_cmpgt_epi16(b, a);
+    } else {
+        return _mm_cmpgt_epi32(b, a);
+    }
+}
+
+// Selects lanes of b where mask is set, and of a elsewhere
+inline __m128i sse2_select(__m128i a, __m128i b, __m128i mask)
+{
+    return _mm_or_si128(_mm_and_si128(mask, b), _mm_andnot_si128(mask, a));
+}
+
+template <simd_minmax_kind Kind, typename T>
+simd_minmax_result<T> simd_minmax_sse2(const T* first, const T* last)
+{
+    constexpr std::ptrdiff_t lanes = 16 / sizeof(T);
+    const __m128i ones = _mm_set1_epi32(-1);
+    simd_minmax_result<T> res{first, first};
+
+    while (last - first >= lanes) {
+        auto n = (last - first) / lanes;
+        if (n > simd_max_index_block<T>) {
+            n = simd_max_index_block<T>;
+        }
+
+        const T* const block = first;
+        __m128i min = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+        __m128i max = min;
+        __m128i min_idx = _mm_setzero_si128();
+        __m128i max_idx = min_idx;
+        __m128i idx = min_idx;
+        first += lanes;
+
+        for (--n; n > 0; --n, first += lanes) {
+            const __m128i v =
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+            idx = detail::sse2_sub<T>(idx, ones);
+
+            if constexpr (Kind != simd_minmax_kind::max) {
+                const __m128i lt = detail::sse2_less<T>(v, min);
+                min = detail::sse2_select(min, v, lt);
+                min_idx = detail::sse2_select(min_idx, idx, lt);
+            }
+            if constexpr (Kind == simd_minmax_kind::max) {
+                const __m128i gt = detail::sse2_less<T>(max, v);
+                max = detail::sse2_select(max, v, gt);
+                max_idx = detail::sse2_select(max_idx, idx, gt);
+            } else if constexpr (Kind == simd_minmax_kind::minmax) {
+                const __m128i lt = detail::sse2_less<T>(v, max);
+                max = detail::sse2_select(v, max, lt);
+                max_idx = detail::sse2_select(idx, max_idx, lt);
+            }
+        }
+
+        detail::simd_minmax_reduce<Kind>(res, block, min_idx, max_idx);
+    }
+
+    detail::simd_minmax_tail<Kind>(res, first, last);
+    return res;
+}
+
+// AVX2 ---------------------------------------------------------------------
+
+template <typename T>
+NANO_TARGET_AVX2 __m256i avx2_less(__m256i a, __m256i b)
+{
+    if constexpr (same_as<T, float>) {
+        return _mm256_castps_si256(_mm256_cmp_ps(
+            _mm256_castsi256_ps(a), _mm256_castsi256_ps(b), _CMP_LT_OQ));
+    } else if constexpr (same_as<T, double>) {
+        return _mm256_castpd_si256(_mm256_cmp_pd(
+            _mm256_castsi256_pd(a), _mm256_castsi256_pd(b), _CMP_LT_OQ));
+    } else if constexpr (std::is_unsigned<T>::value) {
+        using S = std::make_signed_t<simd_lane_t<T>>;
+        const __m256i bias = detail::avx2_broadcast(
+            static_cast<S>(std::make_unsigned_t<S>(1) << (sizeof(T) * 8 - 1)));
+        return detail::avx2_less<S>(_mm256_xor_si256(a, bias),
+                                    _mm256_xor_si256(b, bias));
+    } else if constexpr (sizeof(T) == 1) {
+        return _mm256_cmpgt_epi8(b, a);
+    } else if constexpr (sizeof(T) == 2) {
+        return _mm256_cmpgt_epi16(b, a);
+    } else if constexpr (sizeof(T) == 4) {
+        return _mm256_cmpgt_epi32(b, a);
+    } else {
+        return _mm256_cmpgt_epi64(b, a);
+    }
+}
+
+template <simd_minmax_kind Kind, typename T>
+NANO_TARGET_AVX2 simd_minmax_result<T> simd_minmax_avx2(const T* first,
+                                                        const T* last)
+{
+    constexpr std::ptrdiff_t lanes = 32 / sizeof(T);
+    const __m256i ones = _mm256_set1_epi32(-1);
+    simd_minmax_result<T> res{first, first};
+
+    while (last - first >= lanes) {
+        auto n = (last - first) / lanes;
+        if (n > simd_max_index_block<T>) {
+            n = simd_max_index_block<T>;
+        }
+
+        const T* const block = first;
+        __m256i min =
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first));
+        __m256i max = min;
+        __m256i min_idx = _mm256_setzero_si256();
+        __m256i max_idx = min_idx;
+        __m256i idx = min_idx;
+        first += lanes;
+
+        for (--n; n > 0; --n, first += lanes) {
+            const __m256i v =
+                _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first));
+            idx = detail::avx2_sub<T>(idx, ones);
+
+            if constexpr (Kind != simd_minmax_kind::max) {
+                const __m256i lt = detail::avx2_less<T>(v, min);
+                min = _mm256_blendv_epi8(min, v, lt);
+                min_idx = _mm256_blendv_epi8(min_idx, idx, lt);
+            }
+            if constexpr (Kind == simd_minmax_kind::max) {
+                const __m256i gt = detail::avx2_less<T>(max, v);
+                max = _mm256_blendv_epi8(max, v, gt);
+                max_idx = _mm256_blendv_epi8(max_idx, idx, gt);
+            } else if constexpr (Kind == simd_minmax_kind::minmax) {
+                const __m256i lt = detail::avx2_less<T>(v, max);
+                max = _mm256_blendv_epi8(v, max, lt);
+                max_idx = _mm256_blendv_epi8(idx, max_idx, lt);
+            }
+        }
+
+        detail::simd_minmax_reduce<Kind>(res, block, min_idx, max_idx);
+    }
+
+    detail::simd_minmax_tail<Kind>(res, first, last);
+    return res;
+}
+
+#endif // NANO_HAS_X86_SIMD
+
+// Precondition: first != last
+template <simd_minmax_kind Kind, typename T>
+simd_minmax_result<T> simd_minmax(const T* first, const T* last)
+{
+#ifdef NANO_HAS_X86_SIMD
+    if (detail::cpu_has_avx2()) {
+        return detail::simd_minmax_avx2<Kind>(first, last);
+    }
+    if constexpr (sse2_minmax_element<T>) {
+        return detail::simd_minmax_sse2<Kind>(first, last);
+    }
+#endif
+    simd_minmax_result<T> res{first, first};
+    detail::simd_minmax_tail<Kind>(res, first + 1, last);
+    return res;
+}
+
+template <simd_minmax_kind Kind, typename I>
+std::pair<I, I> minmax_element_contiguous(I first, iter_difference_t<I> n)
+{
+    if (n <= 0) {
+        return {first, first};
+    }
+
+    const auto* p = std::addressof(*first);
+    const auto res = detail::simd_minmax<Kind>(p, p + n);
+    return {first + (res.min - p), first + (res.max - p)};
+}
+
+} // namespace detail
+
+NANO_END_NAMESPACE
+
+#endif
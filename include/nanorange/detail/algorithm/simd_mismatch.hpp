@@ -0,0 +1,164 @@
+// nanorange/detail/algorithm/simd_mismatch.hpp
+//
+// Copyright (c) 2020 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_DETAIL_ALGORITHM_SIMD_MISMATCH_HPP_INCLUDED
+#define NANORANGE_DETAIL_ALGORITHM_SIMD_MISMATCH_HPP_INCLUDED
+
+#include <nanorange/detail/algorithm/memmove.hpp>
+#include <nanorange/detail/algorithm/simd.hpp>
+#include <nanorange/detail/functional/identity.hpp>
+
+#include <cstddef>
+#include <cstring>
+#include <memory>
+
+NANO_BEGIN_NAMESPACE
+
+namespace detail {
+
+// Types for which two objects compare equal exactly when their object
+// representations are the same. Floating point types are excluded because
+// of -0.0 and NaN.
+template <typename T>
+inline constexpr bool is_bitwise_comparable_type =
+    std::is_integral<T>::value || same_as<T, std::byte>;
+
+// Whether two contiguous ranges, read with the identity projection, can be
+// compared by looking at their bytes rather than one element at a time
+template <typename I1, typename I2, typename Proj1, typename Proj2,
+          typename = void>
+inline constexpr bool is_bitwise_comparable = false;
+
+template <typename I1, typename I2, typename Proj1, typename Proj2>
+inline constexpr bool is_bitwise_comparable<
+    I1, I2, Proj1, Proj2,
+    std::enable_if_t<known_contiguous_iterator<I1> &&
+                     known_contiguous_iterator<I2>>> =
+    same_as<Proj1, identity> && same_as<Proj2, identity> &&
+    same_as<iter_value_t<I1>, iter_value_t<I2>> &&
+    std::is_lvalue_reference<iter_reference_t<I1>>::value &&
+    std::is_lvalue_reference<iter_reference_t<I2>>::value &&
+    same_as<remove_cvref_t<iter_reference_t<I1>>, iter_value_t<I1>> &&
+    same_as<remove_cvref_t<iter_reference_t<I2>>, iter_value_t<I2>> &&
+    !std::is_volatile<std::remove_reference_t<iter_reference_t<I1>>>::value &&
+    !std::is_volatile<std::remove_reference_t<iter_reference_t<I2>>>::value &&
+    is_bitwise_comparable_type<iter_value_t<I1>>;
+
+#ifdef NANO_HAS_X86_SIMD
+
+inline std::size_t simd_mismatch_bytes_sse2(const unsigned char* a,
+                                            const unsigned char* b,
+                                            std::size_t n)
+{
+    std::size_t i = 0;
+    for (; n - i >= 16; i += 16) {
+        const __m128i va =
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+        const __m128i vb =
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i));
+        const auto mask = static_cast<unsigned>(
+            _mm_movemask_epi8(_mm_cmpeq_epi8(va, vb)));
+        if (mask != 0xFFFFu) {
+            return i + static_cast<std::size_t>(detail::simd_ctz(~mask));
+        }
+    }
+
+    while (i != n && a[i] == b[i]) {
+        ++i;
+    }
+    return i;
+}
+
+NANO_TARGET_AVX2
+inline std::size_t simd_mismatch_bytes_avx2(const unsigned char* a,
+                                            const unsigned char* b,
+                                            std::size_t n)
+{
+    std::size_t i = 0;
+    for (; n - i >= 32; i += 32) {
+        const __m256i va =
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+        const __m256i vb =
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+        const auto mask = static_cast<unsigned>(
+            _mm256_movemask_epi8(_mm256_cmpeq_epi8(va, vb)));
+        if (mask != 0xFFFFFFFFu) {
+            return i + static_cast<std::size_t>(detail::simd_ctz(~mask));
+        }
+    }
+
+    while (i != n && a[i] == b[i]) {
+        ++i;
+    }
+    return i;
+}
+
+#endif // NANO_HAS_X86_SIMD
+
+// Returns the index of the first byte which differs between a and b, or n if
+// there is none
+inline std::size_t simd_mismatch_bytes(const unsigned char* a,
+                                       const unsigned char* b, std::size_t n)
+{
+#ifdef NANO_HAS_X86_SIMD
+    if (detail::cpu_has_avx2()) {
+        return detail::simd_mismatch_bytes_avx2(a, b, n);
+    }
+    return detail::simd_mismatch_bytes_sse2(a, b, n);
+#else
+    // Skip equal 64-byte blocks with memcmp, then find the position within
+    // the block that differs
+    std::size_t i = 0;
+    while (n - i >= 64 && std::memcmp(a + i, b + i, 64) == 0) {
+        i += 64;
+    }
+    while (i != n && a[i] == b[i]) {
+        ++i;
+    }
+    return i;
+#endif
+}
+
+// Returns the index of the first element which differs between the n
+// elements starting at first1 and first2
+template <typename I1, typename I2>
+iter_difference_t<I1> first_difference_contiguous(I1 first1, I2 first2,
+                                                  iter_difference_t<I1> n)
+{
+    using T = iter_value_t<I1>;
+
+    if (n <= 0) {
+        return 0;
+    }
+
+    const auto* a =
+        reinterpret_cast<const unsigned char*>(std::addressof(*first1));
+    const auto* b =
+        reinterpret_cast<const unsigned char*>(std::addressof(*first2));
+    const std::size_t bytes = static_cast<std::size_t>(n) * sizeof(T);
+
+    return static_cast<iter_difference_t<I1>>(
+        detail::simd_mismatch_bytes(a, b, bytes) / sizeof(T));
+}
+
+// Whether the n elements starting at first1 and first2 are equal
+template <typename I1, typename I2>
+bool memcmp_equal(I1 first1, I2 first2, iter_difference_t<I1> n)
+{
+    if (n <= 0) {
+        return true;
+    }
+
+    return std::memcmp(std::addressof(*first1), std::addressof(*first2),
+                       static_cast<std::size_t>(n) *
+                           sizeof(iter_value_t<I1>)) == 0;
+}
+
+} // namespace detail
+
+NANO_END_NAMESPACE
+
+#endif
@@ -0,0 +1,281 @@
+// nanorange/detail/algorithm/simd_set.hpp
+//
+// Copyright (c) 2020 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_DETAIL_ALGORITHM_SIMD_SET_HPP_INCLUDED
+#define NANORANGE_DETAIL_ALGORITHM_SIMD_SET_HPP_INCLUDED
+
+#include <nanorange/algorithm/copy.hpp>
+#include <nanorange/detail/algorithm/result_types.hpp>
+#include <nanorange/detail/algorithm/simd.hpp>
+#include <nanorange/detail/functional/comparisons.hpp>
+#include <nanorange/detail/functional/identity.hpp>
+
+#include <cstddef>
+#include <memory>
+
+NANO_BEGIN_NAMESPACE
+
+namespace detail {
+
+// Whether set_intersection() over contiguous ranges of I1 and I2 with comp,
+// proj1 and proj2 can use the vectorised kernels below. Only 32- and 64-bit
+// integers in their default order are supported, since the kernels compare
+// bit patterns for equality.
+template <typename I1, typename I2, typename Comp, typename Proj1,
+          typename Proj2, typename = void>
+inline constexpr bool simd_set_intersectable = false;
+
+template <typename I1, typename I2, typename Comp, typename Proj1,
+          typename Proj2>
+inline constexpr bool simd_set_intersectable<
+    I1, I2, Comp, Proj1, Proj2,
+    std::enable_if_t<known_contiguous_iterator<I1> &&
+                     known_contiguous_iterator<I2>>> =
+    same_as<Comp, ranges::less> && same_as<Proj1, identity> &&
+    same_as<Proj2, identity> &&
+    std::is_lvalue_reference<iter_reference_t<I1>>::value &&
+    std::is_lvalue_reference<iter_reference_t<I2>>::value &&
+    !std::is_volatile<std::remove_reference_t<iter_reference_t<I1>>>::value &&
+    !std::is_volatile<std::remove_reference_t<iter_reference_t<I2>>>::value &&
+    same_as<remove_cvref_t<iter_reference_t<I1>>, iter_value_t<I1>> &&
+    same_as<iter_value_t<I1>, iter_value_t<I2>> &&
+    std::is_integral<iter_value_t<I1>>::value &&
+    (sizeof(iter_value_t<I1>) == 4 || sizeof(iter_value_t<I1>) == 8);
+
+#ifdef NANO_HAS_X86_SIMD
+
+// The kernels write matches to a buffer of this many elements, which is then
+// copied to the output
+constexpr std::ptrdiff_t simd_set_buffer_size = 256;
+
+template <typename T>
+struct simd_intersect_result {
+    const T* a;
+    const T* b;
+    std::ptrdiff_t count;
+    bool full;
+};
+
+// The kernels compare a block of lanes elements of each input against every
+// rotation of the other, so that each element of the first block is
+// compared with every element of the second. The matches are written out,
+// and whichever block has the smaller last element is replaced by the next
+// (or both, if those are equal).
+//
+// This finds each value exactly once only if neither input repeats it. So
+// every block is checked for equal neighbours, including the element just
+// past it, before it is used; if there are any, the kernel stops and leaves
+// the rest to the scalar merge. At that point everything before a and b has
+// been dealt with: the block which is still loaded has only been compared
+// against smaller values of the other input, so its remaining elements can
+// only match at or after the other's current position.
+//
+// The kernels also stop when fewer than lanes + 1 elements of either input
+// remain, or when the buffer might not have room for another block's matches.
+
+template <typename T>
+simd_intersect_result<T> simd_intersect_sse2(const T* a, const T* alast,
+                                             const T* b, const T* blast,
+                                             T* out)
+{
+    constexpr std::ptrdiff_t lanes = 16 / sizeof(T);
+    T* const out_first = out;
+
+    const auto load = [](const T* p) {
+        return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    };
+
+    const auto eq = [](__m128i x, __m128i y) {
+        if constexpr (sizeof(T) == 4) {
+            return _mm_cmpeq_epi32(x, y);
+        } else {
+            const __m128i e = _mm_cmpeq_epi32(x, y);
+            return _mm_and_si128(e,
+                                 _mm_shuffle_epi32(e, _MM_SHUFFLE(2, 3, 0, 1)));
+        }
+    };
+
+    const auto movemask = [](__m128i m) {
+        if constexpr (sizeof(T) == 4) {
+            return static_cast<unsigned>(_mm_movemask_ps(_mm_castsi128_ps(m)));
+        } else {
+            return static_cast<unsigned>(_mm_movemask_pd(_mm_castsi128_pd(m)));
+        }
+    };
+
+    bool check_a = true;
+    bool check_b = true;
+
+    while (alast - a > lanes && blast - b > lanes) {
+        if (out - out_first > simd_set_buffer_size - lanes) {
+            return {a, b, out - out_first, true};
+        }
+
+        const __m128i va = load(a);
+        const __m128i vb = load(b);
+
+        if ((check_a && movemask(eq(va, load(a + 1))) != 0) ||
+            (check_b && movemask(eq(vb, load(b + 1))) != 0)) {
+            break;
+        }
+
+        __m128i m = eq(va, vb);
+        if constexpr (sizeof(T) == 4) {
+            __m128i r = _mm_shuffle_epi32(vb, _MM_SHUFFLE(0, 3, 2, 1));
+            m = _mm_or_si128(m, eq(va, r));
+            r = _mm_shuffle_epi32(r, _MM_SHUFFLE(0, 3, 2, 1));
+            m = _mm_or_si128(m, eq(va, r));
+            r = _mm_shuffle_epi32(r, _MM_SHUFFLE(0, 3, 2, 1));
+            m = _mm_or_si128(m, eq(va, r));
+        } else {
+            m = _mm_or_si128(
+                m, eq(va, _mm_shuffle_epi32(vb, _MM_SHUFFLE(1, 0, 3, 2))));
+        }
+
+        for (unsigned mask = movemask(m); mask != 0; mask &= mask - 1) {
+            *out++ = a[detail::simd_ctz(mask)];
+        }
+
+        const T amax = a[lanes - 1];
+        const T bmax = b[lanes - 1];
+        check_a = !(bmax < amax);
+        check_b = !(amax < bmax);
+        a += check_a ? lanes : 0;
+        b += check_b ? lanes : 0;
+    }
+
+    return {a, b, out - out_first, false};
+}
+
+template <typename T>
+NANO_TARGET_AVX2 simd_intersect_result<T>
+simd_intersect_avx2(const T* a, const T* alast, const T* b, const T* blast,
+                    T* out)
+{
+    constexpr std::ptrdiff_t lanes = 32 / sizeof(T);
+    T* const out_first = out;
+
+    bool check_a = true;
+    bool check_b = true;
+
+    while (alast - a > lanes && blast - b > lanes) {
+        if (out - out_first > simd_set_buffer_size - lanes) {
+            return {a, b, out - out_first, true};
+        }
+
+        const __m256i va =
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a));
+        const __m256i vb =
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b));
+        const __m256i na =
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + 1));
+        const __m256i nb =
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + 1));
+
+        unsigned mask;
+        if constexpr (sizeof(T) == 4) {
+            const __m256i da = _mm256_cmpeq_epi32(va, na);
+            const __m256i db = _mm256_cmpeq_epi32(vb, nb);
+            if ((check_a && !_mm256_testz_si256(da, da)) ||
+                (check_b && !_mm256_testz_si256(db, db))) {
+                break;
+            }
+
+            const __m256i rot = _mm256_setr_epi32(1, 2, 3, 4, 5, 6, 7, 0);
+            __m256i r = vb;
+            __m256i m = _mm256_cmpeq_epi32(va, r);
+            for (int i = 1; i < 8; ++i) {
+                r = _mm256_permutevar8x32_epi32(r, rot);
+                m = _mm256_or_si256(m, _mm256_cmpeq_epi32(va, r));
+            }
+            mask = static_cast<unsigned>(
+                _mm256_movemask_ps(_mm256_castsi256_ps(m)));
+        } else {
+            const __m256i da = _mm256_cmpeq_epi64(va, na);
+            const __m256i db = _mm256_cmpeq_epi64(vb, nb);
+            if ((check_a && !_mm256_testz_si256(da, da)) ||
+                (check_b && !_mm256_testz_si256(db, db))) {
+                break;
+            }
+
+            __m256i r = vb;
+            __m256i m = _mm256_cmpeq_epi64(va, r);
+            for (int i = 1; i < 4; ++i) {
+                r = _mm256_permute4x64_epi64(r, _MM_SHUFFLE(0, 3, 2, 1));
+                m = _mm256_or_si256(m, _mm256_cmpeq_epi64(va, r));
+            }
+            mask = static_cast<unsigned>(
+                _mm256_movemask_pd(_mm256_castsi256_pd(m)));
+        }
+
+        for (; mask != 0; mask &= mask - 1) {
+            *out++ = a[detail::simd_ctz(mask)];
+        }
+
+        const T amax = a[lanes - 1];
+        const T bmax = b[lanes - 1];
+        check_a = !(bmax < amax);
+        check_b = !(amax < bmax);
+        a += check_a ? lanes : 0;
+        b += check_b ? lanes : 0;
+    }
+
+    return {a, b, out - out_first, false};
+}
+
+#endif // NANO_HAS_X86_SIMD
+
+// Intersects as much of the sorted ranges [first1, first1 + n1) and
+// [first2, first2 + n2) as the kernels can deal with, writing the matches to
+// result. Returns where the scalar merge should carry on from.
+template <typename I1, typename I2, typename O>
+in_in_out_result<I1, I2, O>
+simd_set_intersection(I1 first1, iter_difference_t<I1> n1, I2 first2,
+                      iter_difference_t<I2> n2, O result)
+{
+#ifdef NANO_HAS_X86_SIMD
+    using T = iter_value_t<I1>;
+
+    if (n1 > 0 && n2 > 0) {
+        const T* const a_first = std::addressof(*first1);
+        const T* const b_first = std::addressof(*first2);
+        const T* a = a_first;
+        const T* b = b_first;
+        T buf[simd_set_buffer_size];
+        const bool avx2 = detail::cpu_has_avx2();
+
+        while (true) {
+            const auto res =
+                avx2 ? detail::simd_intersect_avx2(a, a_first + n1, b,
+                                                   b_first + n2, buf)
+                     : detail::simd_intersect_sse2(a, a_first + n1, b,
+                                                   b_first + n2, buf);
+            const T* const matches = buf;
+            result = nano::copy(matches, matches + res.count, std::move(result))
+                         .out;
+            a = res.a;
+            b = res.b;
+            if (!res.full) {
+                break;
+            }
+        }
+
+        first1 += a - a_first;
+        first2 += b - b_first;
+    }
+#else
+    (void) n1;
+    (void) n2;
+#endif
+
+    return {std::move(first1), std::move(first2), std::move(result)};
+}
+
+} // namespace detail
+
+NANO_END_NAMESPACE
+
+#endif
@@ -0,0 +1,166 @@
+// nanorange/detail/execution/chase_lev_deque.hpp
+//
+// Copyright (c) 2020 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_DETAIL_EXECUTION_CHASE_LEV_DEQUE_HPP_INCLUDED
+#define NANORANGE_DETAIL_EXECUTION_CHASE_LEV_DEQUE_HPP_INCLUDED
+
+#include <nanorange/detail/macros.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+NANO_BEGIN_NAMESPACE
+
+namespace detail {
+
+// A lock-free work-stealing deque of T* (Chase and Lev, 2005, with the
+// memory orderings of Le et al., 2013). A single owner thread pushes and
+// pops at the bottom, while any number of other threads steal from the top,
+// so the owner works through its most recently forked (and smallest) tasks
+// while thieves take the oldest (and largest). Neither end takes a lock: the
+// owner only contends with thieves when a single element is left.
+//
+// The deque doesn't own the pointees.
+template <typename T>
+class chase_lev_deque {
+    struct buffer {
+        explicit buffer(std::ptrdiff_t capacity)
+            : mask(capacity - 1), slots(new std::atomic<T*>[capacity])
+        {}
+
+        std::ptrdiff_t capacity() const noexcept { return mask + 1; }
+
+        T* get(std::ptrdiff_t i) const noexcept
+        {
+            return slots[i & mask].load(std::memory_order_relaxed);
+        }
+
+        void put(std::ptrdiff_t i, T* elem) noexcept
+        {
+            slots[i & mask].store(elem, std::memory_order_relaxed);
+        }
+
+        const std::ptrdiff_t mask;
+        const std::unique_ptr<std::atomic<T*>[]> slots;
+    };
+
+public:
+    explicit chase_lev_deque(std::ptrdiff_t capacity = 256)
+    {
+        buffers_.push_back(std::make_unique<buffer>(capacity));
+        buffer_.store(buffers_.back().get(), std::memory_order_relaxed);
+    }
+
+    chase_lev_deque(const chase_lev_deque&) = delete;
+    chase_lev_deque& operator=(const chase_lev_deque&) = delete;
+
+    // Owner only. Throws std::bad_alloc if the deque needs to grow and
+    // cannot, in which case elem is not pushed.
+    void push(T* elem)
+    {
+        const std::ptrdiff_t b = bottom_.load(std::memory_order_relaxed);
+        const std::ptrdiff_t t = top_.load(std::memory_order_acquire);
+        buffer* buf = buffer_.load(std::memory_order_relaxed);
+
+        if (b - t > buf->capacity() - 1) {
+            buf = grow(buf, t, b);
+        }
+
+        buf->put(b, elem);
+        // Publishes the element, and everything written before pushing it,
+        // to the thieves which load bottom_
+        bottom_.store(b + 1, std::memory_order_release);
+    }
+
+    // Owner only. Returns nullptr if the deque is empty.
+    T* pop() noexcept
+    {
+        const std::ptrdiff_t b = bottom_.load(std::memory_order_relaxed) - 1;
+        buffer* buf = buffer_.load(std::memory_order_relaxed);
+        bottom_.store(b, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        std::ptrdiff_t t = top_.load(std::memory_order_relaxed);
+
+        if (t > b) {
+            // Empty
+            bottom_.store(b + 1, std::memory_order_relaxed);
+            return nullptr;
+        }
+
+        T* elem = buf->get(b);
+        if (t == b) {
+            // The last element, which a thief may be taking at the same time
+            if (!top_.compare_exchange_strong(t, t + 1,
+                                              std::memory_order_seq_cst,
+                                              std::memory_order_relaxed)) {
+                elem = nullptr;
+            }
+            bottom_.store(b + 1, std::memory_order_relaxed);
+        }
+        return elem;
+    }
+
+    // Any thread. Returns nullptr if the deque is empty, or if another
+    // thread took the top element first.
+    T* steal() noexcept
+    {
+        std::ptrdiff_t t = top_.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const std::ptrdiff_t b = bottom_.load(std::memory_order_acquire);
+
+        if (t >= b) {
+            return nullptr;
+        }
+
+        const buffer* buf = buffer_.load(std::memory_order_acquire);
+        T* elem = buf->get(t);
+        if (!top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                          std::memory_order_relaxed)) {
+            return nullptr;
+        }
+        return elem;
+    }
+
+    // An estimate, unless called by the owner while nothing is stealing
+    bool empty() const noexcept
+    {
+        return bottom_.load(std::memory_order_relaxed) <=
+               top_.load(std::memory_order_relaxed);
+    }
+
+private:
+    // Moves the elements in [t, b) to a buffer of twice the capacity. A thief
+    // may still be reading from the old buffer, so it is kept until the
+    // deque is destroyed; as the capacity doubles each time, the old buffers
+    // take up no more space than the current one.
+    buffer* grow(const buffer* old, std::ptrdiff_t t, std::ptrdiff_t b)
+    {
+        buffers_.reserve(buffers_.size() + 1);
+        auto buf = std::make_unique<buffer>(old->capacity() * 2);
+        for (std::ptrdiff_t i = t; i != b; ++i) {
+            buf->put(i, old->get(i));
+        }
+        buffers_.push_back(std::move(buf));
+        buffer_.store(buffers_.back().get(), std::memory_order_release);
+        return buffers_.back().get();
+    }
+
+    // top_ and bottom_ are written by different threads, so keep them on
+    // separate cache lines
+    alignas(64) std::atomic<std::ptrdiff_t> top_{0};
+    alignas(64) std::atomic<std::ptrdiff_t> bottom_{0};
+    alignas(64) std::atomic<buffer*> buffer_{nullptr};
+    // Owner only
+    std::vector<std::unique_ptr<buffer>> buffers_;
+};
+
+} // namespace detail
+
+NANO_END_NAMESPACE
+
+#endif
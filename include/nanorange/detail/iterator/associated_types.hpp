@@ -129,14 +129,17 @@ using member_element_type_t = typename T::element_type;
 template <typename T>
 constexpr bool has_member_element_type_v = exists_v<member_element_type_t, T>;
 
+// Const-qualified types are handled by the specialisation above
 template <typename T>
 struct readable_traits_helper<T, std::enable_if_t<
+    !std::is_const<T>::value &&
     has_member_value_type_v<T> &&
     !has_member_element_type_v<T>>>
     : member_value_type<T> {};
 
 template <typename T>
 struct readable_traits_helper<T, std::enable_if_t<
+    !std::is_const<T>::value &&
     has_member_element_type_v<T> &&
     !has_member_value_type_v<T>>>
     : member_element_type<T> {};
@@ -146,6 +149,7 @@ struct readable_traits_helper<T, std::enable_if_t<
 // https://github.com/ericniebler/stl2/issues/562
 template <typename T>
 struct readable_traits_helper<T, std::enable_if_t<
+    !std::is_const<T>::value &&
     has_member_element_type_v<T> &&
     has_member_value_type_v<T>>>
 {};
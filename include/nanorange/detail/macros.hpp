@@ -65,4 +65,16 @@ inline namespace ranges                                                        \
 #define NANO_MSVC_LAMBDA_PIPE_WORKAROUND 1
 #endif
 
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_is_constant_evaluated)
+#define NANO_HAS_BUILTIN_IS_CONSTANT_EVALUATED 1
+#endif
+#endif
+
+#if !defined(NANO_HAS_BUILTIN_IS_CONSTANT_EVALUATED) &&                        \
+    ((defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 9) ||            \
+     (defined(_MSC_VER) && _MSC_VER >= 1925))
+#define NANO_HAS_BUILTIN_IS_CONSTANT_EVALUATED 1
+#endif
+
 #endif
@@ -9,6 +9,7 @@
 #define NANORANGE_DETAIL_MEMORY_TEMPORARY_VECTOR_HPP_INCLUDED
 
 #include <nanorange/memory/destroy.hpp>
+#include <nanorange/memory/temporary_resource.hpp>
 
 #include <cassert>
 #include <memory>
@@ -22,17 +23,69 @@ template <typename T>
 struct temporary_vector {
 private:
     struct deleter {
-        void operator()(T* ptr) const { ::operator delete[](ptr); }
+        bool owning = true;
+#ifdef NANO_HAS_MEMORY_RESOURCE
+        std::pmr::memory_resource* resource = nullptr;
+        std::size_t capacity = 0;
+#endif
+
+        void operator()(T* ptr) const
+        {
+            if (!owning) {
+                return;
+            }
+#ifdef NANO_HAS_MEMORY_RESOURCE
+            if (resource) {
+                resource->deallocate(ptr, capacity * sizeof(T), alignof(T));
+                return;
+            }
+#endif
+            ::operator delete[](ptr);
+        }
     };
 
+    // Returns nullptr on failure, and for empty requests so that they don't
+    // touch the heap at all
+    static std::unique_ptr<T, deleter> allocate(std::size_t capacity)
+    {
+        if (capacity == 0) {
+            return nullptr;
+        }
+
+#ifdef NANO_HAS_MEMORY_RESOURCE
+        if (auto* res = nano::get_temporary_resource()) {
+            try {
+                return std::unique_ptr<T, deleter>(
+                    static_cast<T*>(res->allocate(capacity * sizeof(T), alignof(T))),
+                    deleter{true, res, capacity});
+            } catch (const std::bad_alloc&) {
+                return nullptr;
+            }
+        }
+#endif
+
+        return std::unique_ptr<T, deleter>(static_cast<T*>(
+            ::operator new[](capacity * sizeof(T), std::nothrow)));
+    }
+
 public:
     temporary_vector() = default;
 
+    // Allocates uninitialised storage for capacity elements from the calling
+    // thread's temporary resource, if there is one. If the allocation fails,
+    // the resulting vector has zero capacity.
     explicit temporary_vector(std::size_t capacity)
-        : start_(static_cast<T*>(::operator new[](capacity * sizeof(T), std::nothrow))),
+        : start_(allocate(capacity)),
           end_cap_(start_ ? start_.get() + capacity : nullptr)
     {}
 
+    // Uses capacity elements of uninitialised storage owned by someone else,
+    // which must outlive this object
+    temporary_vector(T* storage, std::size_t capacity)
+        : start_(storage, deleter{false}),
+          end_cap_(storage + capacity)
+    {}
+
     temporary_vector(temporary_vector&& other) noexcept
         : start_(std::move(other.start_)),
           end_(other.end_),
@@ -0,0 +1,144 @@
+// nanorange/detail/numeric/reduce.hpp
+//
+// Copyright (c) 2020 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_DETAIL_NUMERIC_REDUCE_HPP_INCLUDED
+#define NANORANGE_DETAIL_NUMERIC_REDUCE_HPP_INCLUDED
+
+#include <nanorange/detail/concepts/core.hpp>
+#include <nanorange/detail/concepts/object.hpp>
+#include <nanorange/detail/functional/invoke.hpp>
+#include <nanorange/execution/policy.hpp>
+
+#include <cstddef>
+#include <optional>
+
+NANO_BEGIN_NAMESPACE
+
+namespace detail {
+
+struct foldable_concept {
+    template <typename, typename, typename>
+    static auto test(long) -> std::false_type;
+
+    template <typename Op, typename T, typename U>
+    static auto test(int) -> std::enable_if_t<
+        movable<T> &&
+        invocable<Op&, T, U> &&
+        assignable_from<T&, invoke_result_t<Op&, T, U>>,
+        std::true_type>;
+};
+
+// acc = op(std::move(acc), u) is valid for an accumulator acc of type T
+template <typename Op, typename T, typename U>
+NANO_CONCEPT foldable = decltype(foldable_concept::test<Op, T, U>(0))::value;
+
+// As foldable, but elements may also start an accumulator and accumulators
+// may be combined with each other, so that op can be applied in any grouping
+template <typename Op, typename T, typename U>
+NANO_CONCEPT reducible = foldable<Op, T, U> && foldable<Op, T, T> &&
+                         convertible_to<U, T>;
+
+// Reductions are performed as a balanced binary tree whose leaves are runs
+// of (at most) this many elements, folded from left to right. The shape of
+// the tree depends only on the number of elements, so that a
+// non-associative operation (such as floating-point addition) gives the
+// same result however many threads take part.
+constexpr std::ptrdiff_t reduce_block_size = 2048;
+
+// Subtrees smaller than this are never split across tasks, unless the policy
+// sets a grain size
+constexpr std::ptrdiff_t parallel_reduce_grain_size = 1 << 16;
+
+// The policy's grain size, if any, but never less than a leaf of the tree,
+// which is always reduced by a single task
+inline std::ptrdiff_t parallel_reduce_grain(const parallel_policy& policy)
+{
+    if (policy.grain_size() == 0) {
+        return parallel_reduce_grain_size;
+    }
+    const auto grain = static_cast<std::ptrdiff_t>(policy.grain_size());
+    return grain > reduce_block_size ? grain : reduce_block_size;
+}
+
+// The number of elements in the left subtree of a node with n > block
+// size elements: half of the leaves, rounded down
+template <typename D>
+constexpr D tree_reduce_split(D n)
+{
+    const D block = static_cast<D>(reduce_block_size);
+    const D num_blocks = (n + block - 1) / block;
+    return (num_blocks / 2) * block;
+}
+
+// Returns the reduction of f(first), f(first + 1) ... f(first + n - 1)
+// under op. n must be greater than zero.
+template <typename T, typename D, typename Op, typename F>
+constexpr T tree_reduce(D first, D n, Op& op, F& f)
+{
+    if (n <= static_cast<D>(reduce_block_size)) {
+        T acc = f(first);
+        for (D i = first + 1; i != first + n; ++i) {
+            acc = nano::invoke(op, std::move(acc), f(i));
+        }
+        return acc;
+    }
+
+    const D left_n = detail::tree_reduce_split(n);
+    T left = detail::tree_reduce<T>(first, left_n, op, f);
+    T right = detail::tree_reduce<T>(first + left_n, n - left_n, op, f);
+    left = nano::invoke(op, std::move(left), std::move(right));
+    return left;
+}
+
+// As tree_reduce(), but the left subtree of each large enough node is
+// forked as a task on ex
+template <typename T, typename D, typename Op, typename F>
+T parallel_tree_reduce_node(D first, D n, Op& op, F& f, D grain,
+                            executor& ex)
+{
+    if (n <= grain) {
+        return detail::tree_reduce<T>(first, n, op, f);
+    }
+
+    const D left_n = detail::tree_reduce_split(n);
+    std::optional<T> left;
+    std::optional<T> right;
+    auto reduce_left = [&] {
+        left.emplace(detail::parallel_tree_reduce_node<T>(first, left_n, op, f,
+                                                          grain, ex));
+    };
+    auto reduce_right = [&] {
+        right.emplace(detail::parallel_tree_reduce_node<T>(
+            first + left_n, n - left_n, op, f, grain, ex));
+    };
+    detail::parallel_invoke(ex, reduce_left, reduce_right);
+
+    *left = nano::invoke(op, std::move(*left), std::move(*right));
+    return std::move(*left);
+}
+
+template <typename T, typename D, typename Op, typename F>
+T parallel_tree_reduce(D n, Op& op, F& f, const parallel_policy& policy)
+{
+    executor& ex = policy.get_executor();
+    const auto min_grain = static_cast<D>(detail::parallel_reduce_grain(policy));
+    if (n <= min_grain || ex.concurrency() == 1) {
+        return detail::tree_reduce<T>(D{0}, n, op, f);
+    }
+
+    // Aim for a few tasks per thread, so that idle threads can steal work
+    D grain = n / static_cast<D>(4 * ex.concurrency());
+    if (grain < min_grain) {
+        grain = min_grain;
+    }
+    return detail::parallel_tree_reduce_node<T>(D{0}, n, op, f, grain, ex);
+}
+
+} // namespace detail
+
+NANO_END_NAMESPACE
+
+#endif
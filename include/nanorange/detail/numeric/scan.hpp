@@ -0,0 +1,206 @@
+// nanorange/detail/numeric/scan.hpp
+//
+// Copyright (c) 2020 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_DETAIL_NUMERIC_SCAN_HPP_INCLUDED
+#define NANORANGE_DETAIL_NUMERIC_SCAN_HPP_INCLUDED
+
+#include <nanorange/detail/numeric/reduce.hpp>
+#include <nanorange/detail/numeric/simd_scan.hpp>
+#include <nanorange/execution/policy.hpp>
+#include <nanorange/iterator/concepts.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <vector>
+
+NANO_BEGIN_NAMESPACE
+
+namespace detail {
+
+// The policy overloads of the scans split their input into chunks of this
+// many elements. Each output is the combination of the carry into its chunk
+// (everything before the chunk) with the scan within the chunk, so as for
+// the reductions, the grouping of the operations depends only on the input
+// length and not on the number of threads (or the grain size, which only
+// sets how many whole chunks each task takes at least).
+constexpr std::ptrdiff_t scan_chunk_size = 1 << 14;
+
+// As reducible, but the carry into each chunk is copied for the task which
+// scans it while the running carry goes on to the next chunk
+template <typename Op, typename T, typename U>
+NANO_CONCEPT scannable = reducible<Op, T, U> && copyable<T>;
+
+template <typename T, typename I, typename Op, typename Proj>
+T scan_chunk_fold(I first, iter_difference_t<I> n, Op& op, Proj& proj)
+{
+    if constexpr (simd_scannable<I, T*, T, Op, Proj>) {
+        return detail::simd_sum(std::addressof(*first),
+                                static_cast<std::ptrdiff_t>(n));
+    } else {
+        T acc = nano::invoke(proj, first[0]);
+        for (iter_difference_t<I> i = 1; i < n; ++i) {
+            acc = nano::invoke(op, std::move(acc),
+                               nano::invoke(proj, first[i]));
+        }
+        return acc;
+    }
+}
+
+// Writes the scan of the n > 0 elements at first to result, each output
+// being combined on the left with *carry if carry is non-null. Returns the
+// fold of the chunk alone. Every input element is read before the output at
+// the same position is written, so first and result may be equal.
+template <bool Inclusive, typename T, typename I, typename O, typename Op,
+          typename Proj>
+T scan_chunk(I first, iter_difference_t<I> n, O result, const T* carry,
+             Op& op, Proj& proj)
+{
+    using D = iter_difference_t<I>;
+
+    if constexpr (simd_scannable<I, O, T, Op, Proj>) {
+        return detail::simd_scan<Inclusive>(std::addressof(*first),
+                                            static_cast<std::ptrdiff_t>(n),
+                                            std::addressof(*result),
+                                            carry ? *carry : T(0));
+    }
+
+    T local = nano::invoke(proj, first[0]);
+    if constexpr (Inclusive) {
+        if (carry) {
+            result[0] = nano::invoke(op, *carry, local);
+        } else {
+            result[0] = local;
+        }
+    } else {
+        result[0] = *carry;
+    }
+
+    for (D i = 1; i < n; ++i) {
+        if constexpr (Inclusive) {
+            local = nano::invoke(op, std::move(local),
+                                 nano::invoke(proj, first[i]));
+            if (carry) {
+                result[i] = nano::invoke(op, *carry, local);
+            } else {
+                result[i] = local;
+            }
+        } else {
+            T next = nano::invoke(op, local, nano::invoke(proj, first[i]));
+            result[i] = nano::invoke(op, *carry, local);
+            local = std::move(next);
+        }
+    }
+
+    return local;
+}
+
+// Scans the n elements at first into result, in chunks of scan_chunk_size.
+// For an exclusive scan carry must hold the initial value; for an inclusive
+// scan it must be empty.
+template <bool Inclusive, typename T, typename EP, typename I, typename O,
+          typename Op, typename Proj>
+void chunked_scan(EP& policy, I first, iter_difference_t<I> n, O result,
+                  std::optional<T> carry, Op& op, Proj& proj)
+{
+    using D = iter_difference_t<I>;
+    constexpr D chunk = static_cast<D>(scan_chunk_size);
+
+    if (n == 0) {
+        return;
+    }
+
+    const D num_chunks = (n + chunk - 1) / chunk;
+    const auto chunk_length = [n](D k) {
+        return k == n / chunk ? n % chunk : chunk;
+    };
+
+    const auto next_carry = [&op](std::optional<T>& c, T&& sum) {
+        if (c) {
+            *c = nano::invoke(op, std::move(*c), std::move(sum));
+        } else {
+            c.emplace(std::move(sum));
+        }
+    };
+
+    // Each task takes a contiguous run of chunks holding at least the
+    // policy's grain size of elements, and a few tasks per thread
+    D num_tasks = 1;
+    if constexpr (parallel_execution_policy<EP>) {
+        const std::size_t grain = policy.grain_size();
+        const std::size_t chunks_per_task =
+            grain == 0 ? 1 : (grain - 1) / scan_chunk_size + 1;
+        const std::size_t concurrency = policy.get_executor().concurrency();
+        if (concurrency > 1) {
+            num_tasks = static_cast<D>(std::min(
+                static_cast<std::size_t>(num_chunks) / chunks_per_task,
+                4 * concurrency));
+        }
+    }
+    const bool parallel = num_tasks > 1;
+
+    // On one thread, fuse the passes
+    if (!parallel) {
+        for (D k = 0; k < num_chunks; ++k) {
+            T sum = detail::scan_chunk<Inclusive>(
+                first + k * chunk, chunk_length(k), result + k * chunk,
+                carry ? &*carry : nullptr, op, proj);
+            next_carry(carry, std::move(sum));
+        }
+        return;
+    }
+
+    if constexpr (parallel_execution_policy<EP>) {
+        executor& ex = policy.get_executor();
+
+        const auto for_each_chunk = [&](auto&& fn) {
+            auto task = [&](std::ptrdiff_t t) {
+                const D begin = static_cast<D>(t) * num_chunks / num_tasks;
+                const D end = (static_cast<D>(t) + 1) * num_chunks / num_tasks;
+                for (D k = begin; k < end; ++k) {
+                    fn(k);
+                }
+            };
+            detail::parallel_for(ex, static_cast<std::ptrdiff_t>(num_tasks),
+                                 task);
+        };
+
+        // First pass: the fold of every chunk but the last
+        std::vector<std::optional<T>> carries(
+            static_cast<std::size_t>(num_chunks));
+        for_each_chunk([&](D k) {
+            if (k != num_chunks - 1) {
+                carries[static_cast<std::size_t>(k)].emplace(
+                    detail::scan_chunk_fold<T>(first + k * chunk, chunk, op,
+                                               proj));
+            }
+        });
+
+        // Replace the folds by the carry into each chunk
+        for (D k = 0; k < num_chunks; ++k) {
+            auto& slot = carries[static_cast<std::size_t>(k)];
+            std::optional<T> sum = std::move(slot);
+            slot = carry;
+            if (sum) {
+                next_carry(carry, std::move(*sum));
+            }
+        }
+
+        // Second pass: scan each chunk, starting from its carry
+        for_each_chunk([&](D k) {
+            const auto& c = carries[static_cast<std::size_t>(k)];
+            detail::scan_chunk<Inclusive>(first + k * chunk, chunk_length(k),
+                                          result + k * chunk,
+                                          c ? &*c : nullptr, op, proj);
+        });
+    }
+}
+
+} // namespace detail
+
+NANO_END_NAMESPACE
+
+#endif
@@ -0,0 +1,242 @@
+// nanorange/detail/numeric/simd_scan.hpp
+//
+// Copyright (c) 2020 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_DETAIL_NUMERIC_SIMD_SCAN_HPP_INCLUDED
+#define NANORANGE_DETAIL_NUMERIC_SIMD_SCAN_HPP_INCLUDED
+
+#include <nanorange/detail/algorithm/simd_find.hpp>
+
+#include <cstddef>
+#include <functional>
+
+NANO_BEGIN_NAMESPACE
+
+namespace detail {
+
+// Whether a scan of [I, I + n) into O with op and proj, accumulating into a
+// T, can use the vectorised kernels below. Only sums of 32- and 64-bit
+// integers are supported: integer addition (modulo 2^N) is associative, so
+// the kernels give exactly the results of a left fold. Floating-point sums
+// would be regrouped, so they are left to the scalar code.
+template <typename I, typename O, typename T, typename Op, typename Proj,
+          typename = void>
+inline constexpr bool simd_scannable = false;
+
+template <typename I, typename O, typename T, typename Op, typename Proj>
+inline constexpr bool simd_scannable<
+    I, O, T, Op, Proj,
+    std::enable_if_t<known_contiguous_iterator<I> &&
+                     known_contiguous_iterator<O>>> =
+    (same_as<Op, std::plus<>> || same_as<Op, std::plus<T>>) &&
+    same_as<Proj, identity> &&
+    std::is_integral<T>::value && !same_as<T, bool> &&
+    (sizeof(T) == 4 || sizeof(T) == 8) &&
+    (same_as<iter_reference_t<I>, const T&> ||
+     same_as<iter_reference_t<I>, T&>) &&
+    same_as<iter_reference_t<O>, T&>;
+
+#ifdef NANO_HAS_X86_SIMD
+
+// SSE2 ---------------------------------------------------------------------
+
+// The inclusive prefix sum of the lanes of x
+template <typename T>
+__m128i sse2_prefix_sum(__m128i x)
+{
+    if constexpr (sizeof(T) == 4) {
+        x = _mm_add_epi32(x, _mm_slli_si128(x, 4));
+        return _mm_add_epi32(x, _mm_slli_si128(x, 8));
+    } else {
+        return _mm_add_epi64(x, _mm_slli_si128(x, 8));
+    }
+}
+
+// The last lane of x, in every lane
+template <typename T>
+__m128i sse2_broadcast_last(__m128i x)
+{
+    if constexpr (sizeof(T) == 4) {
+        return _mm_shuffle_epi32(x, 0xFF);
+    } else {
+        return _mm_unpackhi_epi64(x, x);
+    }
+}
+
+template <typename T>
+__m128i sse2_add(__m128i a, __m128i b)
+{
+    return sizeof(T) == 4 ? _mm_add_epi32(a, b) : _mm_add_epi64(a, b);
+}
+
+template <typename T>
+__m128i sse2_sub_lanes(__m128i a, __m128i b)
+{
+    return sizeof(T) == 4 ? _mm_sub_epi32(a, b) : _mm_sub_epi64(a, b);
+}
+
+// Scans as many whole vectors as fit in [in, in + n), adding carry to every
+// output, and returns the number of elements processed. carry is updated to
+// the last inclusive output.
+template <bool Inclusive, typename T>
+std::ptrdiff_t simd_scan_sse2(const T* in, std::ptrdiff_t n, T* out,
+                              T& carry)
+{
+    constexpr std::ptrdiff_t lanes = 16 / sizeof(T);
+    __m128i acc = detail::sse2_broadcast(carry);
+    std::ptrdiff_t i = 0;
+
+    for (; n - i >= lanes; i += lanes) {
+        const __m128i x =
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+        const __m128i sum =
+            detail::sse2_add<T>(detail::sse2_prefix_sum<T>(x), acc);
+        // The exclusive sum is the inclusive sum less the element itself
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i),
+                         Inclusive ? sum : detail::sse2_sub_lanes<T>(sum, x));
+        acc = detail::sse2_broadcast_last<T>(sum);
+    }
+
+    T lane[lanes];
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(lane), acc);
+    carry = lane[0];
+    return i;
+}
+
+// AVX2 ---------------------------------------------------------------------
+
+// The inclusive prefix sum of the lanes of x. Byte shifts only move data
+// within each 128-bit half, so the halves are scanned separately and the
+// total of the low half is then added to the high half.
+template <typename T>
+NANO_TARGET_AVX2 __m256i avx2_prefix_sum(__m256i x)
+{
+    if constexpr (sizeof(T) == 4) {
+        x = _mm256_add_epi32(x, _mm256_slli_si256(x, 4));
+        x = _mm256_add_epi32(x, _mm256_slli_si256(x, 8));
+        const __m256i low_total = _mm256_permute2x128_si256(
+            _mm256_shuffle_epi32(x, 0xFF), x, 0x08);
+        return _mm256_add_epi32(x, low_total);
+    } else {
+        x = _mm256_add_epi64(x, _mm256_slli_si256(x, 8));
+        const __m256i low_total = _mm256_blend_epi32(
+            _mm256_setzero_si256(), _mm256_permute4x64_epi64(x, 0x55), 0xF0);
+        return _mm256_add_epi64(x, low_total);
+    }
+}
+
+template <typename T>
+NANO_TARGET_AVX2 __m256i avx2_broadcast_last(__m256i x)
+{
+    if constexpr (sizeof(T) == 4) {
+        return _mm256_permutevar8x32_epi32(x, _mm256_set1_epi32(7));
+    } else {
+        return _mm256_permute4x64_epi64(x, 0xFF);
+    }
+}
+
+template <typename T>
+NANO_TARGET_AVX2 __m256i avx2_add(__m256i a, __m256i b)
+{
+    return sizeof(T) == 4 ? _mm256_add_epi32(a, b) : _mm256_add_epi64(a, b);
+}
+
+template <typename T>
+NANO_TARGET_AVX2 __m256i avx2_sub_lanes(__m256i a, __m256i b)
+{
+    return sizeof(T) == 4 ? _mm256_sub_epi32(a, b) : _mm256_sub_epi64(a, b);
+}
+
+template <bool Inclusive, typename T>
+NANO_TARGET_AVX2 std::ptrdiff_t simd_scan_avx2(const T* in, std::ptrdiff_t n,
+                                               T* out, T& carry)
+{
+    constexpr std::ptrdiff_t lanes = 32 / sizeof(T);
+    __m256i acc = detail::avx2_broadcast(carry);
+    std::ptrdiff_t i = 0;
+
+    for (; n - i >= lanes; i += lanes) {
+        const __m256i x =
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i));
+        const __m256i sum =
+            detail::avx2_add<T>(detail::avx2_prefix_sum<T>(x), acc);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i),
+                            Inclusive ? sum
+                                      : detail::avx2_sub_lanes<T>(sum, x));
+        acc = detail::avx2_broadcast_last<T>(sum);
+    }
+
+    T lane[lanes];
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(lane), acc);
+    carry = lane[0];
+    return i;
+}
+
+#endif // NANO_HAS_X86_SIMD
+
+// Writes the scan of the n elements at in to out, each output having carry
+// added to it, and returns the sum of the n elements alone. in and out may
+// be equal.
+template <bool Inclusive, typename T>
+T simd_scan(const T* in, std::ptrdiff_t n, T* out, T carry)
+{
+    // Wrapping arithmetic, to match the vector lanes
+    using U = std::make_unsigned_t<T>;
+    T running = carry;
+    std::ptrdiff_t i = 0;
+
+#ifdef NANO_HAS_X86_SIMD
+    if (detail::cpu_has_avx2()) {
+        i = detail::simd_scan_avx2<Inclusive>(in, n, out, running);
+    } else {
+        i = detail::simd_scan_sse2<Inclusive>(in, n, out, running);
+    }
+#endif
+
+    U acc = static_cast<U>(running);
+    for (; i < n; ++i) {
+        const U x = static_cast<U>(in[i]);
+        if constexpr (Inclusive) {
+            acc += x;
+            out[i] = static_cast<T>(acc);
+        } else {
+            out[i] = static_cast<T>(acc);
+            acc += x;
+        }
+    }
+
+    return static_cast<T>(acc - static_cast<U>(carry));
+}
+
+// The sum of the n elements at in
+template <typename T>
+T simd_sum(const T* in, std::ptrdiff_t n)
+{
+    using U = std::make_unsigned_t<T>;
+    // Independent accumulators, so that the loop is not limited by the
+    // latency of a single chain of additions and can be vectorised
+    U acc[8] = {};
+    U total = 0;
+    // The odd elements first, leaving a multiple of 8
+    std::ptrdiff_t i = 0;
+    for (; i < n % 8; ++i) {
+        total += static_cast<U>(in[i]);
+    }
+    for (; i < n; i += 8) {
+        for (int j = 0; j < 8; j++) {
+            acc[j] += static_cast<U>(in[i + j]);
+        }
+    }
+    for (U a : acc) {
+        total += a;
+    }
+    return static_cast<T>(total);
+}
+
+} // namespace detail
+
+NANO_END_NAMESPACE
+
+#endif
@@ -77,6 +77,18 @@ template <>
 struct priority_tag<0> {
 };
 
+// Returns true during constant evaluation, allowing algorithms to select a
+// faster non-constexpr implementation at run time. Without compiler support
+// we cannot tell, so we must always assume we are in a constant expression.
+constexpr bool is_constant_evaluated() noexcept
+{
+#ifdef NANO_HAS_BUILTIN_IS_CONSTANT_EVALUATED
+    return __builtin_is_constant_evaluated();
+#else
+    return true;
+#endif
+}
+
 } // namespace detail
 
 NANO_END_NAMESPACE
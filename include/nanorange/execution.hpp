@@ -0,0 +1,14 @@
+// nanorange/execution.hpp
+//
+// Copyright (c) 2020 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_EXECUTION_HPP_INCLUDED
+#define NANORANGE_EXECUTION_HPP_INCLUDED
+
+#include <nanorange/execution/executor.hpp>
+#include <nanorange/execution/policy.hpp>
+#include <nanorange/execution/thread_pool.hpp>
+
+#endif
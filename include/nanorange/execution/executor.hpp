@@ -0,0 +1,177 @@
+// nanorange/execution/executor.hpp
+//
+// Copyright (c) 2020 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_EXECUTION_EXECUTOR_HPP_INCLUDED
+#define NANORANGE_EXECUTION_EXECUTOR_HPP_INCLUDED
+
+#include <nanorange/detail/macros.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+NANO_BEGIN_NAMESPACE
+
+namespace detail {
+
+// The set of tasks forked by a single parallel algorithm invocation. Joining
+// the group waits for all of them, and rethrows the first exception (if any)
+// that one of them raised.
+struct task_group {
+    std::atomic<std::size_t> pending{0};
+    std::mutex error_mutex;
+    std::exception_ptr error;
+};
+
+} // namespace detail
+
+// The interface through which the parallel algorithms run their tasks.
+// thread_pool is one implementation; a program which already has threads of
+// its own can implement it to run the algorithms' tasks on them instead, so
+// that the library doesn't start any threads.
+//
+// An implementation provides submit(), which queues a task to be run later
+// on any thread, and try_run_one(), which runs a queued task on the calling
+// thread if there is one. A thread which waits for its tasks to complete
+// calls try_run_one() until they have, so an executor whose try_run_one()
+// never runs anything must have other threads to run its tasks, and those
+// tasks may themselves fork and wait.
+class executor {
+public:
+    // A unit of work queued on an executor. Whoever takes the task from the
+    // queue calls run() exactly once and then destroys it; run() doesn't
+    // throw.
+    struct task {
+        virtual ~task() = default;
+        virtual void run() noexcept = 0;
+    };
+
+    executor() = default;
+    executor(const executor&) = delete;
+    executor& operator=(const executor&) = delete;
+    virtual ~executor() = default;
+
+    // The number of threads which may run tasks at once, including the one
+    // which waits for them. Algorithms don't split their work when this is
+    // one.
+    virtual std::size_t concurrency() const noexcept = 0;
+
+    // Schedules f() to be run as part of group. If f cannot be scheduled,
+    // the exception is thrown here and group is left unchanged.
+    template <typename F>
+    void fork(detail::task_group& group, F&& f)
+    {
+        auto fn = [&group, f = std::forward<F>(f)]() mutable noexcept {
+            try {
+                f();
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(group.error_mutex);
+                if (!group.error) {
+                    group.error = std::current_exception();
+                }
+            }
+            group.pending.fetch_sub(1, std::memory_order_acq_rel);
+        };
+
+        group.pending.fetch_add(1, std::memory_order_relaxed);
+        try {
+            submit(std::make_unique<task_impl<decltype(fn)>>(std::move(fn)));
+        } catch (...) {
+            group.pending.fetch_sub(1, std::memory_order_relaxed);
+            throw;
+        }
+    }
+
+    // Runs queued tasks on the calling thread until every task in group has
+    // completed
+    void wait(detail::task_group& group) noexcept
+    {
+        while (group.pending.load(std::memory_order_acquire) != 0) {
+            if (!try_run_one()) {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    // As wait(), but rethrows the first exception raised by a task in group
+    void join(detail::task_group& group)
+    {
+        wait(group);
+        if (group.error) {
+            std::rethrow_exception(std::exchange(group.error, nullptr));
+        }
+    }
+
+protected:
+    // Queues t to be run. If it cannot be queued, throws, and t is
+    // destroyed without being run.
+    virtual void submit(std::unique_ptr<task> t) = 0;
+
+    // Runs one queued task on the calling thread, if there is one, and
+    // returns whether it did
+    virtual bool try_run_one() noexcept = 0;
+
+private:
+    template <typename F>
+    struct task_impl final : task {
+        explicit task_impl(F&& f) : f_(std::move(f)) {}
+
+        void run() noexcept override { f_(); }
+
+    private:
+        F f_;
+    };
+};
+
+namespace detail {
+
+// Calls f(i) for every i in [0, count) as tasks on ex, with the calling
+// thread taking the first, and returns once all of the calls have finished.
+// The first exception thrown by any call is then rethrown.
+template <typename F>
+void parallel_for(executor& ex, std::ptrdiff_t count, F& f)
+{
+    task_group group;
+    try {
+        for (std::ptrdiff_t i = 1; i < count; i++) {
+            ex.fork(group, [&f, i] { f(i); });
+        }
+        if (count > 0) {
+            f(std::ptrdiff_t{0});
+        }
+    } catch (...) {
+        ex.wait(group);
+        throw;
+    }
+    ex.join(group);
+}
+
+// Calls f() as a task on ex and g() on the calling thread, and returns once
+// both have finished. The first exception thrown by either is then rethrown.
+template <typename F, typename G>
+void parallel_invoke(executor& ex, F& f, G& g)
+{
+    task_group group;
+    ex.fork(group, [&f] { f(); });
+    try {
+        g();
+    } catch (...) {
+        // The forked task refers to f, which may refer to the caller's locals
+        ex.wait(group);
+        throw;
+    }
+    ex.join(group);
+}
+
+} // namespace detail
+
+NANO_END_NAMESPACE
+
+#endif
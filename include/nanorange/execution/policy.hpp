@@ -0,0 +1,88 @@
+// nanorange/execution/policy.hpp
+//
+// Copyright (c) 2020 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_EXECUTION_POLICY_HPP_INCLUDED
+#define NANORANGE_EXECUTION_POLICY_HPP_INCLUDED
+
+#include <nanorange/detail/type_traits.hpp>
+#include <nanorange/execution/executor.hpp>
+#include <nanorange/execution/thread_pool.hpp>
+
+#include <cstddef>
+
+NANO_BEGIN_NAMESPACE
+
+// Requests that an algorithm runs sequentially on the calling thread
+struct sequenced_policy {};
+
+// Permits an algorithm to be split into tasks which run on an executor.
+// Unless another executor, such as a thread_pool, is supplied via on(), the
+// default executor is used.
+//
+// Algorithms which split their input into independent chunks, such as the
+// parallel for_each(), never make a chunk smaller than the grain size, in
+// elements, given by with_grain_size(); likewise the parallel sort() sorts
+// any partition smaller than the grain size on a single thread. A grain size
+// of zero (the default) lets each algorithm choose.
+struct parallel_policy {
+    constexpr parallel_policy() = default;
+
+    constexpr parallel_policy on(executor& ex) const noexcept
+    {
+        return parallel_policy{&ex, grain_size_};
+    }
+
+    constexpr parallel_policy with_grain_size(std::size_t grain_size) const
+        noexcept
+    {
+        return parallel_policy{ex_, grain_size};
+    }
+
+    executor& get_executor() const
+    {
+        return ex_ ? *ex_ : detail::default_executor();
+    }
+
+    constexpr std::size_t grain_size() const noexcept { return grain_size_; }
+
+private:
+    constexpr parallel_policy(executor* ex, std::size_t grain_size)
+        : ex_(ex), grain_size_(grain_size)
+    {}
+
+    executor* ex_ = nullptr;
+    std::size_t grain_size_ = 0;
+};
+
+inline constexpr sequenced_policy seq{};
+inline constexpr parallel_policy par{};
+
+template <typename T>
+struct is_execution_policy : std::false_type {};
+
+template <>
+struct is_execution_policy<sequenced_policy> : std::true_type {};
+
+template <>
+struct is_execution_policy<parallel_policy> : std::true_type {};
+
+template <typename T>
+inline constexpr bool is_execution_policy_v = is_execution_policy<T>::value;
+
+namespace detail {
+
+template <typename EP>
+NANO_CONCEPT execution_policy = is_execution_policy_v<remove_cvref_t<EP>>;
+
+template <typename EP>
+NANO_CONCEPT parallel_execution_policy =
+    std::is_same<remove_cvref_t<EP>, parallel_policy>::value;
+
+} // namespace detail
+
+NANO_END_NAMESPACE
+
+#endif
@@ -0,0 +1,310 @@
+// nanorange/execution/thread_pool.hpp
+//
+// Copyright (c) 2020 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_EXECUTION_THREAD_POOL_HPP_INCLUDED
+#define NANORANGE_EXECUTION_THREAD_POOL_HPP_INCLUDED
+
+#include <nanorange/detail/execution/chase_lev_deque.hpp>
+#include <nanorange/detail/macros.hpp>
+#include <nanorange/execution/executor.hpp>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+NANO_BEGIN_NAMESPACE
+
+class thread_pool;
+
+namespace detail {
+
+// Tasks forked by threads which don't belong to the pool. Any number of
+// threads may push to it, so unlike the workers' deques it takes a lock; it
+// is only used when a parallel algorithm starts, as tasks forked by other
+// tasks go on the worker's own deque.
+struct injection_queue {
+    void push(executor::task* task)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        tasks_.push_back(task);
+    }
+
+    executor::task* pop()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (tasks_.empty()) {
+            return nullptr;
+        }
+        executor::task* task = tasks_.back();
+        tasks_.pop_back();
+        return task;
+    }
+
+    executor::task* steal()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (tasks_.empty()) {
+            return nullptr;
+        }
+        executor::task* task = tasks_.front();
+        tasks_.pop_front();
+        return task;
+    }
+
+private:
+    std::mutex mutex_;
+    std::deque<executor::task*> tasks_;
+};
+
+struct current_worker_t {
+    const thread_pool* pool = nullptr;
+    std::size_t index = 0;
+};
+
+inline current_worker_t& current_worker()
+{
+    static thread_local current_worker_t worker;
+    return worker;
+}
+
+} // namespace detail
+
+// A fixed-size work-stealing thread pool, and the executor which runs the
+// parallel overloads of the algorithms unless another is supplied. The
+// concurrency passed to the constructor includes the thread which calls into
+// a parallel algorithm, as that thread executes tasks while it waits for
+// them to complete: a pool with a concurrency of N starts N - 1 worker
+// threads, and a pool with a concurrency of one starts none.
+//
+// Each worker owns a Chase-Lev deque, onto which it pushes the tasks it
+// forks. An idle worker pops from its own deque first, and otherwise steals
+// from the other end of someone else's, so work spreads out from whichever
+// threads have it without any central lock.
+class thread_pool final : public executor {
+public:
+    explicit thread_pool(std::size_t concurrency = default_concurrency())
+        : num_workers_(concurrency > 1 ? concurrency - 1 : 0)
+    {
+        deques_.reserve(num_workers_);
+        for (std::size_t i = 0; i < num_workers_; i++) {
+            deques_.push_back(std::make_unique<detail::chase_lev_deque<task>>());
+        }
+
+        threads_.reserve(num_workers_);
+        try {
+            for (std::size_t i = 0; i < num_workers_; i++) {
+                threads_.emplace_back([this, i] { worker_loop(i); });
+            }
+        } catch (...) {
+            stop();
+            throw;
+        }
+    }
+
+    ~thread_pool() override { stop(); }
+
+    std::size_t concurrency() const noexcept override
+    {
+        return num_workers_ + 1;
+    }
+
+    static std::size_t default_concurrency() noexcept
+    {
+        const unsigned n = std::thread::hardware_concurrency();
+        return n > 0 ? n : 1;
+    }
+
+private:
+    // The index of the calling thread's deque, or num_workers_ if the thread
+    // doesn't belong to this pool
+    std::size_t own_deque_index() const noexcept
+    {
+        const auto& worker = detail::current_worker();
+        return worker.pool == this ? worker.index : num_workers_;
+    }
+
+    void submit(std::unique_ptr<task> t) override
+    {
+        // Count the task before it becomes visible, so that queued_ is never
+        // less than the number of tasks which can be taken
+        queued_.fetch_add(1, std::memory_order_seq_cst);
+        try {
+            const std::size_t own = own_deque_index();
+            if (own < num_workers_) {
+                deques_[own]->push(t.get());
+            } else {
+                injection_.push(t.get());
+            }
+        } catch (...) {
+            queued_.fetch_sub(1, std::memory_order_relaxed);
+            throw;
+        }
+        t.release();
+
+        // Pairs with worker_loop(): either the sleeper sees queued_ > 0, or
+        // we see it sleeping and take the lock before notifying, so that the
+        // notification can't arrive before it waits
+        if (sleeping_.load(std::memory_order_seq_cst) > 0) {
+            { std::lock_guard<std::mutex> lock(sleep_mutex_); }
+            sleep_cv_.notify_one();
+        }
+    }
+
+    task* take(std::size_t own) noexcept
+    {
+        if (own < num_workers_) {
+            if (task* t = deques_[own]->pop()) {
+                return t;
+            }
+            if (task* t = injection_.steal()) {
+                return t;
+            }
+        } else if (task* t = injection_.pop()) {
+            return t;
+        }
+
+        // Steal from the other workers, starting with the next one along so
+        // that thieves spread out over the victims
+        for (std::size_t i = 1; i <= num_workers_; i++) {
+            const std::size_t victim = (own + i) % (num_workers_ + 1);
+            if (victim == num_workers_) {
+                continue;
+            }
+            if (task* t = deques_[victim]->steal()) {
+                return t;
+            }
+        }
+        return nullptr;
+    }
+
+    bool try_run_one() noexcept override
+    {
+        std::unique_ptr<task> t(take(own_deque_index()));
+        if (!t) {
+            return false;
+        }
+        queued_.fetch_sub(1, std::memory_order_relaxed);
+        t->run();
+        return true;
+    }
+
+    void worker_loop(std::size_t index)
+    {
+        detail::current_worker() = {this, index};
+
+        while (true) {
+            if (try_run_one()) {
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(sleep_mutex_);
+            sleeping_.fetch_add(1, std::memory_order_seq_cst);
+            sleep_cv_.wait(lock, [this] {
+                return stop_ || queued_.load(std::memory_order_seq_cst) > 0;
+            });
+            sleeping_.fetch_sub(1, std::memory_order_relaxed);
+            if (stop_ && queued_.load(std::memory_order_relaxed) == 0) {
+                return;
+            }
+        }
+    }
+
+    void stop() noexcept
+    {
+        {
+            std::lock_guard<std::mutex> lock(sleep_mutex_);
+            stop_ = true;
+        }
+        sleep_cv_.notify_all();
+        for (auto& t : threads_) {
+            t.join();
+        }
+    }
+
+    const std::size_t num_workers_;
+    std::vector<std::unique_ptr<detail::chase_lev_deque<task>>> deques_;
+    detail::injection_queue injection_;
+    std::vector<std::thread> threads_;
+    std::atomic<std::size_t> queued_{0};
+    std::atomic<std::size_t> sleeping_{0};
+    std::mutex sleep_mutex_;
+    std::condition_variable sleep_cv_;
+    bool stop_ = false;
+};
+
+namespace detail {
+
+inline std::atomic<executor*>& installed_executor() noexcept
+{
+    static std::atomic<executor*> ex{nullptr};
+    return ex;
+}
+
+// The executor used by parallel algorithms when the policy doesn't name one:
+// the executor installed with set_default_executor() if there is one, and
+// otherwise a thread pool with one thread per core, which is created on
+// first use. Defining NANORANGE_NO_DEFAULT_THREAD_POOL replaces the latter
+// with a pool of concurrency one, so that the library never starts threads
+// of its own.
+inline executor& default_executor()
+{
+    if (executor* ex = installed_executor().load(std::memory_order_acquire)) {
+        return *ex;
+    }
+#ifdef NANORANGE_NO_DEFAULT_THREAD_POOL
+    static thread_pool pool(1);
+#else
+    static thread_pool pool;
+#endif
+    return pool;
+}
+
+} // namespace detail
+
+// Returns the executor installed with set_default_executor(), or nullptr if
+// none is
+inline executor* get_default_executor() noexcept
+{
+    return detail::installed_executor().load(std::memory_order_acquire);
+}
+
+// Makes the parallel algorithms use ex whenever the policy doesn't name an
+// executor, in every thread, and returns the executor which was installed
+// before. Passing nullptr restores the library's own thread pool, which is
+// only created if a parallel algorithm runs while nothing is installed. The
+// executor must outlive every algorithm call which might use it.
+inline executor* set_default_executor(executor* ex) noexcept
+{
+    return detail::installed_executor().exchange(ex,
+                                                 std::memory_order_acq_rel);
+}
+
+// Installs a default executor for the lifetime of the object, restoring the
+// previous one on destruction
+class scoped_default_executor {
+public:
+    explicit scoped_default_executor(executor& ex) noexcept
+        : old_(nano::set_default_executor(&ex))
+    {}
+
+    scoped_default_executor(const scoped_default_executor&) = delete;
+    scoped_default_executor&
+    operator=(const scoped_default_executor&) = delete;
+
+    ~scoped_default_executor() { nano::set_default_executor(old_); }
+
+private:
+    executor* old_;
+};
+
+NANO_END_NAMESPACE
+
+#endif
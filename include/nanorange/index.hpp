@@ -0,0 +1,12 @@
+// nanorange/index.hpp
+//
+// Copyright (c) 2020 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_INDEX_HPP_INCLUDED
+#define NANORANGE_INDEX_HPP_INCLUDED
+
+#include <nanorange/index/eytzinger_index.hpp>
+
+#endif
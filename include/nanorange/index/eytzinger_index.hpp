@@ -0,0 +1,303 @@
+// nanorange/index/eytzinger_index.hpp
+//
+// Copyright (c) 2020 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_INDEX_EYTZINGER_INDEX_HPP_INCLUDED
+#define NANORANGE_INDEX_EYTZINGER_INDEX_HPP_INCLUDED
+
+#include <nanorange/algorithm/min.hpp>
+#include <nanorange/detail/algorithm/branchless_search.hpp>
+#include <nanorange/ranges.hpp>
+#include <nanorange/views/subrange.hpp>
+
+#include <cstddef>
+#include <vector>
+
+NANO_BEGIN_NAMESPACE
+
+namespace detail {
+
+// Nodes of an Eytzinger tree of n elements are numbered from 1, with the
+// children of node k being 2k and 2k + 1. Node 0 stands for the end.
+
+// The node at which an in-order walk starts
+inline std::size_t eytzinger_first(std::size_t n) noexcept
+{
+    std::size_t k = n > 0 ? 1 : 0;
+    while (k != 0 && 2 * k <= n) {
+        k = 2 * k;
+    }
+    return k;
+}
+
+// Climbs from k past its trailing run of right-child links and one more,
+// i.e. to the nearest ancestor whose left subtree holds k
+inline std::size_t eytzinger_climb_right(std::size_t k) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return k >> (__builtin_ctzll(~static_cast<unsigned long long>(k)) + 1);
+#else
+    while (k & 1) {
+        k >>= 1;
+    }
+    return k >> 1;
+#endif
+}
+
+// As above, for left-child links
+inline std::size_t eytzinger_climb_left(std::size_t k) noexcept
+{
+    while (k != 0 && (k & 1) == 0) {
+        k >>= 1;
+    }
+    return k >> 1;
+}
+
+inline std::size_t eytzinger_next(std::size_t k, std::size_t n) noexcept
+{
+    if (2 * k + 1 <= n) {
+        k = 2 * k + 1;
+        while (2 * k <= n) {
+            k = 2 * k;
+        }
+        return k;
+    }
+    return detail::eytzinger_climb_right(k);
+}
+
+inline std::size_t eytzinger_prev(std::size_t k, std::size_t n) noexcept
+{
+    if (k == 0) {
+        k = 1;
+    } else if (2 * k <= n) {
+        k = 2 * k;
+    } else {
+        return detail::eytzinger_climb_left(k);
+    }
+    while (2 * k + 1 <= n) {
+        k = 2 * k + 1;
+    }
+    return k;
+}
+
+} // namespace detail
+
+// A read-only sorted sequence stored in Eytzinger (breadth-first binary heap)
+// order, so that a binary search visits the elements in the order they are
+// laid out in memory: the first few levels of the tree share cache lines and
+// stay hot, and the children several levels below a node are adjacent, so
+// they can be prefetched before the search reaches them.
+//
+// The index is built from a range sorted by comp and proj, and iterates over
+// its elements in that order. Its lower_bound(), upper_bound(), equal_range()
+// and contains() members give the same results as nano::lower_bound() and
+// friends over the original range.
+template <typename T, typename Proj = identity, typename Comp = ranges::less>
+class eytzinger_index {
+    static_assert(indirect_strict_weak_order<const Comp,
+                                             projected<const T*, Proj>>,
+                  "Comp must order the projected elements");
+
+public:
+    class iterator {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        // Extension: legacy typedefs
+        using pointer = const T*;
+        using reference = const T&;
+
+        iterator() = default;
+
+        const T& operator*() const { return data_[node_ - 1]; }
+
+        const T* operator->() const { return data_ + (node_ - 1); }
+
+        iterator& operator++()
+        {
+            node_ = detail::eytzinger_next(node_, size_);
+            return *this;
+        }
+
+        iterator operator++(int)
+        {
+            auto tmp = *this;
+            ++*this;
+            return tmp;
+        }
+
+        iterator& operator--()
+        {
+            node_ = detail::eytzinger_prev(node_, size_);
+            return *this;
+        }
+
+        iterator operator--(int)
+        {
+            auto tmp = *this;
+            --*this;
+            return tmp;
+        }
+
+        friend bool operator==(const iterator& x, const iterator& y)
+        {
+            return x.node_ == y.node_;
+        }
+
+        friend bool operator!=(const iterator& x, const iterator& y)
+        {
+            return !(x == y);
+        }
+
+    private:
+        friend class eytzinger_index;
+
+        iterator(const T* data, std::size_t size, std::size_t node)
+            : data_(data), size_(size), node_(node)
+        {}
+
+        const T* data_ = nullptr;
+        std::size_t size_ = 0;
+        std::size_t node_ = 0;
+    };
+
+    using value_type = T;
+    using size_type = std::size_t;
+    using const_iterator = iterator;
+
+    eytzinger_index() = default;
+
+    // Builds an index of the elements of sorted, which must be ordered by
+    // comp and proj
+    template <typename R,
+              std::enable_if_t<random_access_range<R> && sized_range<R> &&
+                                   constructible_from<T, range_reference_t<R>>,
+                               int> = 0>
+    explicit eytzinger_index(R&& sorted, Proj proj = Proj{},
+                             Comp comp = Comp{})
+        : proj_(std::move(proj)), comp_(std::move(comp))
+    {
+        const auto n = static_cast<std::size_t>(nano::distance(sorted));
+
+        // The position in sorted of the element at each node, found by an
+        // in-order walk of the tree
+        std::vector<std::size_t> rank(n);
+        std::size_t k = detail::eytzinger_first(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            rank[k - 1] = i;
+            k = detail::eytzinger_next(k, n);
+        }
+
+        const auto first = nano::begin(sorted);
+        data_.reserve(n);
+        for (std::size_t r : rank) {
+            data_.emplace_back(first[static_cast<range_difference_t<R>>(r)]);
+        }
+    }
+
+    iterator begin() const
+    {
+        return make_iterator(detail::eytzinger_first(size()));
+    }
+
+    iterator end() const { return make_iterator(0); }
+
+    size_type size() const noexcept { return data_.size(); }
+
+    bool empty() const noexcept { return data_.empty(); }
+
+    // The first element whose projection is not less than key
+    template <typename K>
+    std::enable_if_t<indirect_strict_weak_order<const Comp, const K*,
+                                                projected<const T*, Proj>>,
+                     iterator>
+    lower_bound(const K& key) const
+    {
+        return make_iterator(search<false>(key));
+    }
+
+    // The first element whose projection is greater than key
+    template <typename K>
+    std::enable_if_t<indirect_strict_weak_order<const Comp, const K*,
+                                                projected<const T*, Proj>>,
+                     iterator>
+    upper_bound(const K& key) const
+    {
+        return make_iterator(search<true>(key));
+    }
+
+    template <typename K>
+    std::enable_if_t<indirect_strict_weak_order<const Comp, const K*,
+                                                projected<const T*, Proj>>,
+                     subrange<iterator>>
+    equal_range(const K& key) const
+    {
+        return {lower_bound(key), upper_bound(key)};
+    }
+
+    template <typename K>
+    std::enable_if_t<indirect_strict_weak_order<const Comp, const K*,
+                                                projected<const T*, Proj>>,
+                     bool>
+    contains(const K& key) const
+    {
+        const std::size_t k = search<false>(key);
+        return k != 0 &&
+               !nano::invoke(comp_, key, nano::invoke(proj_, data_[k - 1]));
+    }
+
+private:
+    iterator make_iterator(std::size_t node) const
+    {
+        return iterator(data_.data(), data_.size(), node);
+    }
+
+    // The number of nodes of a level which fit in a cache line. Their
+    // descendants this many levels down are adjacent in memory.
+    static constexpr std::size_t prefetch_stride =
+        sizeof(T) >= 64 ? 1
+                        : sizeof(T) > 16 ? 2 : sizeof(T) > 8 ? 4
+                                                : sizeof(T) > 4 ? 8 : 16;
+
+    // Descends from the root, going right past elements which are less than
+    // key (or, if Upper, not greater than it), until falling off the bottom of
+    // the tree. The result is the last node at which the search went left, or
+    // 0 if there is none.
+    template <bool Upper, typename K>
+    std::size_t search(const K& key) const
+    {
+        const T* const data = data_.data();
+        const std::size_t n = data_.size();
+        std::size_t k = 1;
+
+        while (k <= n) {
+            detail::prefetch(data + ((nano::min)(k * prefetch_stride, n) - 1));
+            bool right;
+            if constexpr (Upper) {
+                right = !nano::invoke(comp_, key,
+                                      nano::invoke(proj_, data[k - 1]));
+            } else {
+                right = nano::invoke(comp_, nano::invoke(proj_, data[k - 1]),
+                                     key);
+            }
+            k = 2 * k + static_cast<std::size_t>(right);
+        }
+
+        return detail::eytzinger_climb_right(k);
+    }
+
+    std::vector<T> data_;
+    Proj proj_{};
+    Comp comp_{};
+};
+
+template <typename R, typename Proj = identity, typename Comp = ranges::less>
+eytzinger_index(R&&, Proj = Proj{}, Comp = Comp{})
+    -> eytzinger_index<range_value_t<R>, Proj, Comp>;
+
+NANO_END_NAMESPACE
+
+#endif
@@ -0,0 +1,80 @@
+// nanorange/memory/temporary_resource.hpp
+//
+// Copyright (c) 2019 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_MEMORY_TEMPORARY_RESOURCE_HPP_INCLUDED
+#define NANORANGE_MEMORY_TEMPORARY_RESOURCE_HPP_INCLUDED
+
+#include <nanorange/detail/macros.hpp>
+
+#if defined(__has_include)
+#if __has_include(<memory_resource>)
+#include <memory_resource>
+#define NANO_HAS_MEMORY_RESOURCE 1
+#endif
+#endif
+
+#ifdef NANO_HAS_MEMORY_RESOURCE
+
+NANO_BEGIN_NAMESPACE
+
+// Algorithms which need temporary storage -- stable_sort(), inplace_merge(),
+// stable_partition() and radix_sort() -- obtain it from the calling thread's
+// temporary resource if one has been set, rather than from the global
+// operator new. If the resource cannot satisfy a request (by throwing
+// std::bad_alloc), the algorithms fall back to their unbuffered versions,
+// just as they do when operator new fails.
+
+namespace detail {
+
+inline std::pmr::memory_resource*& temporary_resource_ref() noexcept
+{
+    static thread_local std::pmr::memory_resource* res = nullptr;
+    return res;
+}
+
+} // namespace detail
+
+// Returns the temporary resource for the calling thread, or nullptr if
+// temporary buffers are allocated with operator new
+inline std::pmr::memory_resource* get_temporary_resource() noexcept
+{
+    return detail::temporary_resource_ref();
+}
+
+// Sets the temporary resource for the calling thread, returning the previous
+// one. Passing nullptr restores the use of operator new.
+inline std::pmr::memory_resource*
+set_temporary_resource(std::pmr::memory_resource* res) noexcept
+{
+    auto& ref = detail::temporary_resource_ref();
+    auto* old = ref;
+    ref = res;
+    return old;
+}
+
+// Sets the calling thread's temporary resource for the lifetime of the
+// object, restoring the previous one on destruction
+class scoped_temporary_resource {
+public:
+    explicit scoped_temporary_resource(std::pmr::memory_resource* res) noexcept
+        : old_(nano::set_temporary_resource(res))
+    {}
+
+    scoped_temporary_resource(const scoped_temporary_resource&) = delete;
+    scoped_temporary_resource&
+    operator=(const scoped_temporary_resource&) = delete;
+
+    ~scoped_temporary_resource() { nano::set_temporary_resource(old_); }
+
+private:
+    std::pmr::memory_resource* old_;
+};
+
+NANO_END_NAMESPACE
+
+#endif // NANO_HAS_MEMORY_RESOURCE
+
+#endif
@@ -0,0 +1,66 @@
+// nanorange/numeric/accumulate.hpp
+//
+// Copyright (c) 2020 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_NUMERIC_ACCUMULATE_HPP_INCLUDED
+#define NANORANGE_NUMERIC_ACCUMULATE_HPP_INCLUDED
+
+#include <nanorange/detail/numeric/reduce.hpp>
+#include <nanorange/ranges.hpp>
+
+#include <functional>
+
+NANO_BEGIN_NAMESPACE
+
+namespace detail {
+
+// A strict left fold, as std::accumulate. Use nano::reduce when op is
+// associative and the order of evaluation does not matter.
+struct accumulate_fn {
+private:
+    template <typename I, typename S, typename T, typename Op, typename Proj>
+    static constexpr T impl(I first, S last, T init, Op& op, Proj& proj)
+    {
+        while (first != last) {
+            init = nano::invoke(op, std::move(init),
+                                nano::invoke(proj, *first));
+            ++first;
+        }
+        return init;
+    }
+
+public:
+    template <typename I, typename S, typename T, typename Op = std::plus<>,
+              typename Proj = identity>
+    constexpr std::enable_if_t<
+        input_iterator<I> && sentinel_for<S, I> &&
+            foldable<Op, T, indirect_result_t<Proj&, I>>,
+        T>
+    operator()(I first, S last, T init, Op op = Op{}, Proj proj = Proj{}) const
+    {
+        return accumulate_fn::impl(std::move(first), std::move(last),
+                                   std::move(init), op, proj);
+    }
+
+    template <typename Rng, typename T, typename Op = std::plus<>,
+              typename Proj = identity>
+    constexpr std::enable_if_t<
+        input_range<Rng> &&
+            foldable<Op, T, indirect_result_t<Proj&, iterator_t<Rng>>>,
+        T>
+    operator()(Rng&& rng, T init, Op op = Op{}, Proj proj = Proj{}) const
+    {
+        return accumulate_fn::impl(nano::begin(rng), nano::end(rng),
+                                   std::move(init), op, proj);
+    }
+};
+
+} // namespace detail
+
+NANO_INLINE_VAR(detail::accumulate_fn, accumulate)
+
+NANO_END_NAMESPACE
+
+#endif
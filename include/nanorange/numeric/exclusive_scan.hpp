@@ -0,0 +1,141 @@
+// nanorange/numeric/exclusive_scan.hpp
+//
+// Copyright (c) 2020 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_NUMERIC_EXCLUSIVE_SCAN_HPP_INCLUDED
+#define NANORANGE_NUMERIC_EXCLUSIVE_SCAN_HPP_INCLUDED
+
+#include <nanorange/detail/algorithm/result_types.hpp>
+#include <nanorange/detail/numeric/scan.hpp>
+#include <nanorange/ranges.hpp>
+
+#include <functional>
+#include <memory>
+
+NANO_BEGIN_NAMESPACE
+
+template <typename I, typename O>
+using exclusive_scan_result = in_out_result<I, O>;
+
+namespace detail {
+
+// As nano::inclusive_scan, except that the i-th output excludes the i-th
+// input, and init is combined on the left of every output
+struct exclusive_scan_fn {
+private:
+    template <typename I, typename S, typename O, typename T, typename Op,
+              typename Proj>
+    static constexpr exclusive_scan_result<I, O>
+    impl(I first, S last, O result, T init, Op& op, Proj& proj)
+    {
+        if constexpr (sized_sentinel_for<S, I> &&
+                      simd_scannable<I, O, T, Op, Proj>) {
+            if (!detail::is_constant_evaluated()) {
+                const auto n = last - first;
+                if (n > 0) {
+                    detail::simd_scan<false>(std::addressof(*first),
+                                             static_cast<std::ptrdiff_t>(n),
+                                             std::addressof(*result), init);
+                }
+                return {first + n, result + n};
+            }
+        }
+
+        while (first != last) {
+            // Read the input before writing the output, as they may alias
+            T next = nano::invoke(op, init, nano::invoke(proj, *first));
+            *result = std::move(init);
+            init = std::move(next);
+            ++first;
+            ++result;
+        }
+
+        return {std::move(first), std::move(result)};
+    }
+
+    template <typename EP, typename I, typename O, typename T, typename Op,
+              typename Proj>
+    static exclusive_scan_result<I, O>
+    policy_impl(EP& policy, I first, iter_difference_t<I> n, O result,
+                T init, Op& op, Proj& proj)
+    {
+        detail::chunked_scan<false>(policy, first, n, result,
+                                    std::optional<T>(std::move(init)), op,
+                                    proj);
+        return {first + n, result + n};
+    }
+
+public:
+    template <typename I, typename S, typename O, typename T,
+              typename Op = std::plus<>, typename Proj = identity>
+    constexpr std::enable_if_t<
+        input_iterator<I> && sentinel_for<S, I> && weakly_incrementable<O> &&
+            foldable<Op, T, indirect_result_t<Proj&, I>> && writable<O, T>,
+        exclusive_scan_result<I, O>>
+    operator()(I first, S last, O result, T init, Op op = Op{},
+               Proj proj = Proj{}) const
+    {
+        return exclusive_scan_fn::impl(std::move(first), std::move(last),
+                                       std::move(result), std::move(init), op,
+                                       proj);
+    }
+
+    template <typename Rng, typename O, typename T, typename Op = std::plus<>,
+              typename Proj = identity>
+    constexpr std::enable_if_t<
+        input_range<Rng> && weakly_incrementable<O> &&
+            foldable<Op, T, indirect_result_t<Proj&, iterator_t<Rng>>> &&
+            writable<O, T>,
+        exclusive_scan_result<borrowed_iterator_t<Rng>, O>>
+    operator()(Rng&& rng, O result, T init, Op op = Op{},
+               Proj proj = Proj{}) const
+    {
+        return exclusive_scan_fn::impl(nano::begin(rng), nano::end(rng),
+                                       std::move(result), std::move(init), op,
+                                       proj);
+    }
+
+    template <typename EP, typename I, typename S, typename O, typename T,
+              typename Op = std::plus<>, typename Proj = identity>
+    std::enable_if_t<
+        execution_policy<EP> && random_access_iterator<I> &&
+            sized_sentinel_for<S, I> && random_access_iterator<O> &&
+            scannable<Op, T, indirect_result_t<Proj&, I>> &&
+            writable<O, const T&>,
+        exclusive_scan_result<I, O>>
+    operator()(EP&& policy, I first, S last, O result, T init, Op op = Op{},
+               Proj proj = Proj{}) const
+    {
+        const auto n = last - first;
+        return exclusive_scan_fn::policy_impl(policy, std::move(first), n,
+                                              std::move(result),
+                                              std::move(init), op, proj);
+    }
+
+    template <typename EP, typename Rng, typename O, typename T,
+              typename Op = std::plus<>, typename Proj = identity>
+    std::enable_if_t<
+        execution_policy<EP> && random_access_range<Rng> && sized_range<Rng> &&
+            random_access_iterator<O> &&
+            scannable<Op, T, indirect_result_t<Proj&, iterator_t<Rng>>> &&
+            writable<O, const T&>,
+        exclusive_scan_result<borrowed_iterator_t<Rng>, O>>
+    operator()(EP&& policy, Rng&& rng, O result, T init, Op op = Op{},
+               Proj proj = Proj{}) const
+    {
+        return exclusive_scan_fn::policy_impl(policy, nano::begin(rng),
+                                              nano::distance(rng),
+                                              std::move(result),
+                                              std::move(init), op, proj);
+    }
+};
+
+} // namespace detail
+
+NANO_INLINE_VAR(detail::exclusive_scan_fn, exclusive_scan)
+
+NANO_END_NAMESPACE
+
+#endif
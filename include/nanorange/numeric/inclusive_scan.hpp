@@ -0,0 +1,151 @@
+// nanorange/numeric/inclusive_scan.hpp
+//
+// Copyright (c) 2020 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_NUMERIC_INCLUSIVE_SCAN_HPP_INCLUDED
+#define NANORANGE_NUMERIC_INCLUSIVE_SCAN_HPP_INCLUDED
+
+#include <nanorange/detail/algorithm/result_types.hpp>
+#include <nanorange/detail/numeric/scan.hpp>
+#include <nanorange/ranges.hpp>
+
+#include <functional>
+#include <memory>
+
+NANO_BEGIN_NAMESPACE
+
+template <typename I, typename O>
+using inclusive_scan_result = in_out_result<I, O>;
+
+namespace detail {
+
+// The overloads without a policy fold from left to right, as
+// std::partial_sum. Those with a policy use detail::chunked_scan(), and give
+// the same results as each other on any number of threads. Either way, sums
+// of contiguous 32- and 64-bit integers are computed a vector at a time
+// (see detail::simd_scan()).
+struct inclusive_scan_fn {
+private:
+    template <typename I, typename Proj>
+    using value_t = iter_value_t<projected<I, Proj>>;
+
+    template <typename I, typename S, typename O, typename Op, typename Proj>
+    static constexpr inclusive_scan_result<I, O>
+    impl(I first, S last, O result, Op& op, Proj& proj)
+    {
+        if constexpr (sized_sentinel_for<S, I> &&
+                      simd_scannable<I, O, value_t<I, Proj>, Op, Proj>) {
+            if (!detail::is_constant_evaluated()) {
+                const auto n = last - first;
+                if (n > 0) {
+                    detail::simd_scan<true>(std::addressof(*first),
+                                            static_cast<std::ptrdiff_t>(n),
+                                            std::addressof(*result),
+                                            value_t<I, Proj>(0));
+                }
+                return {first + n, result + n};
+            }
+        }
+
+        if (first == last) {
+            return {std::move(first), std::move(result)};
+        }
+
+        value_t<I, Proj> acc = nano::invoke(proj, *first);
+        *result = acc;
+        ++first;
+        ++result;
+
+        while (first != last) {
+            acc = nano::invoke(op, std::move(acc), nano::invoke(proj, *first));
+            *result = acc;
+            ++first;
+            ++result;
+        }
+
+        return {std::move(first), std::move(result)};
+    }
+
+    template <typename EP, typename I, typename O, typename Op, typename Proj>
+    static inclusive_scan_result<I, O>
+    policy_impl(EP& policy, I first, iter_difference_t<I> n, O result,
+                Op& op, Proj& proj)
+    {
+        detail::chunked_scan<true>(policy, first, n, result,
+                                   std::optional<value_t<I, Proj>>{}, op,
+                                   proj);
+        return {first + n, result + n};
+    }
+
+public:
+    template <typename I, typename S, typename O, typename Op = std::plus<>,
+              typename Proj = identity>
+    constexpr std::enable_if_t<
+        input_iterator<I> && sentinel_for<S, I> && weakly_incrementable<O> &&
+            foldable<Op, value_t<I, Proj>, indirect_result_t<Proj&, I>> &&
+            writable<O, const value_t<I, Proj>&>,
+        inclusive_scan_result<I, O>>
+    operator()(I first, S last, O result, Op op = Op{},
+               Proj proj = Proj{}) const
+    {
+        return inclusive_scan_fn::impl(std::move(first), std::move(last),
+                                       std::move(result), op, proj);
+    }
+
+    template <typename Rng, typename O, typename Op = std::plus<>,
+              typename Proj = identity>
+    constexpr std::enable_if_t<
+        input_range<Rng> && weakly_incrementable<O> &&
+            foldable<Op, value_t<iterator_t<Rng>, Proj>,
+                     indirect_result_t<Proj&, iterator_t<Rng>>> &&
+            writable<O, const value_t<iterator_t<Rng>, Proj>&>,
+        inclusive_scan_result<borrowed_iterator_t<Rng>, O>>
+    operator()(Rng&& rng, O result, Op op = Op{}, Proj proj = Proj{}) const
+    {
+        return inclusive_scan_fn::impl(nano::begin(rng), nano::end(rng),
+                                       std::move(result), op, proj);
+    }
+
+    template <typename EP, typename I, typename S, typename O,
+              typename Op = std::plus<>, typename Proj = identity>
+    std::enable_if_t<
+        execution_policy<EP> && random_access_iterator<I> &&
+            sized_sentinel_for<S, I> && random_access_iterator<O> &&
+            scannable<Op, value_t<I, Proj>, indirect_result_t<Proj&, I>> &&
+            writable<O, const value_t<I, Proj>&>,
+        inclusive_scan_result<I, O>>
+    operator()(EP&& policy, I first, S last, O result, Op op = Op{},
+               Proj proj = Proj{}) const
+    {
+        const auto n = last - first;
+        return inclusive_scan_fn::policy_impl(policy, std::move(first), n,
+                                              std::move(result), op, proj);
+    }
+
+    template <typename EP, typename Rng, typename O, typename Op = std::plus<>,
+              typename Proj = identity>
+    std::enable_if_t<
+        execution_policy<EP> && random_access_range<Rng> && sized_range<Rng> &&
+            random_access_iterator<O> &&
+            scannable<Op, value_t<iterator_t<Rng>, Proj>,
+                      indirect_result_t<Proj&, iterator_t<Rng>>> &&
+            writable<O, const value_t<iterator_t<Rng>, Proj>&>,
+        inclusive_scan_result<borrowed_iterator_t<Rng>, O>>
+    operator()(EP&& policy, Rng&& rng, O result, Op op = Op{},
+               Proj proj = Proj{}) const
+    {
+        return inclusive_scan_fn::policy_impl(policy, nano::begin(rng),
+                                              nano::distance(rng),
+                                              std::move(result), op, proj);
+    }
+};
+
+} // namespace detail
+
+NANO_INLINE_VAR(detail::inclusive_scan_fn, inclusive_scan)
+
+NANO_END_NAMESPACE
+
+#endif
@@ -0,0 +1,130 @@
+// nanorange/numeric/reduce.hpp
+//
+// Copyright (c) 2020 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_NUMERIC_REDUCE_HPP_INCLUDED
+#define NANORANGE_NUMERIC_REDUCE_HPP_INCLUDED
+
+#include <nanorange/detail/numeric/reduce.hpp>
+#include <nanorange/execution/policy.hpp>
+#include <nanorange/ranges.hpp>
+
+#include <functional>
+
+NANO_BEGIN_NAMESPACE
+
+namespace detail {
+
+// For random-access ranges of known size the elements are combined in a
+// fixed tree (see detail::tree_reduce()), so every overload -- sequential or
+// parallel, on any number of threads -- gives the same result. Other ranges
+// are folded from left to right.
+struct reduce_fn {
+private:
+    template <typename I, typename S, typename T, typename Op, typename Proj>
+    static constexpr T impl(I first, S last, T init, Op& op, Proj& proj)
+    {
+        if constexpr (random_access_iterator<I> && sized_sentinel_for<S, I>) {
+            const auto n = last - first;
+            if (n == 0) {
+                return init;
+            }
+            auto f = [&first, &proj](iter_difference_t<I> i) -> decltype(auto) {
+                return nano::invoke(proj, first[i]);
+            };
+            init = nano::invoke(op, std::move(init),
+                                detail::tree_reduce<T>(decltype(n){0}, n, op, f));
+            return init;
+        } else {
+            while (first != last) {
+                init = nano::invoke(op, std::move(init),
+                                    nano::invoke(proj, *first));
+                ++first;
+            }
+            return init;
+        }
+    }
+
+    template <typename EP, typename I, typename T, typename Op, typename Proj>
+    static T policy_impl(EP& policy, I first, iter_difference_t<I> n, T init,
+                         Op& op, Proj& proj)
+    {
+        if constexpr (parallel_execution_policy<EP>) {
+            if (n == 0) {
+                return init;
+            }
+            auto f = [&first, &proj](iter_difference_t<I> i) -> decltype(auto) {
+                return nano::invoke(proj, first[i]);
+            };
+            init = nano::invoke(
+                op, std::move(init),
+                detail::parallel_tree_reduce<T>(n, op, f, policy));
+            return init;
+        } else {
+            return reduce_fn::impl(first, first + n, std::move(init), op, proj);
+        }
+    }
+
+public:
+    template <typename I, typename S, typename T, typename Op = std::plus<>,
+              typename Proj = identity>
+    constexpr std::enable_if_t<
+        input_iterator<I> && sentinel_for<S, I> &&
+            reducible<Op, T, indirect_result_t<Proj&, I>>,
+        T>
+    operator()(I first, S last, T init, Op op = Op{}, Proj proj = Proj{}) const
+    {
+        return reduce_fn::impl(std::move(first), std::move(last),
+                               std::move(init), op, proj);
+    }
+
+    template <typename Rng, typename T, typename Op = std::plus<>,
+              typename Proj = identity>
+    constexpr std::enable_if_t<
+        input_range<Rng> &&
+            reducible<Op, T, indirect_result_t<Proj&, iterator_t<Rng>>>,
+        T>
+    operator()(Rng&& rng, T init, Op op = Op{}, Proj proj = Proj{}) const
+    {
+        return reduce_fn::impl(nano::begin(rng), nano::end(rng),
+                               std::move(init), op, proj);
+    }
+
+    template <typename EP, typename I, typename S, typename T,
+              typename Op = std::plus<>, typename Proj = identity>
+    std::enable_if_t<execution_policy<EP> && random_access_iterator<I> &&
+                         sized_sentinel_for<S, I> &&
+                         reducible<Op, T, indirect_result_t<Proj&, I>>,
+                     T>
+    operator()(EP&& policy, I first, S last, T init, Op op = Op{},
+               Proj proj = Proj{}) const
+    {
+        const auto n = last - first;
+        return reduce_fn::policy_impl(policy, std::move(first), n,
+                                      std::move(init), op, proj);
+    }
+
+    template <typename EP, typename Rng, typename T, typename Op = std::plus<>,
+              typename Proj = identity>
+    std::enable_if_t<
+        execution_policy<EP> && random_access_range<Rng> && sized_range<Rng> &&
+            reducible<Op, T, indirect_result_t<Proj&, iterator_t<Rng>>>,
+        T>
+    operator()(EP&& policy, Rng&& rng, T init, Op op = Op{},
+               Proj proj = Proj{}) const
+    {
+        return reduce_fn::policy_impl(policy, nano::begin(rng),
+                                      nano::distance(rng), std::move(init), op,
+                                      proj);
+    }
+};
+
+} // namespace detail
+
+NANO_INLINE_VAR(detail::reduce_fn, reduce)
+
+NANO_END_NAMESPACE
+
+#endif
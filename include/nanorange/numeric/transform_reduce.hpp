@@ -0,0 +1,310 @@
+// nanorange/numeric/transform_reduce.hpp
+//
+// Copyright (c) 2020 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_NUMERIC_TRANSFORM_REDUCE_HPP_INCLUDED
+#define NANORANGE_NUMERIC_TRANSFORM_REDUCE_HPP_INCLUDED
+
+#include <nanorange/detail/numeric/reduce.hpp>
+#include <nanorange/execution/policy.hpp>
+#include <nanorange/iterator/unreachable.hpp>
+#include <nanorange/ranges.hpp>
+
+#include <functional>
+
+NANO_BEGIN_NAMESPACE
+
+namespace detail {
+
+struct transform_reducible_concept {
+    template <typename...>
+    static auto test(long) -> std::false_type;
+
+    template <typename BOp, typename T, typename F, typename... Args>
+    static auto test(int) -> std::enable_if_t<
+        reducible<BOp, T, invoke_result_t<F&, Args...>>,
+        std::true_type>;
+};
+
+// The results of f(args...) can be reduced with bop into a T
+template <typename BOp, typename T, typename F, typename... Args>
+NANO_CONCEPT transform_reducible =
+    decltype(transform_reducible_concept::test<BOp, T, F, Args...>(0))::value;
+
+// As nano::reduce, the elements of random-access ranges of known size are
+// combined in a fixed tree, so all of the overloads give the same result.
+struct transform_reduce_fn {
+private:
+    template <typename EP, typename T, typename D, typename Op, typename F>
+    static T tree_impl(EP& policy, D n, T init, Op& op, F& f)
+    {
+        if constexpr (parallel_execution_policy<EP>) {
+            init = nano::invoke(
+                op, std::move(init),
+                detail::parallel_tree_reduce<T>(n, op, f, policy));
+        } else {
+            init = nano::invoke(op, std::move(init),
+                                detail::tree_reduce<T>(D{0}, n, op, f));
+        }
+        return init;
+    }
+
+    template <typename I, typename S, typename T, typename BOp, typename UOp,
+              typename Proj>
+    static constexpr T unary_impl(I first, S last, T init, BOp& bop, UOp& uop,
+                                  Proj& proj)
+    {
+        if constexpr (random_access_iterator<I> && sized_sentinel_for<S, I>) {
+            const auto n = last - first;
+            if (n == 0) {
+                return init;
+            }
+            auto f = [&](iter_difference_t<I> i) -> decltype(auto) {
+                return nano::invoke(uop, nano::invoke(proj, first[i]));
+            };
+            init = nano::invoke(bop, std::move(init),
+                                detail::tree_reduce<T>(decltype(n){0}, n, bop,
+                                                       f));
+            return init;
+        } else {
+            while (first != last) {
+                init = nano::invoke(
+                    bop, std::move(init),
+                    nano::invoke(uop, nano::invoke(proj, *first)));
+                ++first;
+            }
+            return init;
+        }
+    }
+
+    // Stops at the end of the shorter sequence. When called with an
+    // unreachable second sentinel, the first sequence determines the length.
+    template <typename I1, typename S1, typename I2, typename S2, typename T,
+              typename BOp1, typename BOp2, typename Proj1, typename Proj2>
+    static constexpr T binary_impl(I1 first1, S1 last1, I2 first2, S2 last2,
+                                   T init, BOp1& bop1, BOp2& bop2,
+                                   Proj1& proj1, Proj2& proj2)
+    {
+        constexpr bool sized2 = sized_sentinel_for<S2, I2> ||
+                                same_as<S2, unreachable_sentinel_t>;
+
+        if constexpr (random_access_iterator<I1> &&
+                      sized_sentinel_for<S1, I1> &&
+                      random_access_iterator<I2> && sized2) {
+            using D = iter_difference_t<I1>;
+            D n = last1 - first1;
+            if constexpr (!same_as<S2, unreachable_sentinel_t>) {
+                const D n2 = static_cast<D>(last2 - first2);
+                n = n < n2 ? n : n2;
+            }
+            if (n == 0) {
+                return init;
+            }
+            auto f = [&](D i) -> decltype(auto) {
+                return nano::invoke(bop2, nano::invoke(proj1, first1[i]),
+                                    nano::invoke(proj2, first2[i]));
+            };
+            init = nano::invoke(bop1, std::move(init),
+                                detail::tree_reduce<T>(D{0}, n, bop1, f));
+            return init;
+        } else {
+            while (first1 != last1 && first2 != last2) {
+                init = nano::invoke(
+                    bop1, std::move(init),
+                    nano::invoke(bop2, nano::invoke(proj1, *first1),
+                                 nano::invoke(proj2, *first2)));
+                ++first1;
+                ++first2;
+            }
+            return init;
+        }
+    }
+
+    template <typename EP, typename I, typename T, typename BOp, typename UOp,
+              typename Proj>
+    static T unary_policy_impl(EP& policy, I first, iter_difference_t<I> n,
+                               T init, BOp& bop, UOp& uop, Proj& proj)
+    {
+        if (n == 0) {
+            return init;
+        }
+        auto f = [&](iter_difference_t<I> i) -> decltype(auto) {
+            return nano::invoke(uop, nano::invoke(proj, first[i]));
+        };
+        return transform_reduce_fn::tree_impl(policy, n, std::move(init), bop,
+                                              f);
+    }
+
+    template <typename EP, typename I1, typename I2, typename T, typename BOp1,
+              typename BOp2, typename Proj1, typename Proj2>
+    static T binary_policy_impl(EP& policy, I1 first1, I2 first2,
+                                iter_difference_t<I1> n, T init, BOp1& bop1,
+                                BOp2& bop2, Proj1& proj1, Proj2& proj2)
+    {
+        if (n == 0) {
+            return init;
+        }
+        auto f = [&](iter_difference_t<I1> i) -> decltype(auto) {
+            return nano::invoke(bop2, nano::invoke(proj1, first1[i]),
+                                nano::invoke(proj2, first2[i]));
+        };
+        return transform_reduce_fn::tree_impl(policy, n, std::move(init), bop1,
+                                              f);
+    }
+
+public:
+    // Unary transform, iterators
+    template <typename I, typename S, typename T, typename BOp, typename UOp,
+              typename Proj = identity>
+    constexpr std::enable_if_t<
+        input_iterator<I> && sentinel_for<S, I> &&
+            transform_reducible<BOp, T, UOp, indirect_result_t<Proj&, I>>,
+        T>
+    operator()(I first, S last, T init, BOp bop, UOp uop,
+               Proj proj = Proj{}) const
+    {
+        return transform_reduce_fn::unary_impl(std::move(first),
+                                               std::move(last),
+                                               std::move(init), bop, uop, proj);
+    }
+
+    // Unary transform, range
+    template <typename Rng, typename T, typename BOp, typename UOp,
+              typename Proj = identity>
+    constexpr std::enable_if_t<
+        input_range<Rng> &&
+            transform_reducible<
+                BOp, T, UOp, indirect_result_t<Proj&, iterator_t<Rng>>>,
+        T>
+    operator()(Rng&& rng, T init, BOp bop, UOp uop, Proj proj = Proj{}) const
+    {
+        return transform_reduce_fn::unary_impl(nano::begin(rng),
+                                               nano::end(rng), std::move(init),
+                                               bop, uop, proj);
+    }
+
+    // Binary transform, three-legged
+    template <typename I1, typename S1, typename I2, typename T,
+              typename BOp1 = std::plus<>, typename BOp2 = std::multiplies<>,
+              typename Proj1 = identity, typename Proj2 = identity>
+    constexpr std::enable_if_t<
+        input_iterator<I1> && sentinel_for<S1, I1> && input_iterator<I2> &&
+            transform_reducible<BOp1, T, BOp2,
+                                indirect_result_t<Proj1&, I1>,
+                                indirect_result_t<Proj2&, I2>>,
+        T>
+    operator()(I1 first1, S1 last1, I2 first2, T init, BOp1 bop1 = BOp1{},
+               BOp2 bop2 = BOp2{}, Proj1 proj1 = Proj1{},
+               Proj2 proj2 = Proj2{}) const
+    {
+        return transform_reduce_fn::binary_impl(
+            std::move(first1), std::move(last1), std::move(first2),
+            unreachable_sentinel, std::move(init), bop1, bop2, proj1, proj2);
+    }
+
+    // Binary transform, two ranges
+    template <typename Rng1, typename Rng2, typename T,
+              typename BOp1 = std::plus<>, typename BOp2 = std::multiplies<>,
+              typename Proj1 = identity, typename Proj2 = identity>
+    constexpr std::enable_if_t<
+        input_range<Rng1> && input_range<Rng2> &&
+            transform_reducible<
+                BOp1, T, BOp2, indirect_result_t<Proj1&, iterator_t<Rng1>>,
+                indirect_result_t<Proj2&, iterator_t<Rng2>>>,
+        T>
+    operator()(Rng1&& rng1, Rng2&& rng2, T init, BOp1 bop1 = BOp1{},
+               BOp2 bop2 = BOp2{}, Proj1 proj1 = Proj1{},
+               Proj2 proj2 = Proj2{}) const
+    {
+        return transform_reduce_fn::binary_impl(
+            nano::begin(rng1), nano::end(rng1), nano::begin(rng2),
+            nano::end(rng2), std::move(init), bop1, bop2, proj1, proj2);
+    }
+
+    // Unary transform, policy and iterators
+    template <typename EP, typename I, typename S, typename T, typename BOp,
+              typename UOp, typename Proj = identity>
+    std::enable_if_t<
+        execution_policy<EP> && random_access_iterator<I> &&
+            sized_sentinel_for<S, I> &&
+            transform_reducible<BOp, T, UOp, indirect_result_t<Proj&, I>>,
+        T>
+    operator()(EP&& policy, I first, S last, T init, BOp bop, UOp uop,
+               Proj proj = Proj{}) const
+    {
+        const auto n = last - first;
+        return transform_reduce_fn::unary_policy_impl(
+            policy, std::move(first), n, std::move(init), bop, uop, proj);
+    }
+
+    // Unary transform, policy and range
+    template <typename EP, typename Rng, typename T, typename BOp,
+              typename UOp, typename Proj = identity>
+    std::enable_if_t<
+        execution_policy<EP> && random_access_range<Rng> && sized_range<Rng> &&
+            transform_reducible<
+                BOp, T, UOp, indirect_result_t<Proj&, iterator_t<Rng>>>,
+        T>
+    operator()(EP&& policy, Rng&& rng, T init, BOp bop, UOp uop,
+               Proj proj = Proj{}) const
+    {
+        return transform_reduce_fn::unary_policy_impl(
+            policy, nano::begin(rng), nano::distance(rng), std::move(init),
+            bop, uop, proj);
+    }
+
+    // Binary transform, policy and three-legged
+    template <typename EP, typename I1, typename S1, typename I2, typename T,
+              typename BOp1 = std::plus<>, typename BOp2 = std::multiplies<>,
+              typename Proj1 = identity, typename Proj2 = identity>
+    std::enable_if_t<
+        execution_policy<EP> && random_access_iterator<I1> &&
+            sized_sentinel_for<S1, I1> && random_access_iterator<I2> &&
+            transform_reducible<BOp1, T, BOp2,
+                                indirect_result_t<Proj1&, I1>,
+                                indirect_result_t<Proj2&, I2>>,
+        T>
+    operator()(EP&& policy, I1 first1, S1 last1, I2 first2, T init,
+               BOp1 bop1 = BOp1{}, BOp2 bop2 = BOp2{}, Proj1 proj1 = Proj1{},
+               Proj2 proj2 = Proj2{}) const
+    {
+        const auto n = last1 - first1;
+        return transform_reduce_fn::binary_policy_impl(
+            policy, std::move(first1), std::move(first2), n, std::move(init),
+            bop1, bop2, proj1, proj2);
+    }
+
+    // Binary transform, policy and two ranges
+    template <typename EP, typename Rng1, typename Rng2, typename T,
+              typename BOp1 = std::plus<>, typename BOp2 = std::multiplies<>,
+              typename Proj1 = identity, typename Proj2 = identity>
+    std::enable_if_t<
+        execution_policy<EP> && random_access_range<Rng1> &&
+            sized_range<Rng1> && random_access_range<Rng2> &&
+            sized_range<Rng2> &&
+            transform_reducible<
+                BOp1, T, BOp2, indirect_result_t<Proj1&, iterator_t<Rng1>>,
+                indirect_result_t<Proj2&, iterator_t<Rng2>>>,
+        T>
+    operator()(EP&& policy, Rng1&& rng1, Rng2&& rng2, T init,
+               BOp1 bop1 = BOp1{}, BOp2 bop2 = BOp2{}, Proj1 proj1 = Proj1{},
+               Proj2 proj2 = Proj2{}) const
+    {
+        const auto n1 = nano::distance(rng1);
+        const auto n2 =
+            static_cast<range_difference_t<Rng1>>(nano::distance(rng2));
+        return transform_reduce_fn::binary_policy_impl(
+            policy, nano::begin(rng1), nano::begin(rng2), n1 < n2 ? n1 : n2,
+            std::move(init), bop1, bop2, proj1, proj2);
+    }
+};
+
+} // namespace detail
+
+NANO_INLINE_VAR(detail::transform_reduce_fn, transform_reduce)
+
+NANO_END_NAMESPACE
+
+#endif
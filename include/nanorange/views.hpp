@@ -8,6 +8,7 @@
 #define NANORANGE_VIEWS_HPP_INCLUDED
 
 #include <nanorange/views/all.hpp>
+#include <nanorange/views/chunk.hpp>
 #include <nanorange/views/common.hpp>
 #include <nanorange/views/counted.hpp>
 #include <nanorange/views/drop.hpp>
@@ -22,10 +23,12 @@
 #include <nanorange/views/ref.hpp>
 #include <nanorange/views/reverse.hpp>
 #include <nanorange/views/single.hpp>
+#include <nanorange/views/slide.hpp>
 #include <nanorange/views/split.hpp>
 #include <nanorange/views/subrange.hpp>
 #include <nanorange/views/take.hpp>
 #include <nanorange/views/take_while.hpp>
 #include <nanorange/views/transform.hpp>
+#include <nanorange/views/zip.hpp>
 
 #endif
@@ -0,0 +1,377 @@
+// nanorange/views/chunk.hpp
+//
+// Copyright (c) 2020 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_VIEWS_CHUNK_HPP_INCLUDED
+#define NANORANGE_VIEWS_CHUNK_HPP_INCLUDED
+
+#include <nanorange/detail/views/range_adaptors.hpp>
+#include <nanorange/iterator/default_sentinel.hpp>
+#include <nanorange/views/all.hpp>
+#include <nanorange/views/interface.hpp>
+#include <nanorange/views/subrange.hpp>
+
+NANO_BEGIN_NAMESPACE
+
+namespace chunk_view_ {
+
+// Splits a forward range into subranges of n elements each; the last chunk
+// is shorter if the size of the range is not a multiple of n. Each step is
+// O(n) for forward and bidirectional ranges, and O(1) for random-access
+// ranges.
+template <typename V>
+struct chunk_view : view_interface<chunk_view<V>> {
+private:
+    static_assert(forward_range<V>);
+    static_assert(view<V>);
+
+    template <bool Const>
+    struct iterator {
+    private:
+        friend struct iterator<!Const>;
+        friend struct chunk_view;
+
+        using Base = detail::conditional_t<Const, const V, V>;
+
+        iterator_t<Base> current_ = iterator_t<Base>();
+        sentinel_t<Base> end_ = sentinel_t<Base>();
+        range_difference_t<Base> n_ = 0;
+        // The number of elements by which the final chunk falls short of
+        // n, once we have stepped past it. This allows us to step back
+        // again and to calculate distances.
+        range_difference_t<Base> missing_ = 0;
+
+        constexpr iterator(iterator_t<Base> current, sentinel_t<Base> end,
+                           range_difference_t<Base> n,
+                           range_difference_t<Base> missing = 0)
+            : current_(std::move(current)),
+              end_(std::move(end)),
+              n_(n),
+              missing_(missing)
+        {}
+
+    public:
+        using iterator_category = detail::conditional_t<
+            random_access_range<Base>, random_access_iterator_tag,
+            detail::conditional_t<bidirectional_range<Base>,
+                                  bidirectional_iterator_tag,
+                                  forward_iterator_tag>>;
+        using value_type = subrange<iterator_t<Base>>;
+        using difference_type = range_difference_t<Base>;
+        // Extension: legacy typedefs
+        using pointer = void;
+        using reference = value_type;
+
+        iterator() = default;
+
+        template <typename I,
+            std::enable_if_t<same_as<I, iterator<!Const>>, int> = 0,
+            bool C = Const, typename VV = V, std::enable_if_t<
+            C && convertible_to<iterator_t<VV>, iterator_t<Base>> &&
+            convertible_to<sentinel_t<VV>, sentinel_t<Base>>, int> = 0>
+        constexpr iterator(I i)
+            : current_(std::move(i.current_)),
+              end_(std::move(i.end_)),
+              n_(i.n_),
+              missing_(i.missing_)
+        {}
+
+        constexpr iterator_t<Base> base() const { return current_; }
+
+        constexpr value_type operator*() const
+        {
+            return value_type{current_, ranges::next(current_, n_, end_)};
+        }
+
+        constexpr iterator& operator++()
+        {
+            missing_ = ranges::advance(current_, n_, end_);
+            return *this;
+        }
+
+        constexpr iterator operator++(int)
+        {
+            auto tmp = *this;
+            ++*this;
+            return tmp;
+        }
+
+        template <typename B = Base>
+        constexpr auto operator--()
+            -> std::enable_if_t<bidirectional_range<B>, iterator&>
+        {
+            ranges::advance(current_, missing_ - n_);
+            missing_ = 0;
+            return *this;
+        }
+
+        template <typename B = Base>
+        constexpr auto operator--(int)
+            -> std::enable_if_t<bidirectional_range<B>, iterator>
+        {
+            auto tmp = *this;
+            --*this;
+            return tmp;
+        }
+
+        template <typename B = Base>
+        constexpr auto operator+=(difference_type x)
+            -> std::enable_if_t<random_access_range<B>, iterator&>
+        {
+            if (x > 0) {
+                missing_ = ranges::advance(current_, n_ * x, end_);
+            } else if (x < 0) {
+                ranges::advance(current_, n_ * x + missing_);
+                missing_ = 0;
+            }
+            return *this;
+        }
+
+        template <typename B = Base>
+        constexpr auto operator-=(difference_type x)
+            -> std::enable_if_t<random_access_range<B>, iterator&>
+        {
+            return *this += -x;
+        }
+
+        template <typename B = Base, typename = std::enable_if_t<random_access_range<B>>>
+        constexpr value_type operator[](difference_type x) const
+        {
+            return *(*this + x);
+        }
+
+        friend constexpr bool operator==(const iterator& x, const iterator& y)
+        {
+            return x.current_ == y.current_;
+        }
+
+        friend constexpr bool operator!=(const iterator& x, const iterator& y)
+        {
+            return !(x == y);
+        }
+
+        friend constexpr bool operator==(const iterator& x, default_sentinel_t)
+        {
+            return x.current_ == x.end_;
+        }
+
+        friend constexpr bool operator==(default_sentinel_t, const iterator& x)
+        {
+            return x.current_ == x.end_;
+        }
+
+        friend constexpr bool operator!=(const iterator& x, default_sentinel_t)
+        {
+            return !(x.current_ == x.end_);
+        }
+
+        friend constexpr bool operator!=(default_sentinel_t, const iterator& x)
+        {
+            return !(x.current_ == x.end_);
+        }
+
+        template <typename B = Base>
+        friend constexpr auto operator<(const iterator& x, const iterator& y)
+            -> std::enable_if_t<random_access_range<B>, bool>
+        {
+            return x.current_ < y.current_;
+        }
+
+        template <typename B = Base>
+        friend constexpr auto operator>(const iterator& x, const iterator& y)
+            -> std::enable_if_t<random_access_range<B>, bool>
+        {
+            return y < x;
+        }
+
+        template <typename B = Base>
+        friend constexpr auto operator<=(const iterator& x, const iterator& y)
+            -> std::enable_if_t<random_access_range<B>, bool>
+        {
+            return !(y < x);
+        }
+
+        template <typename B = Base>
+        friend constexpr auto operator>=(const iterator& x, const iterator& y)
+            -> std::enable_if_t<random_access_range<B>, bool>
+        {
+            return !(x < y);
+        }
+
+        template <typename B = Base>
+        friend constexpr auto operator+(iterator i, difference_type x)
+            -> std::enable_if_t<random_access_range<B>, iterator>
+        {
+            i += x;
+            return i;
+        }
+
+        template <typename B = Base>
+        friend constexpr auto operator+(difference_type x, iterator i)
+            -> std::enable_if_t<random_access_range<B>, iterator>
+        {
+            i += x;
+            return i;
+        }
+
+        template <typename B = Base>
+        friend constexpr auto operator-(iterator i, difference_type x)
+            -> std::enable_if_t<random_access_range<B>, iterator>
+        {
+            i -= x;
+            return i;
+        }
+
+        template <typename B = Base>
+        friend constexpr auto operator-(const iterator& x, const iterator& y)
+            -> std::enable_if_t<
+                sized_sentinel_for<iterator_t<B>, iterator_t<B>>,
+                difference_type>
+        {
+            return (x.current_ - y.current_ + x.missing_ - y.missing_) / x.n_;
+        }
+
+        template <typename B = Base>
+        friend constexpr auto operator-(default_sentinel_t, const iterator& x)
+            -> std::enable_if_t<
+                sized_sentinel_for<sentinel_t<B>, iterator_t<B>>,
+                difference_type>
+        {
+            return (x.end_ - x.current_ + x.n_ - 1) / x.n_;
+        }
+
+        template <typename B = Base>
+        friend constexpr auto operator-(const iterator& x, default_sentinel_t y)
+            -> std::enable_if_t<
+                sized_sentinel_for<sentinel_t<B>, iterator_t<B>>,
+                difference_type>
+        {
+            return -(y - x);
+        }
+    };
+
+    V base_ = V();
+    range_difference_t<V> n_ = 0;
+
+    template <bool Const, typename Self>
+    static constexpr auto end_impl(Self& self)
+    {
+        using Base = detail::conditional_t<Const, const V, V>;
+
+        if constexpr (common_range<Base> && sized_range<Base>) {
+            const auto missing =
+                (self.n_ - ranges::distance(self.base_) % self.n_) % self.n_;
+            return iterator<Const>{ranges::end(self.base_),
+                                   ranges::end(self.base_), self.n_, missing};
+        } else if constexpr (common_range<Base> && !bidirectional_range<Base>) {
+            return iterator<Const>{ranges::end(self.base_),
+                                   ranges::end(self.base_), self.n_};
+        } else {
+            return default_sentinel;
+        }
+    }
+
+    template <typename Size>
+    constexpr Size size_impl(Size s) const
+    {
+        const auto n = static_cast<Size>(n_);
+        return s / n + (s % n == 0 ? 0 : 1);
+    }
+
+public:
+    chunk_view() = default;
+
+    // Precondition: n > 0
+    constexpr chunk_view(V base, range_difference_t<V> n)
+        : base_(std::move(base)),
+          n_(n)
+    {}
+
+    constexpr V base() const { return base_; }
+
+    template <typename VV = V, std::enable_if_t<
+        !detail::simple_view<VV>, int> = 0>
+    constexpr auto begin()
+    {
+        return iterator<false>{ranges::begin(base_), ranges::end(base_), n_};
+    }
+
+    template <typename VV = V, std::enable_if_t<
+        forward_range<const VV>, int> = 0>
+    constexpr auto begin() const
+    {
+        return iterator<true>{ranges::begin(base_), ranges::end(base_), n_};
+    }
+
+    template <typename VV = V, std::enable_if_t<
+        !detail::simple_view<VV>, int> = 0>
+    constexpr auto end()
+    {
+        return end_impl<false>(*this);
+    }
+
+    template <typename VV = V, std::enable_if_t<
+        forward_range<const VV>, int> = 0>
+    constexpr auto end() const
+    {
+        return end_impl<true>(*this);
+    }
+
+    template <typename VV = V, std::enable_if_t<sized_range<VV>, int> = 0>
+    constexpr auto size()
+    {
+        return size_impl(ranges::size(base_));
+    }
+
+    template <typename VV = V, std::enable_if_t<sized_range<const VV>, int> = 0>
+    constexpr auto size() const
+    {
+        return size_impl(ranges::size(base_));
+    }
+};
+
+template <typename R, std::enable_if_t<viewable_range<R>, int> = 0>
+chunk_view(R&&, range_difference_t<R>) -> chunk_view<all_view<R>>;
+
+} // namespace chunk_view_
+
+using chunk_view_::chunk_view;
+
+namespace detail {
+
+struct chunk_view_fn {
+
+    template <typename E, typename F>
+    constexpr auto operator()(E&& e, F&& f) const
+        -> decltype(chunk_view{std::forward<E>(e), std::forward<F>(f)})
+    {
+        return chunk_view{std::forward<E>(e), std::forward<F>(f)};
+    }
+
+    template <typename C>
+    constexpr auto operator()(C c) const
+    {
+        return detail::rao_proxy{[c = std::move(c)](auto&& r) mutable
+#ifndef NANO_MSVC_LAMBDA_PIPE_WORKAROUND
+            -> decltype(chunk_view{std::forward<decltype(r)>(r), std::declval<C&&>()})
+#endif
+        {
+            return chunk_view{std::forward<decltype(r)>(r), std::move(c)};
+        }};
+    }
+
+};
+
+}
+
+namespace views {
+
+NANO_INLINE_VAR(nano::detail::chunk_view_fn, chunk)
+
+}
+
+NANO_END_NAMESPACE
+
+#endif
@@ -0,0 +1,433 @@
+// nanorange/views/slide.hpp
+//
+// Copyright (c) 2020 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_VIEWS_SLIDE_HPP_INCLUDED
+#define NANORANGE_VIEWS_SLIDE_HPP_INCLUDED
+
+#include <nanorange/detail/views/range_adaptors.hpp>
+#include <nanorange/views/all.hpp>
+#include <nanorange/views/interface.hpp>
+#include <nanorange/views/subrange.hpp>
+
+#include <optional>
+
+NANO_BEGIN_NAMESPACE
+
+namespace slide_view_ {
+
+// Presents every window of n consecutive elements of a forward range, as a
+// subrange. A range with fewer than n elements has no windows.
+//
+// Iterators hold both ends of their window, so that every step is O(1).
+// Forming the first window costs O(n) for ranges which are not random-access,
+// so begin() caches it; calling begin() on a const view (and end() on a
+// bidirectional one) recomputes it each time.
+template <typename V>
+struct slide_view : view_interface<slide_view<V>> {
+private:
+    static_assert(forward_range<V>);
+    static_assert(view<V>);
+
+    template <bool> struct sentinel;
+
+    template <bool Const>
+    struct iterator {
+    private:
+        friend struct iterator<!Const>;
+        friend struct sentinel<Const>;
+        friend struct slide_view;
+
+        using Base = detail::conditional_t<Const, const V, V>;
+
+        iterator_t<Base> current_ = iterator_t<Base>();
+        // The last element of the window. This is the end of the underlying
+        // range once we have run out of windows.
+        iterator_t<Base> last_ele_ = iterator_t<Base>();
+
+        constexpr iterator(iterator_t<Base> current, iterator_t<Base> last_ele)
+            : current_(std::move(current)),
+              last_ele_(std::move(last_ele))
+        {}
+
+    public:
+        using iterator_category = detail::conditional_t<
+            random_access_range<Base>, random_access_iterator_tag,
+            detail::conditional_t<bidirectional_range<Base>,
+                                  bidirectional_iterator_tag,
+                                  forward_iterator_tag>>;
+        using value_type = subrange<iterator_t<Base>>;
+        using difference_type = range_difference_t<Base>;
+        // Extension: legacy typedefs
+        using pointer = void;
+        using reference = value_type;
+
+        iterator() = default;
+
+        template <typename I,
+            std::enable_if_t<same_as<I, iterator<!Const>>, int> = 0,
+            bool C = Const, typename VV = V, std::enable_if_t<
+            C && convertible_to<iterator_t<VV>, iterator_t<Base>>, int> = 0>
+        constexpr iterator(I i)
+            : current_(std::move(i.current_)),
+              last_ele_(std::move(i.last_ele_))
+        {}
+
+        constexpr iterator_t<Base> base() const { return current_; }
+
+        constexpr value_type operator*() const
+        {
+            return value_type{current_, ranges::next(last_ele_)};
+        }
+
+        constexpr iterator& operator++()
+        {
+            ++current_;
+            ++last_ele_;
+            return *this;
+        }
+
+        constexpr iterator operator++(int)
+        {
+            auto tmp = *this;
+            ++*this;
+            return tmp;
+        }
+
+        template <typename B = Base>
+        constexpr auto operator--()
+            -> std::enable_if_t<bidirectional_range<B>, iterator&>
+        {
+            --current_;
+            --last_ele_;
+            return *this;
+        }
+
+        template <typename B = Base>
+        constexpr auto operator--(int)
+            -> std::enable_if_t<bidirectional_range<B>, iterator>
+        {
+            auto tmp = *this;
+            --*this;
+            return tmp;
+        }
+
+        template <typename B = Base>
+        constexpr auto operator+=(difference_type x)
+            -> std::enable_if_t<random_access_range<B>, iterator&>
+        {
+            current_ += x;
+            last_ele_ += x;
+            return *this;
+        }
+
+        template <typename B = Base>
+        constexpr auto operator-=(difference_type x)
+            -> std::enable_if_t<random_access_range<B>, iterator&>
+        {
+            current_ -= x;
+            last_ele_ -= x;
+            return *this;
+        }
+
+        template <typename B = Base, typename = std::enable_if_t<random_access_range<B>>>
+        constexpr value_type operator[](difference_type x) const
+        {
+            return value_type{current_ + x, last_ele_ + (x + 1)};
+        }
+
+        // Windows are compared by their last element, as this is the only
+        // part of the end iterator that is always meaningful
+        friend constexpr bool operator==(const iterator& x, const iterator& y)
+        {
+            return x.last_ele_ == y.last_ele_;
+        }
+
+        friend constexpr bool operator!=(const iterator& x, const iterator& y)
+        {
+            return !(x == y);
+        }
+
+        template <typename B = Base>
+        friend constexpr auto operator<(const iterator& x, const iterator& y)
+            -> std::enable_if_t<random_access_range<B>, bool>
+        {
+            return x.last_ele_ < y.last_ele_;
+        }
+
+        template <typename B = Base>
+        friend constexpr auto operator>(const iterator& x, const iterator& y)
+            -> std::enable_if_t<random_access_range<B>, bool>
+        {
+            return y < x;
+        }
+
+        template <typename B = Base>
+        friend constexpr auto operator<=(const iterator& x, const iterator& y)
+            -> std::enable_if_t<random_access_range<B>, bool>
+        {
+            return !(y < x);
+        }
+
+        template <typename B = Base>
+        friend constexpr auto operator>=(const iterator& x, const iterator& y)
+            -> std::enable_if_t<random_access_range<B>, bool>
+        {
+            return !(x < y);
+        }
+
+        template <typename B = Base>
+        friend constexpr auto operator+(iterator i, difference_type x)
+            -> std::enable_if_t<random_access_range<B>, iterator>
+        {
+            i += x;
+            return i;
+        }
+
+        template <typename B = Base>
+        friend constexpr auto operator+(difference_type x, iterator i)
+            -> std::enable_if_t<random_access_range<B>, iterator>
+        {
+            i += x;
+            return i;
+        }
+
+        template <typename B = Base>
+        friend constexpr auto operator-(iterator i, difference_type x)
+            -> std::enable_if_t<random_access_range<B>, iterator>
+        {
+            i -= x;
+            return i;
+        }
+
+        template <typename B = Base>
+        friend constexpr auto operator-(const iterator& x, const iterator& y)
+            -> std::enable_if_t<
+                sized_sentinel_for<iterator_t<B>, iterator_t<B>>,
+                difference_type>
+        {
+            return x.last_ele_ - y.last_ele_;
+        }
+    };
+
+    template <bool Const>
+    struct sentinel {
+    private:
+        friend struct sentinel<!Const>;
+
+        using Base = detail::conditional_t<Const, const V, V>;
+
+        sentinel_t<Base> end_ = sentinel_t<Base>();
+
+        constexpr bool equal(const iterator<Const>& i) const
+        {
+            return i.last_ele_ == end_;
+        }
+
+        constexpr range_difference_t<Base>
+        distance_from(const iterator<Const>& i) const
+        {
+            return end_ - i.last_ele_;
+        }
+
+    public:
+        sentinel() = default;
+
+        constexpr explicit sentinel(sentinel_t<Base> end)
+            : end_(std::move(end))
+        {}
+
+        template <typename S,
+            std::enable_if_t<same_as<S, sentinel<!Const>>, int> = 0,
+            bool C = Const, typename VV = V, std::enable_if_t<
+            C && convertible_to<sentinel_t<VV>, sentinel_t<Base>>, int> = 0>
+        constexpr sentinel(S s)
+            : end_(std::move(s.end_))
+        {}
+
+        friend constexpr bool operator==(const iterator<Const>& x, const sentinel& y)
+        {
+            return y.equal(x);
+        }
+
+        friend constexpr bool operator==(const sentinel& x, const iterator<Const>& y)
+        {
+            return y == x;
+        }
+
+        friend constexpr bool operator!=(const iterator<Const>& x, const sentinel& y)
+        {
+            return !(x == y);
+        }
+
+        friend constexpr bool operator!=(const sentinel& x, const iterator<Const>& y)
+        {
+            return !(y == x);
+        }
+
+        template <typename B = Base>
+        friend constexpr auto operator-(const sentinel& x, const iterator<Const>& y)
+            -> std::enable_if_t<sized_sentinel_for<sentinel_t<B>, iterator_t<B>>,
+                                range_difference_t<B>>
+        {
+            return x.distance_from(y);
+        }
+
+        template <typename B = Base>
+        friend constexpr auto operator-(const iterator<Const>& x, const sentinel& y)
+            -> std::enable_if_t<sized_sentinel_for<sentinel_t<B>, iterator_t<B>>,
+                                range_difference_t<B>>
+        {
+            return -y.distance_from(x);
+        }
+    };
+
+    // Whether finding the first window is O(1), so there is nothing to cache
+    static constexpr bool caches_nothing =
+        random_access_range<V> && sized_range<V>;
+
+    V base_ = V();
+    range_difference_t<V> n_ = 0;
+    std::optional<iterator_t<V>> cached_last_ele_;
+
+    template <bool Const, typename Self>
+    static constexpr auto begin_impl(Self& self)
+    {
+        auto first = ranges::begin(self.base_);
+        auto last_ele = ranges::next(first, self.n_ - 1, ranges::end(self.base_));
+        return iterator<Const>{std::move(first), std::move(last_ele)};
+    }
+
+    template <bool Const, typename Self>
+    static constexpr auto end_impl(Self& self)
+    {
+        using Base = detail::conditional_t<Const, const V, V>;
+
+        if constexpr (random_access_range<Base> && sized_range<Base>) {
+            const auto size = ranges::distance(self.base_);
+            const auto first = ranges::begin(self.base_);
+            return iterator<Const>{
+                first + (size < self.n_ ? 0 : size - self.n_ + 1),
+                first + size};
+        } else if constexpr (bidirectional_range<Base> && common_range<Base>) {
+            auto last = ranges::end(self.base_);
+            auto first = ranges::prev(last, self.n_ - 1,
+                                      ranges::begin(self.base_));
+            return iterator<Const>{std::move(first), std::move(last)};
+        } else {
+            return sentinel<Const>{ranges::end(self.base_)};
+        }
+    }
+
+    template <typename Size>
+    constexpr Size size_impl(Size s) const
+    {
+        const auto n = static_cast<Size>(n_);
+        return s < n ? 0 : s - n + 1;
+    }
+
+public:
+    slide_view() = default;
+
+    // Precondition: n > 0
+    constexpr slide_view(V base, range_difference_t<V> n)
+        : base_(std::move(base)),
+          n_(n)
+    {}
+
+    constexpr V base() const { return base_; }
+
+    template <typename VV = V, std::enable_if_t<
+        !detail::simple_view<VV> || !caches_nothing, int> = 0>
+    constexpr auto begin()
+    {
+        if constexpr (caches_nothing) {
+            return begin_impl<false>(*this);
+        } else {
+            if (!cached_last_ele_.has_value()) {
+                cached_last_ele_ = ranges::next(ranges::begin(base_), n_ - 1,
+                                                ranges::end(base_));
+            }
+            return iterator<false>{ranges::begin(base_), *cached_last_ele_};
+        }
+    }
+
+    template <typename VV = V, std::enable_if_t<
+        forward_range<const VV>, int> = 0>
+    constexpr auto begin() const
+    {
+        return begin_impl<true>(*this);
+    }
+
+    template <typename VV = V, std::enable_if_t<
+        !detail::simple_view<VV> || !caches_nothing, int> = 0>
+    constexpr auto end()
+    {
+        return end_impl<false>(*this);
+    }
+
+    template <typename VV = V, std::enable_if_t<
+        forward_range<const VV>, int> = 0>
+    constexpr auto end() const
+    {
+        return end_impl<true>(*this);
+    }
+
+    template <typename VV = V, std::enable_if_t<sized_range<VV>, int> = 0>
+    constexpr auto size()
+    {
+        return size_impl(ranges::size(base_));
+    }
+
+    template <typename VV = V, std::enable_if_t<sized_range<const VV>, int> = 0>
+    constexpr auto size() const
+    {
+        return size_impl(ranges::size(base_));
+    }
+};
+
+template <typename R, std::enable_if_t<viewable_range<R>, int> = 0>
+slide_view(R&&, range_difference_t<R>) -> slide_view<all_view<R>>;
+
+} // namespace slide_view_
+
+using slide_view_::slide_view;
+
+namespace detail {
+
+struct slide_view_fn {
+
+    template <typename E, typename F>
+    constexpr auto operator()(E&& e, F&& f) const
+        -> decltype(slide_view{std::forward<E>(e), std::forward<F>(f)})
+    {
+        return slide_view{std::forward<E>(e), std::forward<F>(f)};
+    }
+
+    template <typename C>
+    constexpr auto operator()(C c) const
+    {
+        return detail::rao_proxy{[c = std::move(c)](auto&& r) mutable
+#ifndef NANO_MSVC_LAMBDA_PIPE_WORKAROUND
+            -> decltype(slide_view{std::forward<decltype(r)>(r), std::declval<C&&>()})
+#endif
+        {
+            return slide_view{std::forward<decltype(r)>(r), std::move(c)};
+        }};
+    }
+
+};
+
+}
+
+namespace views {
+
+NANO_INLINE_VAR(nano::detail::slide_view_fn, slide)
+
+}
+
+NANO_END_NAMESPACE
+
+#endif
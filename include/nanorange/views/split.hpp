@@ -8,6 +8,7 @@
 #define NANORANGE_VIEWS_SPLIT_HPP_INCLUDED
 
 #include <nanorange/algorithm/mismatch.hpp>
+#include <nanorange/algorithm/searchers.hpp>
 #include <nanorange/detail/views/range_adaptors.hpp>
 #include <nanorange/iterator/default_sentinel.hpp>
 #include <nanorange/views/all.hpp>
@@ -41,25 +42,31 @@ struct tiny_range_concept {
 template <typename R>
 NANO_CONCEPT tiny_range = decltype(tiny_range_concept::test<R>(0))::value;
 
-template <typename V, typename P, bool NotForwardRange>
+template <typename V, typename S, bool NotForwardRange>
 struct split_view_data {
     V base_ = V();
-    P pattern_ = P();
+    S searcher_ = S();
 };
 
-template <typename V, typename P>
-struct split_view_data<V, P, true> {
+template <typename V, typename S>
+struct split_view_data<V, S, true> {
     V base_ = V();
-    P pattern_ = P();
+    S searcher_ = S();
     iterator_t<V> current_ = iterator_t<V>();
 };
 
+struct split_view_no_next {};
+
 } // namespace detail
 
 namespace split_view_ {
 
-template <typename V, typename Pattern>
-struct split_view : view_interface<split_view<V, Pattern>> {
+// Extension: the delimiter is located using a searcher (see
+// nanorange/algorithm/searchers.hpp), which defaults to default_searcher.
+// Input ranges are always matched element by element with ==.
+template <typename V, typename Pattern,
+          typename Searcher = default_searcher<Pattern>>
+struct split_view : view_interface<split_view<V, Pattern, Searcher>> {
 private:
 
     static_assert(input_range<V>);
@@ -69,9 +76,17 @@ private:
     static_assert(indirectly_comparable<iterator_t<V>, iterator_t<Pattern>,
                                         ranges::equal_to>);
     static_assert(forward_range<V> || detail::tiny_range<Pattern>);
+    static_assert(forward_range<V> ||
+                  same_as<Searcher, default_searcher<Pattern>>,
+                  "Custom searchers require a forward range");
+    static_assert(same_as<typename Searcher::pattern_type, Pattern>);
 
-    detail::split_view_data<V, Pattern, !forward_range<V>> data_{};
+    detail::split_view_data<V, Searcher, !forward_range<V>> data_{};
 
+    constexpr const Pattern& pattern() const
+    {
+        return data_.searcher_.pattern();
+    }
 
 
     template <bool>
@@ -87,6 +102,11 @@ private:
         using Base = detail::conditional_t<Const, const V, V>;
         Parent* parent_ = nullptr;
         iterator_t<Base> current_ = iterator_t<Base>();
+        // For forward ranges, the position of the next delimiter (or the
+        // end), found with the searcher whenever current_ changes
+        detail::conditional_t<forward_range<Base>, subrange<iterator_t<Base>>,
+                              detail::split_view_no_next>
+            next_{};
 
         constexpr decltype(auto) get_current()
         {
@@ -111,6 +131,19 @@ private:
             return get_current() == ranges::end(parent_->data_.base_);
         }
 
+        constexpr void find_next()
+        {
+            const auto end = ranges::end(parent_->data_.base_);
+            if (current_ == end) {
+                next_ = {current_, current_};
+            } else if (ranges::empty(parent_->pattern())) {
+                auto n = ranges::next(current_);
+                next_ = {n, n};
+            } else {
+                next_ = parent_->data_.searcher_(current_, end);
+            }
+        }
+
     public:
         // FIXME: iterator_concept
         using iterator_category = detail::conditional_t<
@@ -154,7 +187,9 @@ private:
         constexpr outer_iterator(Parent& parent, iterator_t<Base> current)
             : parent_(std::addressof(parent)),
               current_(std::move(current))
-        {}
+        {
+            find_next();
+        }
 
         template <typename I,
                   std::enable_if_t<same_as<I, outer_iterator<!Const>>, int> = 0,
@@ -164,7 +199,11 @@ private:
         constexpr outer_iterator(I i)
             : parent_(i.parent_),
               current_(std::move(i.current_))
-        {}
+        {
+            if constexpr (forward_range<Base>) {
+                next_ = {std::move(i.next_.begin()), std::move(i.next_.end())};
+            }
+        }
 
         constexpr value_type operator*() const { return value_type{*this}; }
 
@@ -174,7 +213,12 @@ private:
             if (get_current() == end) {
                 return *this;
             }
-            const auto [pbegin, pend] = subrange{parent_->data_.pattern_};
+            if constexpr (forward_range<Base>) {
+                current_ = next_.end();
+                find_next();
+                return *this;
+            }
+            const auto [pbegin, pend] = subrange{parent_->pattern()};
             if (pbegin == pend) {
                 ++get_current();
             } else {
@@ -246,12 +290,15 @@ private:
 
         constexpr bool done() const
         {
+            if constexpr (forward_range<Base>) {
+                return i_.current_ == i_.next_.begin();
+            }
             auto cur = i_.get_current();
             auto end = ranges::end(i_.parent_->data_.base_);
             if (cur == end) {
                 return true;
             }
-            auto [pcur, pend] = subrange{i_.parent_->data_.pattern_};
+            auto [pcur, pend] = subrange{i_.parent_->pattern()};
             if (pcur == pend) {
                 return incremented_;
             }
@@ -361,7 +408,11 @@ public:
     split_view() = default;
 
     constexpr split_view(V base, Pattern pattern)
-        : data_{std::move(base), std::move(pattern)}
+        : data_{std::move(base), Searcher(std::move(pattern))}
+    {}
+
+    constexpr split_view(V base, Searcher searcher)
+        : data_{std::move(base), std::move(searcher)}
     {}
 
     template <typename R,
@@ -370,7 +421,8 @@ public:
                   constructible_from<Pattern, single_view<range_value_t<R>>>, int> = 0,
               std::enable_if_t<input_range<R>, int> = 0>
     constexpr split_view(R&& r, range_value_t<R> e)
-        : data_{views::all(std::forward<R>(r)), single_view{std::move(e)}}
+        : data_{views::all(std::forward<R>(r)),
+                Searcher(single_view{std::move(e)})}
     {}
 
     constexpr auto begin()
@@ -409,9 +461,14 @@ public:
     }
 };
 
-template <typename R, typename P>
+template <typename R, typename P,
+          std::enable_if_t<!detail::is_searcher<remove_cvref_t<P>>, int> = 0>
 split_view(R&&, P&&) -> split_view<all_view<R>, all_view<P>>;
 
+template <typename R, typename S,
+          std::enable_if_t<detail::is_searcher<S>, int> = 0>
+split_view(R&&, S) -> split_view<all_view<R>, typename S::pattern_type, S>;
+
 template <typename R, std::enable_if_t<input_range<R>, int> = 0>
 split_view(R&&, range_value_t<R>)
     -> split_view<all_view<R>, single_view<range_value_t<R>>>;
@@ -431,16 +488,31 @@ struct split_view_fn {
         return split_view{std::forward<E>(e), std::forward<F>(f)};
     }
 
+    // A range pattern is converted to a view up front, so that an lvalue
+    // pattern is referred to rather than copied into the closure
     template <typename P>
     constexpr auto operator()(P&& p) const
+    {
+        if constexpr (detail::is_searcher<remove_cvref_t<P>>) {
+            return split_view_fn::make_proxy(std::forward<P>(p));
+        } else if constexpr (viewable_range<P>) {
+            return split_view_fn::make_proxy(views::all(std::forward<P>(p)));
+        } else {
+            return split_view_fn::make_proxy(std::forward<P>(p));
+        }
+    }
+
+private:
+    template <typename P>
+    static constexpr auto make_proxy(P p)
     {
         return detail::rao_proxy{
-            [p = std::forward<P>(p)](auto&& r) mutable
+            [p = std::move(p)](auto&& r) mutable
 #ifndef NANO_MSVC_LAMBDA_PIPE_WORKAROUND
-                 -> decltype(split_view{std::forward<decltype(r)>(r), std::declval<P&&>()})
+                 -> decltype(split_view{std::forward<decltype(r)>(r), std::declval<P&>()})
 #endif
             {
-                return split_view{std::forward<decltype(r)>(r), std::move(p)};
+                return split_view{std::forward<decltype(r)>(r), p};
             }};
     }
 };
@@ -0,0 +1,755 @@
+// nanorange/views/zip.hpp
+//
+// Copyright (c) 2020 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_VIEWS_ZIP_HPP_INCLUDED
+#define NANORANGE_VIEWS_ZIP_HPP_INCLUDED
+
+#include <nanorange/detail/views/range_adaptors.hpp>
+#include <nanorange/views/all.hpp>
+#include <nanorange/views/empty.hpp>
+#include <nanorange/views/interface.hpp>
+#include <nanorange/views/transform.hpp>
+
+#include <tuple>
+
+NANO_BEGIN_NAMESPACE
+
+namespace detail {
+
+// The reference type of a zip_view iterator. This is a std::tuple which can
+// be assigned through when const (so that it models indirectly_writable, like
+// a real reference), and which has a common reference with tuples of its
+// element types. Together with the iter_move and iter_swap customisations of
+// the iterator, this lets algorithms like sort permute several ranges at once.
+template <typename... Ts>
+struct zip_tuple : std::tuple<Ts...> {
+private:
+    using base_t = std::tuple<Ts...>;
+
+    template <typename Tuple, std::size_t... I>
+    constexpr void assign(Tuple&& other, std::index_sequence<I...>) const
+    {
+        ((void) (std::get<I>(const_cast<base_t&>(
+                     static_cast<const base_t&>(*this))) =
+                     std::get<I>(std::forward<Tuple>(other))),
+         ...);
+    }
+
+    template <typename Tuple, std::size_t... I>
+    constexpr zip_tuple(Tuple&& other, std::index_sequence<I...>)
+        : base_t(std::get<I>(std::forward<Tuple>(other))...)
+    {}
+
+public:
+    zip_tuple() = default;
+
+    template <typename... Args, std::enable_if_t<
+        sizeof...(Args) == sizeof...(Ts) && (sizeof...(Ts) > 0) &&
+        (std::is_constructible_v<Ts, Args&&> && ...), int> = 0>
+    constexpr zip_tuple(Args&&... args)
+        : base_t(std::forward<Args>(args)...)
+    {}
+
+    // Conversions from tuples of compatible references and values
+    template <typename... Us, std::enable_if_t<
+        sizeof...(Us) == sizeof...(Ts) &&
+        (std::is_constructible_v<Ts, Us&> && ...), int> = 0>
+    constexpr zip_tuple(std::tuple<Us...>& other)
+        : zip_tuple(other, std::index_sequence_for<Ts...>{})
+    {}
+
+    template <typename... Us, std::enable_if_t<
+        sizeof...(Us) == sizeof...(Ts) &&
+        (std::is_constructible_v<Ts, const Us&> && ...), int> = 0>
+    constexpr zip_tuple(const std::tuple<Us...>& other)
+        : zip_tuple(other, std::index_sequence_for<Ts...>{})
+    {}
+
+    template <typename... Us, std::enable_if_t<
+        sizeof...(Us) == sizeof...(Ts) &&
+        (std::is_constructible_v<Ts, Us&&> && ...), int> = 0>
+    constexpr zip_tuple(std::tuple<Us...>&& other)
+        : zip_tuple(std::move(other), std::index_sequence_for<Ts...>{})
+    {}
+
+    zip_tuple(const zip_tuple&) = default;
+    zip_tuple(zip_tuple&&) = default;
+
+    // Assignment writes through to the referenced elements. The const
+    // overloads are what make a prvalue zip_tuple behave like a reference.
+    constexpr zip_tuple& operator=(const zip_tuple& other)
+    {
+        assign(other, std::index_sequence_for<Ts...>{});
+        return *this;
+    }
+
+    constexpr zip_tuple& operator=(zip_tuple&& other)
+    {
+        assign(static_cast<base_t&&>(other), std::index_sequence_for<Ts...>{});
+        return *this;
+    }
+
+    template <typename... Us, std::enable_if_t<
+        sizeof...(Us) == sizeof...(Ts) &&
+        (std::is_assignable_v<Ts&, const Us&> && ...), int> = 0>
+    constexpr zip_tuple& operator=(const std::tuple<Us...>& other)
+    {
+        assign(other, std::index_sequence_for<Ts...>{});
+        return *this;
+    }
+
+    template <typename... Us, std::enable_if_t<
+        sizeof...(Us) == sizeof...(Ts) &&
+        (std::is_assignable_v<Ts&, Us&&> && ...), int> = 0>
+    constexpr zip_tuple& operator=(std::tuple<Us...>&& other)
+    {
+        assign(std::move(other), std::index_sequence_for<Ts...>{});
+        return *this;
+    }
+
+    template <typename... Us, std::enable_if_t<
+        sizeof...(Us) == sizeof...(Ts) &&
+        (std::is_assignable_v<const Ts&, const Us&> && ...), int> = 0>
+    constexpr const zip_tuple& operator=(const std::tuple<Us...>& other) const
+    {
+        assign(other, std::index_sequence_for<Ts...>{});
+        return *this;
+    }
+
+    template <typename... Us, std::enable_if_t<
+        sizeof...(Us) == sizeof...(Ts) &&
+        (std::is_assignable_v<const Ts&, Us&&> && ...), int> = 0>
+    constexpr const zip_tuple& operator=(std::tuple<Us...>&& other) const
+    {
+        assign(std::move(other), std::index_sequence_for<Ts...>{});
+        return *this;
+    }
+};
+
+template <typename, typename, template <class> class,
+          template <class> class, typename = void>
+struct zip_tuple_common_reference {};
+
+template <typename... Ts, typename... Us, template <class> class TQual,
+          template <class> class UQual>
+struct zip_tuple_common_reference<
+    std::tuple<Ts...>, std::tuple<Us...>, TQual, UQual,
+    std::enable_if_t<sizeof...(Ts) == sizeof...(Us)>> {
+    using type =
+        zip_tuple<common_reference_t<TQual<Ts>, UQual<Us>>...>;
+};
+
+template <typename, typename, typename = void>
+struct zip_tuple_common_type {};
+
+template <typename... Ts, typename... Us>
+struct zip_tuple_common_type<
+    std::tuple<Ts...>, std::tuple<Us...>,
+    std::enable_if_t<sizeof...(Ts) == sizeof...(Us)>> {
+    using type = std::tuple<common_type_t<Ts, Us>...>;
+};
+
+} // namespace detail
+
+// A zip_tuple has a common reference with std::tuples and other zip_tuples
+// of the same size, formed element-wise
+template <typename... Ts, typename... Us, template <class> class TQual,
+          template <class> class UQual>
+struct basic_common_reference<detail::zip_tuple<Ts...>,
+                              detail::zip_tuple<Us...>, TQual, UQual>
+    : detail::zip_tuple_common_reference<std::tuple<Ts...>, std::tuple<Us...>,
+                                         TQual, UQual> {};
+
+template <typename... Ts, typename... Us, template <class> class TQual,
+          template <class> class UQual>
+struct basic_common_reference<detail::zip_tuple<Ts...>, std::tuple<Us...>,
+                              TQual, UQual>
+    : detail::zip_tuple_common_reference<std::tuple<Ts...>, std::tuple<Us...>,
+                                         TQual, UQual> {};
+
+template <typename... Ts, typename... Us, template <class> class TQual,
+          template <class> class UQual>
+struct basic_common_reference<std::tuple<Ts...>, detail::zip_tuple<Us...>,
+                              TQual, UQual>
+    : detail::zip_tuple_common_reference<std::tuple<Ts...>, std::tuple<Us...>,
+                                         TQual, UQual> {};
+
+template <typename... Ts, typename... Us>
+struct common_type<detail::zip_tuple<Ts...>, std::tuple<Us...>>
+    : detail::zip_tuple_common_type<std::tuple<Ts...>, std::tuple<Us...>> {};
+
+template <typename... Ts, typename... Us>
+struct common_type<std::tuple<Ts...>, detail::zip_tuple<Us...>>
+    : detail::zip_tuple_common_type<std::tuple<Ts...>, std::tuple<Us...>> {};
+
+template <typename... Ts, typename... Us>
+struct common_type<detail::zip_tuple<Ts...>, detail::zip_tuple<Us...>>
+    : detail::zip_tuple_common_type<std::tuple<Ts...>, std::tuple<Us...>> {};
+
+NANO_END_NAMESPACE
+
+namespace std {
+
+template <typename... Ts>
+struct tuple_size<::nano::detail::zip_tuple<Ts...>>
+    : std::integral_constant<std::size_t, sizeof...(Ts)> {};
+
+template <std::size_t I, typename... Ts>
+struct tuple_element<I, ::nano::detail::zip_tuple<Ts...>>
+    : std::tuple_element<I, std::tuple<Ts...>> {};
+
+} // namespace std
+
+NANO_BEGIN_NAMESPACE
+
+namespace zip_view_ {
+
+template <typename... Vs>
+inline constexpr bool all_forward = (forward_range<Vs> && ...);
+
+template <typename... Vs>
+inline constexpr bool all_bidirectional = (bidirectional_range<Vs> && ...);
+
+template <typename... Vs>
+inline constexpr bool all_random_access = (random_access_range<Vs> && ...);
+
+// Whether zip_view<Vs...> can return an iterator from end(). If the ranges
+// have different lengths and are bidirectional, the end iterator must be
+// found by stepping through the shortest, unless they are random-access and
+// sized, in which case we can jump there directly.
+template <typename... Vs>
+inline constexpr bool zip_is_common =
+    (sizeof...(Vs) == 1 && (common_range<Vs> && ...)) ||
+    (!all_bidirectional<Vs...> && (common_range<Vs> && ...)) ||
+    (all_random_access<Vs...> && (sized_range<Vs> && ...));
+
+template <std::size_t I, typename F, typename... Tuples>
+constexpr void tuple_for_each_at(F& f, Tuples&... tuples)
+{
+    f(std::get<I>(tuples)...);
+}
+
+template <typename F, std::size_t... I, typename... Tuples>
+constexpr void tuple_for_each_impl(F& f, std::index_sequence<I...>,
+                                   Tuples&... tuples)
+{
+    (zip_view_::tuple_for_each_at<I>(f, tuples...), ...);
+}
+
+// Applies f to the corresponding elements of each tuple in turn
+template <typename F, typename Tuple, typename... Tuples>
+constexpr void tuple_for_each(F f, Tuple& tuple, Tuples&... tuples)
+{
+    zip_view_::tuple_for_each_impl(
+        f, std::make_index_sequence<std::tuple_size<
+               std::remove_const_t<Tuple>>::value>{},
+        tuple, tuples...);
+}
+
+// Returns the element-wise difference a - b with the smallest magnitude
+template <typename D, typename TupleA, typename TupleB>
+constexpr D min_distance(const TupleA& a, const TupleB& b)
+{
+    bool first = true;
+    D result = 0;
+    tuple_for_each([&](const auto& x, const auto& y) {
+        const auto d = static_cast<D>(x - y);
+        if (first || (d < 0 ? -d : d) < (result < 0 ? -result : result)) {
+            result = d;
+            first = false;
+        }
+    }, a, b);
+    return result;
+}
+
+// Zips several views together, producing a tuple of corresponding elements.
+// The zipped range is as long as the shortest of its inputs.
+//
+// Dereferencing an iterator yields a zip_tuple of references into each
+// range. This supports assignment, and iter_move and iter_swap act on every
+// underlying range at once, so mutating algorithms such as sort can be used
+// to permute structure-of-arrays data in place.
+template <typename... Vs>
+struct zip_view : view_interface<zip_view<Vs...>> {
+private:
+    static_assert(sizeof...(Vs) > 0);
+    static_assert((input_range<Vs> && ...));
+    static_assert((view<Vs> && ...));
+
+    template <bool Const, typename V>
+    using maybe_const = detail::conditional_t<Const, const V, V>;
+
+    template <bool> struct sentinel;
+
+    template <bool Const>
+    struct iterator {
+    private:
+        friend struct iterator<!Const>;
+        friend struct zip_view;
+        template <bool> friend struct sentinel;
+
+        static constexpr bool forward = all_forward<maybe_const<Const, Vs>...>;
+        static constexpr bool bidi =
+            all_bidirectional<maybe_const<Const, Vs>...>;
+        static constexpr bool random_access =
+            all_random_access<maybe_const<Const, Vs>...>;
+
+        std::tuple<iterator_t<maybe_const<Const, Vs>>...> current_;
+
+        constexpr explicit iterator(
+            std::tuple<iterator_t<maybe_const<Const, Vs>>...> current)
+            : current_(std::move(current))
+        {}
+
+    public:
+        using iterator_category = detail::conditional_t<
+            random_access, random_access_iterator_tag,
+            detail::conditional_t<
+                bidi, bidirectional_iterator_tag,
+                detail::conditional_t<forward, forward_iterator_tag,
+                                      input_iterator_tag>>>;
+        using value_type = std::tuple<range_value_t<maybe_const<Const, Vs>>...>;
+        using difference_type = common_type_t<
+            range_difference_t<maybe_const<Const, Vs>>...>;
+        // Extension: legacy typedefs
+        using pointer = void;
+        using reference =
+            detail::zip_tuple<range_reference_t<maybe_const<Const, Vs>>...>;
+
+        iterator() = default;
+
+        template <typename I,
+            std::enable_if_t<same_as<I, iterator<!Const>>, int> = 0,
+            bool C = Const, std::enable_if_t<C &&
+            (convertible_to<iterator_t<maybe_const<!C, Vs>>,
+                            iterator_t<maybe_const<C, Vs>>> && ...),
+            int> = 0>
+        constexpr iterator(I i)
+            : current_(std::move(i.current_))
+        {}
+
+        constexpr reference operator*() const
+        {
+            return std::apply([](const auto&... its) {
+                return reference(*its...);
+            }, current_);
+        }
+
+        constexpr iterator& operator++()
+        {
+            tuple_for_each([](auto& it) { ++it; }, current_);
+            return *this;
+        }
+
+        constexpr auto operator++(int)
+        {
+            if constexpr (forward) {
+                auto tmp = *this;
+                ++*this;
+                return tmp;
+            } else {
+                ++*this;
+            }
+        }
+
+        template <bool B = bidi>
+        constexpr auto operator--() -> std::enable_if_t<B, iterator&>
+        {
+            tuple_for_each([](auto& it) { --it; }, current_);
+            return *this;
+        }
+
+        template <bool B = bidi>
+        constexpr auto operator--(int) -> std::enable_if_t<B, iterator>
+        {
+            auto tmp = *this;
+            --*this;
+            return tmp;
+        }
+
+        template <bool B = random_access>
+        constexpr auto operator+=(difference_type n)
+            -> std::enable_if_t<B, iterator&>
+        {
+            tuple_for_each([n](auto& it) {
+                using D = iter_difference_t<remove_cvref_t<decltype(it)>>;
+                it += static_cast<D>(n);
+            }, current_);
+            return *this;
+        }
+
+        template <bool B = random_access>
+        constexpr auto operator-=(difference_type n)
+            -> std::enable_if_t<B, iterator&>
+        {
+            tuple_for_each([n](auto& it) {
+                using D = iter_difference_t<remove_cvref_t<decltype(it)>>;
+                it -= static_cast<D>(n);
+            }, current_);
+            return *this;
+        }
+
+        template <bool B = random_access, typename = std::enable_if_t<B>>
+        constexpr reference operator[](difference_type n) const
+        {
+            return *(*this + n);
+        }
+
+        // If the underlying ranges are bidirectional then iterators may only
+        // be compared in lockstep. Otherwise, an iterator which has reached
+        // the end of the shortest range must compare equal to the end
+        // iterator, so any matching position counts.
+        template <bool B = (equality_comparable<
+                      iterator_t<maybe_const<Const, Vs>>> && ...)>
+        friend constexpr auto operator==(const iterator& x, const iterator& y)
+            -> std::enable_if_t<B, bool>
+        {
+            if constexpr (bidi) {
+                return x.current_ == y.current_;
+            } else {
+                bool eq = false;
+                tuple_for_each([&eq](const auto& a, const auto& b) {
+                    eq = eq || bool(a == b);
+                }, x.current_, y.current_);
+                return eq;
+            }
+        }
+
+        template <bool B = (equality_comparable<
+                      iterator_t<maybe_const<Const, Vs>>> && ...)>
+        friend constexpr auto operator!=(const iterator& x, const iterator& y)
+            -> std::enable_if_t<B, bool>
+        {
+            return !(x == y);
+        }
+
+        template <bool B = random_access>
+        friend constexpr auto operator<(const iterator& x, const iterator& y)
+            -> std::enable_if_t<B, bool>
+        {
+            return x.current_ < y.current_;
+        }
+
+        template <bool B = random_access>
+        friend constexpr auto operator>(const iterator& x, const iterator& y)
+            -> std::enable_if_t<B, bool>
+        {
+            return y < x;
+        }
+
+        template <bool B = random_access>
+        friend constexpr auto operator<=(const iterator& x, const iterator& y)
+            -> std::enable_if_t<B, bool>
+        {
+            return !(y < x);
+        }
+
+        template <bool B = random_access>
+        friend constexpr auto operator>=(const iterator& x, const iterator& y)
+            -> std::enable_if_t<B, bool>
+        {
+            return !(x < y);
+        }
+
+        template <bool B = random_access>
+        friend constexpr auto operator+(iterator i, difference_type n)
+            -> std::enable_if_t<B, iterator>
+        {
+            i += n;
+            return i;
+        }
+
+        template <bool B = random_access>
+        friend constexpr auto operator+(difference_type n, iterator i)
+            -> std::enable_if_t<B, iterator>
+        {
+            i += n;
+            return i;
+        }
+
+        template <bool B = random_access>
+        friend constexpr auto operator-(iterator i, difference_type n)
+            -> std::enable_if_t<B, iterator>
+        {
+            i -= n;
+            return i;
+        }
+
+        // The distance is the one with the smallest magnitude
+        template <bool B = (sized_sentinel_for<
+                      iterator_t<maybe_const<Const, Vs>>,
+                      iterator_t<maybe_const<Const, Vs>>> && ...)>
+        friend constexpr auto operator-(const iterator& x, const iterator& y)
+            -> std::enable_if_t<B, difference_type>
+        {
+            return zip_view_::min_distance<difference_type>(x.current_,
+                                                            y.current_);
+        }
+
+        friend constexpr auto iter_move(const iterator& i)
+            noexcept((noexcept(ranges::iter_move(
+                std::declval<const iterator_t<maybe_const<Const, Vs>>&>())) &&
+                ...))
+        {
+            return std::apply([](const auto&... its) {
+                return detail::zip_tuple<
+                    range_rvalue_reference_t<maybe_const<Const, Vs>>...>(
+                        ranges::iter_move(its)...);
+            }, i.current_);
+        }
+
+        template <bool B = (indirectly_swappable<
+                      iterator_t<maybe_const<Const, Vs>>> && ...)>
+        friend constexpr auto iter_swap(const iterator& x, const iterator& y)
+            noexcept((noexcept(ranges::iter_swap(
+                std::declval<iterator_t<maybe_const<Const, Vs>>&>(),
+                std::declval<iterator_t<maybe_const<Const, Vs>>&>())) &&
+                ...))
+            -> std::enable_if_t<B>
+        {
+            tuple_for_each([](auto a, auto b) {
+                ranges::iter_swap(a, b);
+            }, x.current_, y.current_);
+        }
+    };
+
+    template <bool Const>
+    struct sentinel {
+    private:
+        friend struct sentinel<!Const>;
+        friend struct zip_view;
+
+        std::tuple<sentinel_t<maybe_const<Const, Vs>>...> end_;
+
+        constexpr explicit sentinel(
+            std::tuple<sentinel_t<maybe_const<Const, Vs>>...> end)
+            : end_(std::move(end))
+        {}
+
+        constexpr bool equal(const iterator<Const>& i) const
+        {
+            bool eq = false;
+            tuple_for_each([&eq](const auto& it, const auto& s) {
+                eq = eq || bool(it == s);
+            }, i.current_, end_);
+            return eq;
+        }
+
+    public:
+        sentinel() = default;
+
+        template <typename S,
+            std::enable_if_t<same_as<S, sentinel<!Const>>, int> = 0,
+            bool C = Const, std::enable_if_t<C &&
+            (convertible_to<sentinel_t<maybe_const<!C, Vs>>,
+                            sentinel_t<maybe_const<C, Vs>>> && ...),
+            int> = 0>
+        constexpr sentinel(S s)
+            : end_(std::move(s.end_))
+        {}
+
+        friend constexpr bool operator==(const iterator<Const>& x, const sentinel& y)
+        {
+            return y.equal(x);
+        }
+
+        friend constexpr bool operator==(const sentinel& x, const iterator<Const>& y)
+        {
+            return x.equal(y);
+        }
+
+        friend constexpr bool operator!=(const iterator<Const>& x, const sentinel& y)
+        {
+            return !y.equal(x);
+        }
+
+        friend constexpr bool operator!=(const sentinel& x, const iterator<Const>& y)
+        {
+            return !x.equal(y);
+        }
+
+        template <bool B = (sized_sentinel_for<
+                      sentinel_t<maybe_const<Const, Vs>>,
+                      iterator_t<maybe_const<Const, Vs>>> && ...)>
+        friend constexpr auto operator-(const sentinel& x, const iterator<Const>& y)
+            -> std::enable_if_t<B, typename iterator<Const>::difference_type>
+        {
+            return zip_view_::min_distance<
+                typename iterator<Const>::difference_type>(x.end_, y.current_);
+        }
+
+        template <bool B = (sized_sentinel_for<
+                      sentinel_t<maybe_const<Const, Vs>>,
+                      iterator_t<maybe_const<Const, Vs>>> && ...)>
+        friend constexpr auto operator-(const iterator<Const>& x, const sentinel& y)
+            -> std::enable_if_t<B, typename iterator<Const>::difference_type>
+        {
+            return -(y - x);
+        }
+    };
+
+    template <bool Const, typename Self>
+    static constexpr auto begin_impl(Self& self)
+    {
+        return iterator<Const>{std::apply([](auto&... bases) {
+            return std::make_tuple(ranges::begin(bases)...);
+        }, self.bases_)};
+    }
+
+    template <bool Const, typename Self>
+    static constexpr auto end_impl(Self& self)
+    {
+        if constexpr (!zip_is_common<maybe_const<Const, Vs>...>) {
+            return sentinel<Const>{std::apply([](auto&... bases) {
+                return std::make_tuple(ranges::end(bases)...);
+            }, self.bases_)};
+        } else if constexpr (all_random_access<maybe_const<Const, Vs>...>) {
+            return begin_impl<Const>(self) +
+                   static_cast<typename iterator<Const>::difference_type>(
+                       self.size());
+        } else {
+            return iterator<Const>{std::apply([](auto&... bases) {
+                return std::make_tuple(ranges::end(bases)...);
+            }, self.bases_)};
+        }
+    }
+
+    template <typename Self>
+    static constexpr auto size_impl(Self& self)
+    {
+        return std::apply([](auto&... bases) {
+            using S = std::make_unsigned_t<
+                common_type_t<decltype(ranges::size(bases))...>>;
+            S sizes[] = {static_cast<S>(ranges::size(bases))...};
+            S result = sizes[0];
+            for (S s : sizes) {
+                result = s < result ? s : result;
+            }
+            return result;
+        }, self.bases_);
+    }
+
+    std::tuple<Vs...> bases_;
+
+public:
+    zip_view() = default;
+
+    constexpr explicit zip_view(Vs... bases)
+        : bases_(std::move(bases)...)
+    {}
+
+    template <bool B = !(detail::simple_view<Vs> && ...),
+              std::enable_if_t<B, int> = 0>
+    constexpr auto begin()
+    {
+        return begin_impl<false>(*this);
+    }
+
+    template <bool B = (range<const Vs> && ...), std::enable_if_t<B, int> = 0>
+    constexpr auto begin() const
+    {
+        return begin_impl<true>(*this);
+    }
+
+    template <bool B = !(detail::simple_view<Vs> && ...),
+              std::enable_if_t<B, int> = 0>
+    constexpr auto end()
+    {
+        return end_impl<false>(*this);
+    }
+
+    template <bool B = (range<const Vs> && ...), std::enable_if_t<B, int> = 0>
+    constexpr auto end() const
+    {
+        return end_impl<true>(*this);
+    }
+
+    template <bool B = (sized_range<Vs> && ...), std::enable_if_t<B, int> = 0>
+    constexpr auto size()
+    {
+        return size_impl(*this);
+    }
+
+    template <bool B = (sized_range<const Vs> && ...),
+              std::enable_if_t<B, int> = 0>
+    constexpr auto size() const
+    {
+        return size_impl(*this);
+    }
+};
+
+template <typename... Rs>
+zip_view(Rs&&...) -> zip_view<all_view<Rs>...>;
+
+} // namespace zip_view_
+
+using zip_view_::zip_view;
+
+namespace detail {
+
+struct zip_view_fn {
+    template <typename... Rs>
+    constexpr auto operator()(Rs&&... rs) const
+        -> decltype(zip_view{std::forward<Rs>(rs)...})
+    {
+        return zip_view{std::forward<Rs>(rs)...};
+    }
+
+    // Zipping nothing gives an empty range
+    constexpr auto operator()() const
+    {
+        return empty_view<std::tuple<>>{};
+    }
+};
+
+// Unpacks a zip_tuple into the arguments of a function
+template <typename F>
+struct zip_apply {
+    F fun;
+
+    template <typename Tuple>
+    constexpr decltype(auto) operator()(Tuple&& t)
+    {
+        return std::apply(fun, std::forward<Tuple>(t));
+    }
+
+    template <typename Tuple>
+    constexpr decltype(auto) operator()(Tuple&& t) const
+    {
+        return std::apply(fun, std::forward<Tuple>(t));
+    }
+};
+
+// zip_transform(f, rs...) is the range of f(e...) where e... are the
+// corresponding elements of each of rs. It is a transform_view over a
+// zip_view: each dereference builds a tuple of references to the elements,
+// which is immediately unpacked into the call to f with std::apply.
+struct zip_transform_view_fn {
+    template <typename F, typename... Rs>
+    constexpr auto operator()(F&& f, Rs&&... rs) const
+        -> decltype(transform_view{
+            zip_view{std::forward<Rs>(rs)...},
+            zip_apply<std::decay_t<F>>{std::forward<F>(f)}})
+    {
+        return transform_view{
+            zip_view{std::forward<Rs>(rs)...},
+            zip_apply<std::decay_t<F>>{std::forward<F>(f)}};
+    }
+};
+
+} // namespace detail
+
+namespace views {
+
+NANO_INLINE_VAR(nano::detail::zip_view_fn, zip)
+
+NANO_INLINE_VAR(nano::detail::zip_transform_view_fn, zip_transform)
+
+}
+
+NANO_END_NAMESPACE
+
+#endif
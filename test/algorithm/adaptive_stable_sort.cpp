@@ -0,0 +1,178 @@
+// nanorange/test/algorithm/adaptive_stable_sort.cpp
+//
+// Copyright (c) 2020 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <nanorange/algorithm/adaptive_stable_sort.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../catch.hpp"
+
+namespace {
+
+std::mt19937 gen;
+
+using P = std::pair<int, int>;
+
+// Keys in the given order, each tagged with its original position so that
+// the sort can be checked for stability
+std::vector<P> tag(const std::vector<int>& keys)
+{
+    std::vector<P> v;
+    for (std::size_t i = 0; i < keys.size(); ++i) {
+        v.emplace_back(keys[i], static_cast<int>(i));
+    }
+    return v;
+}
+
+void check_sort(const std::vector<int>& keys)
+{
+    auto v = tag(keys);
+    auto expected = v;
+    std::stable_sort(expected.begin(), expected.end(),
+                     [](const P& a, const P& b) { return a.first < b.first; });
+
+    const auto res = nano::adaptive_stable_sort(v, nano::less{}, &P::first);
+    CHECK(res == v.end());
+    CHECK(v == expected);
+
+    // And in reverse order, so that ascending runs become descending ones
+    v = tag(keys);
+    expected = v;
+    std::stable_sort(expected.begin(), expected.end(),
+                     [](const P& a, const P& b) { return a.first > b.first; });
+    nano::adaptive_stable_sort(v.begin(), v.end(), nano::greater{}, &P::first);
+    CHECK(v == expected);
+}
+
+// n keys made of the given number of sorted runs, each ascending or
+// descending at random, with values drawn from [0, max)
+std::vector<int> make_runs(std::size_t n, std::size_t runs, int max)
+{
+    std::uniform_int_distribution<int> dist(0, max - 1);
+    std::vector<int> keys(n);
+    std::generate(keys.begin(), keys.end(), [&] { return dist(gen); });
+
+    std::vector<std::size_t> bounds{0, n};
+    std::uniform_int_distribution<std::size_t> pos(0, n);
+    for (std::size_t i = 1; i < runs; ++i) {
+        bounds.push_back(pos(gen));
+    }
+    std::sort(bounds.begin(), bounds.end());
+
+    for (std::size_t i = 0; i + 1 < bounds.size(); ++i) {
+        const auto first = keys.begin() + static_cast<std::ptrdiff_t>(bounds[i]);
+        const auto last = keys.begin() + static_cast<std::ptrdiff_t>(bounds[i + 1]);
+        if (gen() % 2 == 0) {
+            std::sort(first, last);
+        } else {
+            std::sort(first, last, std::greater<>{});
+        }
+    }
+    return keys;
+}
+
+}
+
+TEST_CASE("alg.adaptive_stable_sort.empty")
+{
+    std::vector<int> v;
+    CHECK(nano::adaptive_stable_sort(v) == v.end());
+
+    int a[] = {1};
+    CHECK(nano::adaptive_stable_sort(a) == a + 1);
+    CHECK(a[0] == 1);
+}
+
+TEST_CASE("alg.adaptive_stable_sort.random")
+{
+    for (std::size_t n : {2, 3, 23, 24, 25, 48, 100, 1000, 10000}) {
+        for (int max : {2, 10, 1000000}) {
+            std::uniform_int_distribution<int> dist(0, max - 1);
+            std::vector<int> keys(n);
+            std::generate(keys.begin(), keys.end(), [&] { return dist(gen); });
+            check_sort(keys);
+        }
+    }
+}
+
+TEST_CASE("alg.adaptive_stable_sort.runs")
+{
+    for (std::size_t n : {100, 1000, 50000}) {
+        for (std::size_t runs : {1, 2, 3, 10, 100}) {
+            for (int max : {5, 1000000}) {
+                check_sort(make_runs(n, runs, max));
+            }
+        }
+    }
+}
+
+TEST_CASE("alg.adaptive_stable_sort.patterns")
+{
+    std::vector<int> keys(5000);
+
+    // Sorted, reversed and all equal
+    std::iota(keys.begin(), keys.end(), 0);
+    check_sort(keys);
+    std::reverse(keys.begin(), keys.end());
+    check_sort(keys);
+    std::fill(keys.begin(), keys.end(), 7);
+    check_sort(keys);
+
+    // Sorted, with a few new elements appended
+    std::iota(keys.begin(), keys.end(), 0);
+    for (std::size_t i = 4990; i < keys.size(); ++i) {
+        keys[i] = static_cast<int>(gen() % 5000);
+    }
+    check_sort(keys);
+
+    // Sawtooth, whose descending steps must not be swapped with equal keys
+    for (std::size_t i = 0; i < keys.size(); ++i) {
+        keys[i] = static_cast<int>(i % 250);
+    }
+    check_sort(keys);
+    for (std::size_t i = 0; i < keys.size(); ++i) {
+        keys[i] = static_cast<int>(250 - i % 250) / 2;
+    }
+    check_sort(keys);
+}
+
+TEST_CASE("alg.adaptive_stable_sort.move_only")
+{
+    std::vector<std::unique_ptr<int>> v;
+    const auto keys = make_runs(3000, 20, 100);
+    for (int k : keys) {
+        v.push_back(std::make_unique<int>(k));
+    }
+
+    nano::adaptive_stable_sort(v, nano::less{},
+                               [](const auto& p) { return *p; });
+
+    auto sorted = keys;
+    std::sort(sorted.begin(), sorted.end());
+    REQUIRE(v.size() == sorted.size());
+    for (std::size_t i = 0; i < v.size(); ++i) {
+        CHECK(*v[i] == sorted[i]);
+    }
+}
+
+TEST_CASE("alg.adaptive_stable_sort.strings")
+{
+    std::vector<std::string> v;
+    for (int i = 0; i < 2000; ++i) {
+        v.push_back(std::to_string((i * 37) % 500));
+    }
+    auto expected = v;
+    std::stable_sort(expected.begin(), expected.end());
+    nano::adaptive_stable_sort(v);
+    CHECK(v == expected);
+}
@@ -0,0 +1,125 @@
+// nanorange/test/algorithm/batch_bound.cpp
+//
+// Copyright (c) 2020 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <nanorange/algorithm/batch_lower_bound.hpp>
+#include <nanorange/algorithm/batch_upper_bound.hpp>
+#include <nanorange/iterator/back_insert_iterator.hpp>
+
+#include <algorithm>
+#include <deque>
+#include <forward_list>
+#include <functional>
+#include <random>
+#include <vector>
+
+#include "../catch.hpp"
+#include "../test_iterators.hpp"
+
+namespace {
+
+std::mt19937 gen;
+
+template <typename Rng, typename Keys, typename Comp = std::less<>>
+void check_batch(Rng& rng, const Keys& keys, Comp comp = Comp{})
+{
+    using I = nano::iterator_t<Rng>;
+
+    std::vector<I> lower;
+    const auto l = nano::batch_lower_bound(rng, keys,
+                                           nano::back_inserter(lower), comp);
+    CHECK(l.in == nano::end(keys));
+    REQUIRE(lower.size() == keys.size());
+
+    std::vector<I> upper;
+    const auto u = nano::batch_upper_bound(rng, keys,
+                                           nano::back_inserter(upper), comp);
+    CHECK(u.in == nano::end(keys));
+    REQUIRE(upper.size() == keys.size());
+
+    std::size_t i = 0;
+    for (const auto& key : keys) {
+        CHECK(lower[i] == std::lower_bound(nano::begin(rng), nano::end(rng),
+                                           key, comp));
+        CHECK(upper[i] == std::upper_bound(nano::begin(rng), nano::end(rng),
+                                           key, comp));
+        ++i;
+    }
+}
+
+} // namespace
+
+TEST_CASE("alg.batch_lower_bound")
+{
+    // Sizes either side of the batch width and of the prefetch threshold
+    for (int n : {0, 1, 2, 3, 7, 16, 17, 100, 5000, 100'000}) {
+        std::vector<int> v(n);
+        std::uniform_int_distribution<int> dist(-10, n + 10);
+        for (auto& i : v) i = dist(gen);
+        std::sort(v.begin(), v.end());
+
+        for (int num_keys : {0, 1, 15, 16, 17, 100}) {
+            std::vector<int> keys(num_keys);
+            for (auto& k : keys) k = dist(gen);
+            check_batch(v, keys);
+
+            // Keys from a forward-only range
+            std::forward_list<int> flist(keys.begin(), keys.end());
+            std::vector<std::vector<int>::iterator> out(keys.size());
+            const auto res = nano::batch_lower_bound(v, flist, out.begin());
+            CHECK(res.in == flist.end());
+            CHECK(res.out == out.end());
+            auto it = out.begin();
+            for (int k : flist) {
+                CHECK(*it++ == std::lower_bound(v.begin(), v.end(), k));
+            }
+        }
+
+        // Non-contiguous ranges and other comparators
+        std::deque<int> d(v.rbegin(), v.rend());
+        std::vector<int> keys(40);
+        for (auto& k : keys) k = dist(gen);
+        check_batch(d, keys, std::greater<>{});
+    }
+}
+
+TEST_CASE("alg.batch_upper_bound")
+{
+    // Iterators and sentinels, and projections
+    struct S {
+        int key;
+        int value;
+    };
+    std::vector<S> v;
+    for (int i = 0; i < 1000; ++i) {
+        v.push_back({i / 3, i});
+    }
+    const int keys[] = {-1, 0, 5, 100, 332, 333, 400};
+    std::vector<std::vector<S>::iterator> out(7);
+
+    const auto res = nano::batch_upper_bound(
+        v.begin(), v.end(), forward_iterator<const int*>(nano::begin(keys)),
+        sentinel<const int*>(nano::end(keys)), out.begin(), nano::less{},
+        &S::key);
+    CHECK(res.out == out.end());
+    CHECK(out[0] == v.begin());
+    CHECK(out[1] == v.begin() + 3);
+    CHECK(out[2] == v.begin() + 18);
+    CHECK(out[3] == v.begin() + 303);
+    CHECK(out[4] == v.begin() + 999);
+    CHECK(out[5] == v.end());
+    CHECK(out[6] == v.end());
+
+    const auto res2 = nano::batch_lower_bound(
+        v.begin(), v.end(), nano::begin(keys), nano::end(keys), out.begin(),
+        nano::less{}, &S::key);
+    CHECK(res2.in == nano::end(keys));
+    CHECK(out[0] == v.begin());
+    CHECK(out[1] == v.begin());
+    CHECK(out[2] == v.begin() + 15);
+    CHECK(out[4] == v.begin() + 996);
+    CHECK(out[5] == v.begin() + 999);
+    CHECK(out[6] == v.end());
+}
@@ -9,9 +9,12 @@
 //
 // Project home: https://github.com/ericniebler/range-v3
 
+#include <array>
 #include <cstring>
+#include <string>
 #include <utility>
 #include <algorithm>
+#include <vector>
 #include <nanorange/algorithm/copy.hpp>
 
 #include "../catch.hpp"
@@ -68,3 +71,73 @@ TEST_CASE("alg.copy")
     }
 #endif
 }
+
+namespace {
+
+constexpr std::array<int, 5> constexpr_copy()
+{
+    std::array<int, 5> in{1, 2, 3, 4, 5};
+    std::array<int, 5> out{};
+    ranges::copy(in, out.begin());
+    return out;
+}
+
+}
+
+TEST_CASE("alg.copy.contiguous")
+{
+    // These use memmove at run time, but must still work in constexpr
+    static_assert(constexpr_copy()[4] == 5);
+
+    using vec_iter = std::vector<int>::iterator;
+    using vec_citer = std::vector<int>::const_iterator;
+    static_assert(ranges::detail::is_memmove_assignable<vec_citer, vec_citer, vec_iter>);
+    static_assert(ranges::detail::is_memmove_assignable<const char*, const char*, std::string::iterator>);
+    static_assert(!ranges::detail::is_memmove_assignable<vec_iter, vec_iter, vec_citer>);
+    static_assert(!ranges::detail::is_memmove_assignable<vec_iter, vec_iter, long*>);
+    static_assert(!ranges::detail::is_memmove_assignable<std::vector<bool>::iterator,
+                                                         std::vector<bool>::iterator, bool*>);
+
+    std::vector<int> in{1, 2, 3, 4, 5};
+    std::vector<int> out(5);
+
+    auto res = ranges::copy(in, out.begin());
+    REQUIRE(res.in == in.end());
+    REQUIRE(res.out == out.end());
+    REQUIRE(in == out);
+
+    std::string str = "hello world";
+    std::string buf(str.size(), '\0');
+    auto res2 = ranges::copy_n(str.cbegin(), 5, buf.begin());
+    REQUIRE(res2.in == str.begin() + 5);
+    REQUIRE(res2.out == buf.begin() + 5);
+    REQUIRE(buf.compare(0, 5, "hello") == 0);
+    REQUIRE(ranges::copy_n(str.cbegin(), -1, buf.begin()).in == str.cbegin());
+
+    // Overlapping ranges
+    std::vector<int> vec{1, 2, 3, 4, 5, 6};
+    auto res3 = ranges::copy(vec.begin() + 2, vec.end(), vec.begin());
+    REQUIRE(res3.in == vec.end());
+    REQUIRE(res3.out == vec.begin() + 4);
+    REQUIRE(vec == std::vector<int>{3, 4, 5, 6, 5, 6});
+
+    vec = {1, 2, 3, 4, 5, 6};
+    auto res4 = ranges::copy_backward(vec.begin(), vec.begin() + 4, vec.end());
+    REQUIRE(res4.in == vec.begin() + 4);
+    REQUIRE(res4.out == vec.begin() + 2);
+    REQUIRE(vec == std::vector<int>{1, 2, 1, 2, 3, 4});
+
+    // Empty ranges
+    std::vector<int> empty;
+    REQUIRE(ranges::copy(empty, out.begin()).out == out.begin());
+    REQUIRE(ranges::copy_backward(empty, out.end()).out == out.end());
+
+    // Volatile elements are copied one at a time, not with memmove
+    static_assert(!ranges::detail::is_memmove_assignable<volatile int*, volatile int*, int*>);
+    static_assert(!ranges::detail::is_memmove_assignable<int*, int*, volatile int*>);
+    volatile int vin[] = {1, 2, 3};
+    volatile int vout[3] = {};
+    ranges::copy(vin, vout);
+    REQUIRE(vout[0] == 1);
+    REQUIRE(vout[2] == 3);
+}
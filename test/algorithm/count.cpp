@@ -14,6 +14,11 @@
 #include "../test_iterators.hpp"
 #include "../test_utils.hpp"
 
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
 namespace {
 
 struct S {
@@ -69,3 +74,55 @@ TEST_CASE("alg.count")
 		CHECK(count(std::move(l), 7) == 0);
 	}
 }
+
+namespace {
+
+template <typename T>
+void test_count_contiguous(std::size_t size)
+{
+	std::vector<T> vec(size);
+	std::ptrdiff_t expected = 0;
+	for (std::size_t i = 0; i < size; i++) {
+		vec[i] = T(i % 3);
+		expected += i % 3 == 1;
+	}
+	CHECK(nano::count(vec, T(1)) == expected);
+	CHECK(nano::count(vec.data() + 1, vec.data() + size, T(7)) == 0);
+
+	// Every element matching can overflow a per-lane counter if we aren't
+	// careful
+	std::fill(vec.begin(), vec.end(), T(1));
+	CHECK(nano::count(vec, T(1)) == std::ptrdiff_t(size));
+}
+
+constexpr int constexpr_count()
+{
+	int arr[] = {1, 2, 1, 2, 1};
+	return static_cast<int>(nano::count(arr, 1));
+}
+
+}
+
+TEST_CASE("alg.count.contiguous")
+{
+	static_assert(constexpr_count() == 3);
+
+	for (std::size_t size : {0, 1, 15, 16, 17, 33, 1000, 1'000'000}) {
+		test_count_contiguous<std::uint8_t>(size);
+		test_count_contiguous<std::int16_t>(size);
+		test_count_contiguous<int>(size);
+		test_count_contiguous<std::uint64_t>(size);
+		test_count_contiguous<float>(size);
+		test_count_contiguous<double>(size);
+	}
+
+	std::vector<unsigned char> uc(100, 255);
+	CHECK(nano::count(uc, -1) == 0);
+	CHECK(nano::count(uc, 255) == 100);
+	std::vector<int> ints(100, -1);
+	CHECK(nano::count(ints, 0xFFFFFFFFu) == 100);
+
+	std::vector<double> dbl{0.0, -0.0, std::numeric_limits<double>::quiet_NaN()};
+	CHECK(nano::count(dbl, 0.0) == 2);
+	CHECK(nano::count(dbl, std::numeric_limits<double>::quiet_NaN()) == 0);
+}
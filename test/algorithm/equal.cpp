@@ -19,6 +19,10 @@
 //===----------------------------------------------------------------------===//
 
 #include <nanorange/algorithm/equal.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
 #include "../catch.hpp"
 #include "../test_iterators.hpp"
 #include "../test_utils.hpp"
@@ -300,3 +304,61 @@ TEST_CASE("alg.equal")
 		CHECK(ranges::equal(ranges::begin(a), ranges::end(a), ranges::begin(b)));
 	}
 }
+
+namespace {
+
+template <typename T>
+void test_equal_contiguous(std::size_t size)
+{
+	std::vector<T> a(size);
+	for (std::size_t i = 0; i < size; i++) {
+		a[i] = T(i * 7);
+	}
+	std::vector<T> b = a;
+	CHECK(nano::equal(a, b));
+	CHECK(nano::equal(a.data(), a.data() + size, b.data(), b.data() + size));
+
+	// A difference at any position, including the last, is found
+	for (std::size_t i : {std::size_t(0), size / 2, size - 1}) {
+		if (i >= size) {
+			continue;
+		}
+		b[i] = T(b[i] + 1);
+		CHECK_FALSE(nano::equal(a, b));
+		CHECK_FALSE(nano::equal(b, a));
+		b[i] = a[i];
+	}
+
+	if (size > 0) {
+		b.pop_back();
+		CHECK_FALSE(nano::equal(a, b));
+		CHECK(nano::equal(a.begin(), a.end() - 1, b.begin(), b.end()));
+	}
+}
+
+}
+
+TEST_CASE("alg.equal.contiguous")
+{
+	// Sizes either side of the vector widths, and large enough to take
+	// several iterations of the vectorised loop
+	for (std::size_t size : {0, 1, 15, 16, 17, 31, 32, 33, 1000, 4096}) {
+		test_equal_contiguous<unsigned char>(size);
+		test_equal_contiguous<signed char>(size);
+		test_equal_contiguous<char>(size);
+		test_equal_contiguous<std::int16_t>(size);
+		test_equal_contiguous<int>(size);
+		test_equal_contiguous<std::uint64_t>(size);
+	}
+
+	std::byte x[] = {std::byte{1}, std::byte{2}, std::byte{3}};
+	std::byte y[] = {std::byte{1}, std::byte{2}, std::byte{4}};
+	CHECK(nano::equal(x, x));
+	CHECK_FALSE(nano::equal(x, y));
+
+	const std::string s1 = "the quick brown fox jumps over the lazy dog";
+	std::string s2 = s1;
+	CHECK(nano::equal(s1, s2));
+	s2.back() = 'G';
+	CHECK_FALSE(nano::equal(s1, s2));
+}
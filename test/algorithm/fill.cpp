@@ -20,7 +20,9 @@
 
 #include <nanorange/algorithm/fill.hpp>
 #include <nanorange/views/subrange.hpp>
+#include <algorithm>
 #include <cstring>
+#include <numeric>
 #include <string>
 #include <vector>
 #include "../catch.hpp"
@@ -100,3 +102,49 @@ TEST_CASE("alg.fill")
 	test_int<bidirectional_iterator<int*>, sentinel<int*> >();
 	test_int<random_access_iterator<int*>, sentinel<int*> >();
 }
+
+TEST_CASE("alg.fill.par")
+{
+	stl2::thread_pool pool(4);
+	const auto policy = stl2::par.on(pool).with_grain_size(1000);
+
+	const int size = 100'003;
+	std::vector<int> v(size, 0);
+
+	for (int offset : {0, 1, 3}) {
+		CHECK(stl2::fill(policy, v.begin() + offset, v.end(), offset + 1) == v.end());
+	}
+	CHECK(v[0] == 1);
+	CHECK(std::count(v.begin() + 1, v.begin() + 3, 2) == 2);
+	CHECK(std::count(v.begin() + 3, v.end(), 4) == size - 3);
+
+	CHECK(stl2::fill(stl2::par, v, 5) == v.end());
+	CHECK(std::count(v.begin(), v.end(), 5) == size);
+
+	// Random access, but not contiguous
+	using RI = random_access_iterator<int*>;
+	CHECK(stl2::fill(policy, RI(v.data()), RI(v.data() + size), 6).base() ==
+	      v.data() + size);
+	CHECK(std::count(v.begin(), v.end(), 6) == size);
+
+	std::vector<std::string> strs(10'000);
+	stl2::fill(policy, stl2::subrange(strs.begin(), strs.end()),
+	           std::string("a long enough string to allocate"));
+	CHECK(std::count(strs.begin(), strs.end(),
+	                 "a long enough string to allocate") == 10'000);
+
+	stl2::fill(stl2::seq, v, 7);
+	CHECK(std::count(v.begin(), v.end(), 7) == size);
+
+	// Small ranges which end before the first cache line boundary
+	alignas(64) int small[32];
+	const auto tiny = stl2::par.on(pool).with_grain_size(1);
+	for (int offset : {1, 5, 15}) {
+		for (int n : {0, 1, 8, 14, 15, 16, 17}) {
+			std::fill(std::begin(small), std::end(small), 0);
+			CHECK(stl2::fill(tiny, small + offset, small + offset + n, 1) ==
+			      small + offset + n);
+			CHECK(std::count(std::begin(small), std::end(small), 1) == n);
+		}
+	}
+}
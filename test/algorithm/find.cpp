@@ -22,6 +22,11 @@
 #include "../catch.hpp"
 #include "../test_iterators.hpp"
 
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+
 struct S
 {
 	int i_;
@@ -60,3 +65,70 @@ TEST_CASE("alg.find")
 	ps = find(sa, 10, &S::i_);
 	CHECK(ps == nano::end(sa));
 }
+
+namespace {
+
+template <typename T>
+void test_find_contiguous()
+{
+	// Cover every match position relative to the vector width and the tail
+	for (std::size_t size : {0, 1, 7, 15, 16, 17, 31, 32, 33, 64, 100, 1000}) {
+		std::vector<T> vec(size, T(1));
+		CHECK(nano::find(vec, T(2)) == vec.end());
+		for (std::size_t i = 0; i < size; i++) {
+			vec[i] = T(2);
+			vec.back() = T(2);
+			CHECK(nano::find(vec, T(2)) == vec.begin() + i);
+			CHECK(nano::find(vec.data() + i, vec.data() + size, T(2)) == vec.data() + i);
+			vec[i] = T(1);
+			vec.back() = T(1);
+		}
+	}
+}
+
+constexpr int constexpr_find()
+{
+	int arr[] = {1, 2, 3, 4, 5};
+	return *nano::find(arr, 4);
+}
+
+}
+
+TEST_CASE("alg.find.contiguous")
+{
+	static_assert(constexpr_find() == 4);
+
+	test_find_contiguous<char>();
+	test_find_contiguous<std::uint8_t>();
+	test_find_contiguous<std::int16_t>();
+	test_find_contiguous<int>();
+	test_find_contiguous<unsigned>();
+	test_find_contiguous<std::int64_t>();
+	test_find_contiguous<std::uint64_t>();
+	test_find_contiguous<float>();
+	test_find_contiguous<double>();
+
+	// Values which can't be represented in the element type never match,
+	// otherwise the usual arithmetic conversions apply
+	std::vector<unsigned char> uc(100, 255);
+	CHECK(nano::find(uc, -1) == uc.end());
+	CHECK(nano::find(uc, 255) == uc.begin());
+	std::vector<signed char> sc(100, -56);
+	CHECK(nano::find(sc, 200u) == sc.end());
+	std::vector<int> ints(100, -1);
+	CHECK(nano::find(ints, 0xFFFFFFFFu) == ints.begin());
+	CHECK(nano::find(ints, std::int64_t{0xFFFFFFFF}) == ints.end());
+	std::vector<unsigned> uints(100, std::numeric_limits<unsigned>::max());
+	CHECK(nano::find(uints, -1) == uints.begin());
+
+	// Floating point values compare by value, not by representation
+	std::vector<double> dbl(100, 1.0);
+	dbl[50] = -0.0;
+	dbl[60] = std::numeric_limits<double>::quiet_NaN();
+	CHECK(nano::find(dbl, 0.0) == dbl.begin() + 50);
+	CHECK(nano::find(dbl, std::numeric_limits<double>::quiet_NaN()) == dbl.end());
+
+	const std::string str = "the quick brown fox jumps over the lazy dog";
+	CHECK(nano::find(str, 'z') == str.begin() + 37);
+	CHECK(nano::find(str.begin(), str.end(), '!') == str.end());
+}
@@ -11,6 +11,9 @@
 
 #include <nanorange/algorithm/for_each.hpp>
 #include <nanorange/views/subrange.hpp>
+#include <atomic>
+#include <numeric>
+#include <stdexcept>
 #include <vector>
 #include "../catch.hpp"
 #include "../test_utils.hpp"
@@ -75,3 +78,60 @@ TEST_CASE("alg.for_each")
 	stl2::for_each(matrix, [](int(&)[4]){});
 #endif
 }
+
+TEST_CASE("alg.for_each.par")
+{
+	stl2::thread_pool pool(4);
+	// A small grain size, so that the ranges are split into many chunks
+	const auto policy = stl2::par.on(pool).with_grain_size(1000);
+
+	const int size = 100'003;
+	std::vector<int> v(size, 0);
+
+	// Every element is visited once, wherever the range starts relative to
+	// a cache line
+	for (int offset : {0, 1, 3}) {
+		auto res = stl2::for_each(policy, v.begin() + offset, v.end(),
+		                          [](int& i) { ++i; });
+		CHECK(res.in == v.end());
+	}
+	bool ok = true;
+	for (int i = 0; i < size; ++i) {
+		ok = ok && v[i] == 1 + (i >= 1) + (i >= 3);
+	}
+	CHECK(ok);
+
+	std::iota(v.begin(), v.end(), 0);
+	std::atomic<long long> sum{0};
+	auto add = [&sum](int i) { sum += i; };
+	CHECK(stl2::for_each(policy, v, add).in == v.end());
+	CHECK(sum == (long long)size * (size - 1) / 2);
+
+	// Projections, and the sequential and default pool policies
+	struct S { int i; };
+	std::vector<S> s(size, S{2});
+	sum = 0;
+	stl2::for_each(stl2::seq, s, add, &S::i);
+	stl2::for_each(stl2::par, s.begin(), s.end(), add, &S::i);
+	CHECK(sum == 4LL * size);
+
+	// Exceptions thrown by the function reach the caller
+	CHECK_THROWS_AS(stl2::for_each(policy, v, [](int i) {
+		if (i == 50'000) {
+			throw std::runtime_error("for_each");
+		}
+	}), std::runtime_error);
+
+	// Small ranges which end before the first cache line boundary
+	alignas(64) int small[32];
+	const auto tiny = stl2::par.on(pool).with_grain_size(1);
+	for (int offset : {1, 5, 15}) {
+		for (int n : {0, 1, 8, 14, 15, 16, 17}) {
+			std::fill(std::begin(small), std::end(small), 0);
+			auto res = stl2::for_each(tiny, small + offset, small + offset + n,
+			                          [](int& i) { ++i; });
+			CHECK(res.in == small + offset + n);
+			CHECK(std::count(std::begin(small), std::end(small), 1) == n);
+		}
+	}
+}
@@ -22,6 +22,8 @@
 #include <nanorange/iterator/counted_iterator.hpp>
 #include <nanorange/iterator/back_insert_iterator.hpp>
 #include <vector>
+#include <algorithm>
+#include <atomic>
 #include "../catch.hpp"
 #include "../test_iterators.hpp"
 #include "../test_utils.hpp"
@@ -102,3 +104,43 @@ TEST_CASE("alg.generate")
 
 	test2();
 }
+
+TEST_CASE("alg.generate.par")
+{
+	stl2::thread_pool pool(4);
+	const auto policy = stl2::par.on(pool).with_grain_size(1000);
+
+	const int size = 100'003;
+	std::vector<int> v(size, 0);
+
+	// The generator is called once per element, from several threads
+	std::atomic<int> calls{0};
+	auto gen = [&calls] { return ++calls; };
+	CHECK(stl2::generate(policy, v.begin() + 1, v.end(), gen) == v.end());
+	CHECK(calls == size - 1);
+	CHECK(v[0] == 0);
+	std::sort(v.begin() + 1, v.end());
+	bool ok = true;
+	for (int i = 1; i < size; ++i) {
+		ok = ok && v[i] == i;
+	}
+	CHECK(ok);
+
+	CHECK(stl2::generate(stl2::par, v, [] { return 3; }) == v.end());
+	CHECK(std::count(v.begin(), v.end(), 3) == size);
+
+	CHECK(stl2::generate(stl2::seq, v.begin(), v.end(), [] { return 4; }) == v.end());
+	CHECK(std::count(v.begin(), v.end(), 4) == size);
+
+	// Small ranges which end before the first cache line boundary
+	alignas(64) int small[32];
+	const auto tiny = stl2::par.on(pool).with_grain_size(1);
+	for (int offset : {1, 5, 15}) {
+		for (int n : {0, 1, 8, 14, 15, 16, 17}) {
+			std::fill(std::begin(small), std::end(small), 0);
+			CHECK(stl2::generate(tiny, small + offset, small + offset + n,
+			                     [] { return 1; }) == small + offset + n);
+			CHECK(std::count(std::begin(small), std::end(small), 1) == n);
+		}
+	}
+}
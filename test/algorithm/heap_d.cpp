@@ -0,0 +1,177 @@
+// test/algorithm/heap_d.cpp
+//
+// Copyright (c) 2020 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <nanorange/algorithm/is_heap_d.hpp>
+#include <nanorange/algorithm/make_heap_d.hpp>
+#include <nanorange/algorithm/pop_heap_d.hpp>
+#include <nanorange/algorithm/push_heap_d.hpp>
+#include <nanorange/algorithm/sort_heap_d.hpp>
+
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "../catch.hpp"
+
+namespace {
+
+// Checks the heap property directly, rather than trusting is_heap_d
+template <std::size_t D, typename T, typename Comp = std::less<>>
+bool check_heap(const std::vector<T>& vec, Comp comp = Comp{})
+{
+	for (std::size_t c = 1; c < vec.size(); c++) {
+		if (comp(vec[(c - 1) / D], vec[c])) {
+			return false;
+		}
+	}
+	return true;
+}
+
+template <std::size_t D>
+void test_random()
+{
+	std::mt19937 gen{};
+
+	for (std::size_t size : {0u, 1u, 2u, 3u, 4u, 5u, 7u, 8u, 9u, 10u, 17u, 64u,
+	                         65u, 100u, 1000u, 4097u}) {
+		// Small value ranges give lots of duplicates
+		for (int max : {3, 1000000}) {
+			std::uniform_int_distribution<int> dist(0, max);
+			std::vector<int> vec(size);
+			std::generate(vec.begin(), vec.end(), [&] { return dist(gen); });
+			auto sorted = vec;
+			std::sort(sorted.begin(), sorted.end());
+
+			// make_heap_d
+			auto heap = vec;
+			CHECK(nano::make_heap_d<D>(heap) == heap.end());
+			REQUIRE(check_heap<D>(heap));
+			CHECK(nano::is_heap_d<D>(heap));
+			CHECK(nano::is_heap_d<D>(heap.begin(), heap.end()));
+
+			// pop_heap_d yields the elements from largest to smallest
+			for (auto it = heap.end(); it != heap.begin(); --it) {
+				CHECK(nano::pop_heap_d<D>(heap.begin(), it) == it);
+				REQUIRE(std::is_sorted(it - 1, heap.end()));
+				REQUIRE(check_heap<D>(std::vector<int>(heap.begin(), it - 1)));
+			}
+			CHECK(heap == sorted);
+
+			// push_heap_d, one element at a time
+			heap = vec;
+			for (auto it = heap.begin(); it != heap.end(); ++it) {
+				CHECK(nano::push_heap_d<D>(heap.begin(), it + 1) == it + 1);
+				REQUIRE(check_heap<D>(std::vector<int>(heap.begin(), it + 1)));
+			}
+
+			// sort_heap_d
+			CHECK(nano::sort_heap_d<D>(heap) == heap.end());
+			CHECK(heap == sorted);
+		}
+	}
+}
+
+struct S {
+	int i;
+};
+
+constexpr bool test_constexpr()
+{
+	std::array<int, 10> arr{5, 3, 9, 1, 0, 8, 2, 7, 4, 6};
+	nano::make_heap_d<3>(arr);
+	if (!nano::is_heap_d<3>(arr)) {
+		return false;
+	}
+	nano::sort_heap_d<3>(arr);
+	for (int i = 0; i < 10; i++) {
+		if (arr[static_cast<std::size_t>(i)] != i) {
+			return false;
+		}
+	}
+	return true;
+}
+
+}
+
+TEST_CASE("alg.heap_d.random")
+{
+	test_random<2>();
+	test_random<3>();
+	test_random<4>();
+	test_random<8>();
+	test_random<16>();
+}
+
+TEST_CASE("alg.heap_d.binary_is_std_heap")
+{
+	// The layout for D = 2 is the same as the standard binary heap
+	std::vector<int> vec(1000);
+	std::iota(vec.begin(), vec.end(), 0);
+	std::shuffle(vec.begin(), vec.end(), std::mt19937{});
+
+	nano::make_heap_d<2>(vec);
+	CHECK(std::is_heap(vec.begin(), vec.end()));
+	std::pop_heap(vec.begin(), vec.end());
+	CHECK(nano::is_heap_d<2>(vec.begin(), vec.end() - 1));
+}
+
+TEST_CASE("alg.heap_d.is_heap_d")
+{
+	// A 4-heap which is not a binary heap
+	const std::vector<int> vec{9, 1, 2, 3, 8};
+	CHECK(nano::is_heap_d<4>(vec));
+	CHECK(!nano::is_heap_d<2>(vec));
+	CHECK(!nano::is_heap_d<3>(vec));
+
+	const std::vector<int> empty;
+	CHECK(nano::is_heap_d<4>(empty));
+}
+
+TEST_CASE("alg.heap_d.comparator_and_projection")
+{
+	std::vector<S> vec;
+	for (int i = 0; i < 200; i++) {
+		vec.push_back(S{(i * 37) % 101});
+	}
+
+	nano::make_heap_d<4>(vec, std::greater<>{}, &S::i);
+	CHECK(nano::is_heap_d<4>(vec, std::greater<>{}, &S::i));
+	CHECK(!nano::is_heap_d<4>(vec, std::less<>{}, &S::i));
+
+	nano::pop_heap_d<4>(vec, std::greater<>{}, &S::i);
+	CHECK(vec.back().i == 0);
+	vec.back().i = -1;
+	nano::push_heap_d<4>(vec, std::greater<>{}, &S::i);
+	CHECK(vec.front().i == -1);
+
+	nano::sort_heap_d<4>(vec, std::greater<>{}, &S::i);
+	CHECK(std::is_sorted(vec.begin(), vec.end(),
+	                     [](S a, S b) { return a.i > b.i; }));
+}
+
+TEST_CASE("alg.heap_d.move_only")
+{
+	std::vector<std::unique_ptr<int>> vec;
+	for (int i = 0; i < 100; i++) {
+		vec.push_back(std::make_unique<int>((i * 13) % 100));
+	}
+	const auto comp = [](const auto& a, const auto& b) { return *a < *b; };
+
+	nano::make_heap_d<4>(vec, comp);
+	nano::sort_heap_d<4>(vec, comp);
+	for (int i = 0; i < 100; i++) {
+		REQUIRE(*vec[static_cast<std::size_t>(i)] == i);
+	}
+}
+
+TEST_CASE("alg.heap_d.constexpr")
+{
+	static_assert(test_constexpr());
+}
@@ -22,6 +22,8 @@
 #include <cassert>
 #include <algorithm>
 #include <random>
+#include <utility>
+#include <vector>
 #include "../catch.hpp"
 #include "../test_utils.hpp"
 #include "../test_iterators.hpp"
@@ -138,3 +140,45 @@ TEST_CASE("alg.inplace_merge")
 	test<random_access_iterator<int*> >();
 	test<int*>();
 }
+
+TEST_CASE("alg.inplace_merge.gallop")
+{
+	using P = std::pair<int, int>;
+	const auto by_key = [](const P& x, const P& y) { return x.first < y.first; };
+
+	// Keys are handed out in runs of up to max_run, each run going to one
+	// half or the other, and neighbouring runs may share a key
+	for (int max_run : {1, 3, 8, 100, 10000}) {
+		std::uniform_int_distribution<int> run_len(1, max_run);
+		std::bernoulli_distribution coin;
+		std::vector<P> left, right;
+		int key = 0;
+		while (left.size() + right.size() < 10000) {
+			auto& half = coin(gen) ? left : right;
+			for (int i = run_len(gen); i > 0; --i) {
+				half.emplace_back(key, int(left.size() + right.size()));
+				key += coin(gen);
+			}
+		}
+
+		std::vector<P> v = left;
+		v.insert(v.end(), right.begin(), right.end());
+		const auto split = static_cast<std::ptrdiff_t>(left.size());
+
+		auto expected = v;
+		std::inplace_merge(expected.begin(), expected.begin() + split,
+						   expected.end(), by_key);
+
+		auto v2 = v;
+		auto res = stl2::inplace_merge(v, v.begin() + split, stl2::less{},
+									   &P::first);
+		CHECK(res == v.end());
+		CHECK(v == expected);
+
+		stl2::inplace_merge(bidirectional_iterator<P*>(v2.data()),
+							bidirectional_iterator<P*>(v2.data() + split),
+							bidirectional_iterator<P*>(v2.data() + v2.size()),
+							stl2::less{}, &P::first);
+		CHECK(v2 == expected);
+	}
+}
@@ -19,6 +19,9 @@
 //===----------------------------------------------------------------------===//
 
 #include <nanorange/algorithm/lexicographical_compare.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <vector>
 #include "../catch.hpp"
 #include "../test_utils.hpp"
 #include "../test_iterators.hpp"
@@ -188,3 +191,66 @@ TEST_CASE("alg.lexicographical_compare")
 	test_iter();
 	test_iter_comp();
 }
+
+namespace {
+
+template <typename T>
+void test_lexicographical_compare_contiguous(std::size_t size)
+{
+	std::vector<T> a(size);
+	for (std::size_t i = 0; i < size; i++) {
+		a[i] = T(i * 7);
+	}
+	std::vector<T> b = a;
+	CHECK_FALSE(nano::lexicographical_compare(a, b));
+
+	for (std::size_t i : {std::size_t(0), size / 2, size - 1}) {
+		if (i >= size) {
+			continue;
+		}
+		b[i] = T(b[i] + 100);
+		CHECK(nano::lexicographical_compare(a, b) ==
+		      std::lexicographical_compare(a.begin(), a.end(),
+		                                   b.begin(), b.end()));
+		CHECK(nano::lexicographical_compare(b, a) ==
+		      std::lexicographical_compare(b.begin(), b.end(),
+		                                   a.begin(), a.end()));
+		b[i] = a[i];
+	}
+
+	// A proper prefix compares less
+	if (size > 0) {
+		b.pop_back();
+		CHECK(nano::lexicographical_compare(b, a));
+		CHECK_FALSE(nano::lexicographical_compare(a, b));
+	}
+}
+
+}
+
+TEST_CASE("alg.lexicographical_compare.contiguous")
+{
+	// Sizes either side of the vector widths, and large enough to take
+	// several iterations of the vectorised loop
+	for (std::size_t size : {0, 1, 15, 16, 17, 31, 32, 33, 1000, 4096}) {
+		test_lexicographical_compare_contiguous<unsigned char>(size);
+		test_lexicographical_compare_contiguous<signed char>(size);
+		test_lexicographical_compare_contiguous<char>(size);
+		test_lexicographical_compare_contiguous<std::int16_t>(size);
+		test_lexicographical_compare_contiguous<int>(size);
+		test_lexicographical_compare_contiguous<std::uint64_t>(size);
+	}
+
+	// Signed elements compare by value, not by their bytes
+	std::vector<int> neg{1, -1};
+	std::vector<int> pos{1, 1};
+	CHECK(nano::lexicographical_compare(neg, pos));
+	CHECK_FALSE(nano::lexicographical_compare(pos, neg));
+
+	std::vector<std::int16_t> wide1(40, 0);
+	std::vector<std::int16_t> wide2(40, 0);
+	wide1[20] = 0x0100;
+	wide2[20] = 0x00FF;
+	CHECK(nano::lexicographical_compare(wide2, wide1));
+	CHECK_FALSE(nano::lexicographical_compare(wide1, wide2));
+}
@@ -16,6 +16,8 @@
 #include <nanorange/algorithm/lower_bound.hpp>
 #include <nanorange/views/iota.hpp>
 #include <nanorange/views/subrange.hpp>
+#include <algorithm>
+#include <functional>
 #include <vector>
 #include <utility>
 #include "../catch.hpp"
@@ -77,3 +79,30 @@ TEST_CASE("alg.lower_bound")
 	//CHECK(*stl2::lower_bound(stl2::iota_view<int>{}, 42) == 42);
 	(void) stl2::lower_bound(stl2::iota_view<int>{}, 42);
 }
+
+TEST_CASE("alg.lower_bound.branchless")
+{
+	// Contiguous ranges of scalars are searched without branches; check
+	// every position in small ranges and a range big enough to prefetch
+	for (int n : {0, 1, 2, 3, 4, 5, 7, 8, 9, 15, 16, 17, 31, 100, 257, 100'000}) {
+		std::vector<int> v(n);
+		for (int i = 0; i < n; ++i) v[i] = 2 * (i / 2);
+		for (int key = -1; key <= 2 * n + 1; key += (n > 1000 ? 37 : 1)) {
+			CHECK(stl2::lower_bound(v, key) ==
+			      std::lower_bound(v.begin(), v.end(), key));
+		}
+
+		std::vector<long> desc(v.rbegin(), v.rend());
+		for (int key = -1; key <= 2 * n + 1; key += (n > 1000 ? 37 : 1)) {
+			CHECK(stl2::lower_bound(desc, key, std::greater<>{}) ==
+			      std::lower_bound(desc.begin(), desc.end(), key,
+			                       std::greater<>{}));
+		}
+	}
+
+	std::pair<int, int> a[] = {{0, 0}, {0, 1}, {1, 2}, {1, 3}, {3, 4}, {3, 5}};
+	for (int key = -1; key <= 4; ++key) {
+		CHECK(stl2::lower_bound(a, key, stl2::less{}, &std::pair<int, int>::first) ==
+		      std::lower_bound(a, a + 6, std::pair<int, int>{key, -1}));
+	}
+}
@@ -23,6 +23,8 @@
 #include <numeric>
 #include <random>
 #include <algorithm>
+#include <cstdint>
+#include <vector>
 #include "../catch.hpp"
 #include "../test_utils.hpp"
 #include "../test_iterators.hpp"
@@ -166,3 +168,59 @@ TEST_CASE("alg.max_element")
 	S const *ps = stl2::max_element(s, std::less<int>{}, &S::i);
 	CHECK(ps->i == 40);
 }
+
+namespace {
+
+template <typename T>
+void test_max_element_contiguous(std::size_t size, unsigned modulus)
+{
+	std::vector<T> vec(size);
+	for (std::size_t i = 0; i < size; i++) {
+		vec[i] = T((i * 7919) % modulus);
+	}
+	const auto it = nano::max_element(vec);
+	CHECK(it - vec.begin() == std::max_element(vec.begin(), vec.end()) - vec.begin());
+	if (size > 1) {
+		const T* p = nano::max_element(vec.data() + 1, vec.data() + size);
+		CHECK(p == &*std::max_element(vec.begin() + 1, vec.end()));
+	}
+}
+
+constexpr int constexpr_max_element()
+{
+	int arr[] = {3, 1, 4, 1, 5, 9, 2, 6, 5};
+	return static_cast<int>(nano::max_element(arr) - arr);
+}
+
+}
+
+TEST_CASE("alg.max_element.contiguous")
+{
+	static_assert(constexpr_max_element() == 5);
+
+	// Sizes either side of the vector widths, plus enough elements to need
+	// several runs of the per-lane index counters for the narrow types
+	for (std::size_t size : {0, 1, 15, 16, 17, 33, 1000, 70000}) {
+		for (unsigned modulus : {2u, 13u, 251u}) {
+			test_max_element_contiguous<std::uint8_t>(size, modulus);
+			test_max_element_contiguous<std::int8_t>(size, modulus);
+			test_max_element_contiguous<std::uint16_t>(size, modulus);
+			test_max_element_contiguous<std::int16_t>(size, modulus);
+			test_max_element_contiguous<unsigned>(size, modulus);
+			test_max_element_contiguous<int>(size, modulus);
+			test_max_element_contiguous<std::uint64_t>(size, modulus);
+			test_max_element_contiguous<std::int64_t>(size, modulus);
+			test_max_element_contiguous<float>(size, modulus);
+			test_max_element_contiguous<double>(size, modulus);
+		}
+	}
+	test_max_element_contiguous<std::int16_t>(1'100'000, 30011);
+
+	// Negative values, and extremes at either end
+	std::vector<int> vec{0, -5, 3, 7, -5, 7, 1, 2, 3, 4, 5, 6, 7, 8, -9};
+	CHECK(nano::max_element(vec) - vec.begin() == 13);
+	vec.resize(33, 8);
+	CHECK(nano::max_element(vec) - vec.begin() == 13);
+	vec.front() = 8;
+	CHECK(nano::max_element(vec) - vec.begin() == 0);
+}
@@ -16,7 +16,9 @@
 #include <nanorange/algorithm/merge.hpp>
 #include <algorithm>
 #include <memory>
+#include <random>
 #include <utility>
+#include <vector>
 #include "../catch.hpp"
 #include "../test_utils.hpp"
 
@@ -84,3 +86,98 @@ TEST_CASE("alg.merge")
 		CHECK(std::is_sorted(ic.get(), ic.get() + 2 * N));
 	}
 }
+
+namespace {
+
+using P = std::pair<int, int>;
+
+// Two sorted inputs whose elements are tagged with the input they came from.
+// Keys are drawn in runs of up to max_run from one input or the other, and
+// neighbouring runs may share a key, so a stable merge has to keep elements
+// with equal keys in order of input.
+std::pair<std::vector<P>, std::vector<P>> make_runs(int n, int max_run)
+{
+	std::mt19937 gen;
+	std::uniform_int_distribution<int> run_len(1, max_run);
+	std::bernoulli_distribution coin;
+	std::vector<P> a, b;
+	int key = 0;
+	while (static_cast<int>(a.size() + b.size()) < n) {
+		auto& v = coin(gen) ? a : b;
+		const int tag = &v == &a ? 0 : 1;
+		for (int i = run_len(gen); i > 0; --i) {
+			v.emplace_back(key, tag);
+			key += coin(gen);
+		}
+	}
+	return {a, b};
+}
+
+}
+
+TEST_CASE("alg.merge.gallop")
+{
+	for (int max_run : {1, 3, 8, 100, 10000}) {
+		const auto ab = make_runs(20000, max_run);
+		const auto& a = ab.first;
+		const auto& b = ab.second;
+
+		std::vector<P> expected(a.size() + b.size());
+		std::merge(a.begin(), a.end(), b.begin(), b.end(), expected.begin(),
+				   [](const P& x, const P& y) { return x.first < y.first; });
+
+		std::vector<P> out(a.size() + b.size());
+		auto r = stl2::merge(a, b, out.begin(), stl2::less{}, &P::first,
+							 &P::first);
+		CHECK(r.in1 == a.end());
+		CHECK(r.in2 == b.end());
+		CHECK(r.out == out.end());
+		CHECK(out == expected);
+
+		// And with the inputs the other way round
+		std::merge(b.begin(), b.end(), a.begin(), a.end(), expected.begin(),
+				   [](const P& x, const P& y) { return x.first < y.first; });
+		stl2::merge(b, a, out.begin(), stl2::less{}, &P::first, &P::first);
+		CHECK(out == expected);
+	}
+
+	// Disjoint inputs
+	{
+		std::vector<int> a(1000), b(1000), out(2000);
+		for (int i = 0; i < 1000; ++i) {
+			a[i] = i;
+			b[i] = 1000 + i;
+		}
+		stl2::merge(b, a, out.begin());
+		CHECK(std::is_sorted(out.begin(), out.end()));
+		CHECK(out.front() == 0);
+		CHECK(out.back() == 1999);
+	}
+
+	// Runs just long enough to start a gallop which then finds nothing: the
+	// gallop's comparison is reused, so the standard's bound still holds
+	{
+		std::vector<int> a, b;
+		for (int i = 0; i < 1000; ++i) {
+			for (int j = 0; j < 7; ++j) a.push_back(8 * i + j);
+			b.push_back(8 * i + 7);
+		}
+		const auto n = static_cast<long>(a.size() + b.size());
+
+		for (int swap = 0; swap < 2; ++swap) {
+			long calls = 0;
+			auto counting = [&calls](int x, int y) {
+				++calls;
+				return x < y;
+			};
+			std::vector<int> out(a.size() + b.size());
+			if (swap) {
+				stl2::merge(b, a, out.begin(), counting);
+			} else {
+				stl2::merge(a, b, out.begin(), counting);
+			}
+			CHECK(std::is_sorted(out.begin(), out.end()));
+			CHECK(calls <= n - 1);
+		}
+	}
+}
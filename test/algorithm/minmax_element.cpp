@@ -23,6 +23,8 @@
 #include <numeric>
 #include <random>
 #include <algorithm>
+#include <cstdint>
+#include <vector>
 #include "../catch.hpp"
 #include "../test_utils.hpp"
 #include "../test_iterators.hpp"
@@ -215,3 +217,61 @@ TEST_CASE("alg.minmax_element")
 	CHECK(ps.min->i == -4);
 	CHECK(ps.max->i == 40);
 }
+
+namespace {
+
+template <typename T>
+void test_minmax_element_contiguous(std::size_t size, unsigned modulus)
+{
+	std::vector<T> vec(size);
+	for (std::size_t i = 0; i < size; i++) {
+		vec[i] = T((i * 7919) % modulus);
+	}
+	const auto res = nano::minmax_element(vec);
+	const auto expected = std::minmax_element(vec.begin(), vec.end());
+	CHECK(res.min - vec.begin() == expected.first - vec.begin());
+	CHECK(res.max - vec.begin() == expected.second - vec.begin());
+}
+
+constexpr int constexpr_minmax_element()
+{
+	int arr[] = {3, 1, 4, 1, 5, 9, 2, 6, 5};
+	const auto res = nano::minmax_element(arr);
+	return static_cast<int>((res.min - arr) * 10 + (res.max - arr));
+}
+
+}
+
+TEST_CASE("alg.minmax_element.contiguous")
+{
+	static_assert(constexpr_minmax_element() == 15);
+
+	// Sizes either side of the vector widths, plus enough elements to need
+	// several runs of the per-lane index counters for the narrow types
+	for (std::size_t size : {0, 1, 15, 16, 17, 33, 1000, 70000}) {
+		for (unsigned modulus : {2u, 13u, 251u}) {
+			test_minmax_element_contiguous<std::uint8_t>(size, modulus);
+			test_minmax_element_contiguous<std::int8_t>(size, modulus);
+			test_minmax_element_contiguous<std::uint16_t>(size, modulus);
+			test_minmax_element_contiguous<std::int16_t>(size, modulus);
+			test_minmax_element_contiguous<unsigned>(size, modulus);
+			test_minmax_element_contiguous<int>(size, modulus);
+			test_minmax_element_contiguous<std::uint64_t>(size, modulus);
+			test_minmax_element_contiguous<std::int64_t>(size, modulus);
+			test_minmax_element_contiguous<float>(size, modulus);
+			test_minmax_element_contiguous<double>(size, modulus);
+		}
+	}
+	test_minmax_element_contiguous<std::int16_t>(1'100'000, 30011);
+
+	// Negative values, and extremes at either end
+	std::vector<int> vec{0, -5, 3, 7, -5, 7, 1, 2, 3, 4, 5, 6, 7, 8, -9};
+	auto res = nano::minmax_element(vec);
+	CHECK(res.min - vec.begin() == 14);
+	CHECK(res.max - vec.begin() == 13);
+	vec.resize(33, 8);
+	vec.push_back(-9);
+	res = nano::minmax_element(vec);
+	CHECK(res.min - vec.begin() == 14);
+	CHECK(res.max - vec.begin() == 32);
+}
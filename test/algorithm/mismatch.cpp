@@ -19,6 +19,8 @@
 //===----------------------------------------------------------------------===//
 
 #include <nanorange/algorithm/mismatch.hpp>
+#include <cstdint>
+#include <vector>
 #include <memory>
 #include <algorithm>
 #include "../catch.hpp"
@@ -162,3 +164,57 @@ TEST_CASE("alg.mismatch")
 		CHECK(ps2.in2->i == 5);
 	}
 }
+
+namespace {
+
+template <typename T>
+void test_mismatch_contiguous(std::size_t size)
+{
+	std::vector<T> a(size);
+	for (std::size_t i = 0; i < size; i++) {
+		a[i] = T(i * 7);
+	}
+	std::vector<T> b = a;
+	auto res = nano::mismatch(a, b);
+	CHECK(res.in1 == a.end());
+	CHECK(res.in2 == b.end());
+
+	for (std::size_t i : {std::size_t(0), size / 2, size - 1}) {
+		if (i >= size) {
+			continue;
+		}
+		b[i] = T(b[i] + 1);
+		res = nano::mismatch(a, b);
+		CHECK(res.in1 - a.begin() == std::ptrdiff_t(i));
+		CHECK(res.in2 - b.begin() == std::ptrdiff_t(i));
+		b[i] = a[i];
+	}
+
+	// The shorter range bounds the comparison
+	if (size > 0) {
+		b.pop_back();
+		res = nano::mismatch(a, b);
+		CHECK(res.in1 == a.end() - 1);
+		CHECK(res.in2 == b.end());
+		const auto res2 = nano::mismatch(b, a);
+		CHECK(res2.in1 == b.end());
+		CHECK(res2.in2 == a.end() - 1);
+	}
+}
+
+}
+
+TEST_CASE("alg.mismatch.contiguous")
+{
+	// Sizes either side of the vector widths, and large enough to take
+	// several iterations of the vectorised loop
+	for (std::size_t size : {0, 1, 15, 16, 17, 31, 32, 33, 1000, 4096}) {
+		test_mismatch_contiguous<unsigned char>(size);
+		test_mismatch_contiguous<signed char>(size);
+		test_mismatch_contiguous<char>(size);
+		test_mismatch_contiguous<std::int16_t>(size);
+		test_mismatch_contiguous<int>(size);
+		test_mismatch_contiguous<std::uint64_t>(size);
+	}
+
+}
@@ -21,6 +21,7 @@
 #include <nanorange/algorithm/move.hpp>
 #include <memory>
 #include <algorithm>
+#include <vector>
 #include "../catch.hpp"
 #include "../test_iterators.hpp"
 #include "../test_utils.hpp"
@@ -238,3 +239,26 @@ TEST_CASE("alg.move")
 	test1<random_access_iterator<std::unique_ptr<int>*>, bidirectional_iterator<std::unique_ptr<int>*>, sentinel<std::unique_ptr<int>*> >();
 	test1<random_access_iterator<std::unique_ptr<int>*>, random_access_iterator<std::unique_ptr<int>*>, sentinel<std::unique_ptr<int>*> >();
 }
+
+TEST_CASE("alg.move.contiguous")
+{
+	std::vector<int> vec{1, 2, 3, 4, 5, 6};
+	auto res = stl2::move(vec.begin() + 2, vec.end(), vec.begin());
+	CHECK(res.in == vec.end());
+	CHECK(res.out == vec.begin() + 4);
+	CHECK(vec == std::vector<int>{3, 4, 5, 6, 5, 6});
+
+	vec = {1, 2, 3, 4, 5, 6};
+	auto res2 = stl2::move_backward(vec.begin(), vec.begin() + 4, vec.end());
+	CHECK(res2.in == vec.begin() + 4);
+	CHECK(res2.out == vec.begin() + 2);
+	CHECK(vec == std::vector<int>{1, 2, 1, 2, 3, 4});
+
+	// Volatile elements are moved one at a time, not with memmove
+	static_assert(!stl2::detail::is_memmove_assignable<volatile int*, volatile int*, int*, true>);
+	volatile int vin[] = {1, 2, 3};
+	int out[3] = {};
+	stl2::move(vin, out);
+	CHECK(out[0] == 1);
+	CHECK(out[2] == 3);
+}
@@ -19,9 +19,13 @@
 //===----------------------------------------------------------------------===//
 
 #include <nanorange/algorithm/nth_element.hpp>
+#include <atomic>
 #include <cassert>
 #include <memory>
 #include <random>
+#include <stdexcept>
+#include <thread>
+#include <vector>
 #include <algorithm>
 #include "../catch.hpp"
 #include "../test_utils.hpp"
@@ -73,6 +77,44 @@ struct S
 	int i,j;
 };
 
+// Checks that v has been partitioned around the element that belongs at m
+template <typename Comp = std::less<>>
+void check_nth(const std::vector<int>& v, std::vector<int> expected,
+               std::size_t m, Comp comp = Comp{})
+{
+	std::sort(expected.begin(), expected.end(), comp);
+	CHECK(v[m] == expected[m]);
+	CHECK(std::none_of(v.begin(), v.begin() + m,
+	                   [&](int i) { return comp(v[m], i); }));
+	CHECK(std::none_of(v.begin() + m + 1, v.end(),
+	                   [&](int i) { return comp(i, v[m]); }));
+}
+
+// Inputs which defeat simple pivot choices, or are full of duplicates
+std::vector<std::vector<int>> patterns(int n)
+{
+	std::vector<std::vector<int>> out;
+	std::vector<int> v(n);
+	for (int i = 0; i < n; ++i) v[i] = i;
+	out.push_back(v);
+	for (int i = 0; i < n; ++i) v[i] = n - i;
+	out.push_back(v);
+	for (int i = 0; i < n; ++i) v[i] = 7;
+	out.push_back(v);
+	for (int i = 0; i < n; ++i) v[i] = i % 5;
+	out.push_back(v);
+	for (int i = 0; i < n; ++i) v[i] = i < n / 2 ? i : n - i;
+	out.push_back(v);
+	for (int i = 0; i < n; ++i) v[i] = (i * 31) % 97;
+	out.push_back(v);
+	for (int i = 0; i < n; ++i) v[i] = (i % 2) ? i : n + i;
+	out.push_back(v);
+	std::uniform_int_distribution<int> dist(0, n);
+	for (auto& i : v) i = dist(gen);
+	out.push_back(v);
+	return out;
+}
+
 }
 
 TEST_CASE("alg.nth_element")
@@ -99,3 +141,125 @@ TEST_CASE("alg.nth_element")
 	CHECK(ia[M].i == M);
 	CHECK(ia[M].j == M);
 }
+
+TEST_CASE("alg.nth_element.patterns")
+{
+	for (int n : {30, 129, 1000, 5000}) {
+		for (const auto& input : patterns(n)) {
+			for (std::size_t m : {std::size_t{0}, std::size_t(n / 3),
+			                      std::size_t(n / 2), std::size_t(n - 1)}) {
+				auto v = input;
+				stl2::nth_element(v, v.begin() + m);
+				check_nth(v, input, m);
+
+				v = input;
+				stl2::nth_element(v.begin(), v.begin() + m, v.end(),
+				                  stl2::greater{});
+				check_nth(v, input, m, std::greater<>{});
+			}
+		}
+	}
+}
+
+TEST_CASE("alg.nth_element.median_of_medians")
+{
+	// The worst-case fallback, called directly
+	for (int n : {1, 24, 25, 100, 1000, 4321}) {
+		for (const auto& input : patterns(n)) {
+			for (std::size_t m : {std::size_t{0}, std::size_t(n / 2),
+			                      std::size_t(n - 1)}) {
+				auto v = input;
+				auto comp = stl2::less{};
+				auto proj = stl2::identity{};
+				stl2::detail::median_of_medians_select(
+				    v.begin(), v.begin() + m, v.end(), comp, proj);
+				check_nth(v, input, m);
+			}
+		}
+	}
+}
+
+TEST_CASE("alg.nth_element.par")
+{
+	stl2::thread_pool pool(4);
+	const auto policy = stl2::par.on(pool);
+
+	// Large enough to be partitioned in parallel
+	const int size = 500'000;
+	for (const auto& input : patterns(size)) {
+		for (std::size_t m : {std::size_t{0}, std::size_t(size / 100),
+		                      std::size_t(size / 2),
+		                      std::size_t(size * 99 / 100),
+		                      std::size_t(size - 1)}) {
+			auto v = input;
+			CHECK(stl2::nth_element(policy, v, v.begin() + m) == v.end());
+			check_nth(v, input, m);
+		}
+	}
+
+	std::vector<int> v(size);
+	std::uniform_int_distribution<int> dist(0, size);
+	for (auto& i : v) i = dist(gen);
+	auto input = v;
+	CHECK(stl2::nth_element(policy, v.begin(), v.begin() + 1234, v.end(),
+	                        stl2::greater{}) == v.end());
+	check_nth(v, input, 1234, std::greater<>{});
+
+	// Sequential and default pool policies
+	v = input;
+	stl2::nth_element(stl2::seq, v, v.begin() + size / 2);
+	check_nth(v, input, size / 2);
+	v = input;
+	stl2::nth_element(stl2::par, v, v.begin() + size / 2);
+	check_nth(v, input, size / 2);
+	v = input;
+	CHECK(stl2::nth_element(policy, v, v.end()) == v.end());
+	CHECK(v == input);
+
+	// Projections
+	{
+		std::vector<S> ss(size);
+		for (int i = 0; i < size; ++i) ss[i] = S{size - i - 1, i};
+		std::shuffle(ss.begin(), ss.end(), gen);
+		stl2::nth_element(policy, ss, ss.begin() + 777, std::less<int>{},
+		                  &S::i);
+		CHECK(ss[777].i == 777);
+		CHECK(ss[777].j == size - 778);
+	}
+
+	// The grain size is the least work for one task, so one larger than the
+	// input keeps it all on this thread, and a small one still works
+	{
+		v = input;
+		const auto self = std::this_thread::get_id();
+		std::atomic<int> elsewhere{0};
+		auto same_thread = [&](int a, int b) {
+			if (std::this_thread::get_id() != self) ++elsewhere;
+			return a < b;
+		};
+		stl2::nth_element(policy.with_grain_size(size), v, v.begin() + 4321,
+		                  same_thread);
+		check_nth(v, input, 4321);
+		CHECK(elsewhere.load() == 0);
+
+		for (std::size_t grain : {1u, 1000u}) {
+			v = input;
+			stl2::nth_element(policy.with_grain_size(grain), v,
+			                  v.begin() + size / 3);
+			check_nth(v, input, size / 3);
+		}
+	}
+
+	// Exceptions thrown by the comparator reach the caller
+	{
+		v = input;
+		std::atomic<int> calls{0};
+		auto throwing = [&calls](int a, int b) {
+			if (++calls == 300'000) throw std::runtime_error("comparison");
+			return a < b;
+		};
+		CHECK_THROWS_AS(stl2::nth_element(policy, v, v.begin() + 10,
+		                                  throwing),
+		                std::runtime_error);
+	}
+}
@@ -23,8 +23,13 @@
 //===----------------------------------------------------------------------===//
 
 #include <nanorange/algorithm/partition.hpp>
+#include <algorithm>
+#include <atomic>
 #include <memory>
+#include <random>
+#include <stdexcept>
 #include <utility>
+#include <vector>
 #include "../catch.hpp"
 #include "../test_utils.hpp"
 #include "../test_iterators.hpp"
@@ -230,3 +235,59 @@ TEST_CASE("alg.partition")
 	for (S* i = r2; i < ia+sa; ++i)
 		CHECK(!is_odd()(i->i));
 }
+
+TEST_CASE("alg.partition.par")
+{
+	stl2::thread_pool pool(4);
+	std::mt19937 gen;
+
+	for (std::size_t size : {0, 1, 1000, 100'000}) {
+		for (int odds_in_ten : {0, 1, 5, 10}) {
+			std::vector<int> input(size);
+			for (auto& i : input) {
+				i = static_cast<int>(gen() % 1000) * 2 +
+				    (static_cast<int>(gen() % 10) < odds_in_ten);
+			}
+			auto sorted = input;
+			std::sort(sorted.begin(), sorted.end());
+			const auto num_odd = std::count_if(input.begin(), input.end(),
+			                                   is_odd());
+
+			for (const auto policy : {stl2::par.on(pool),
+			                          stl2::par.on(pool).with_grain_size(1000),
+			                          stl2::par}) {
+				auto v = input;
+				const auto r = stl2::partition(policy, v, is_odd());
+				CHECK(r.begin() == v.begin() + num_odd);
+				CHECK(r.end() == v.end());
+				CHECK(std::is_partitioned(v.begin(), v.end(), is_odd()));
+				std::sort(v.begin(), v.end());
+				CHECK(v == sorted);
+			}
+		}
+	}
+
+	// Iterators, sentinels and projections
+	std::vector<S> ss(50'000);
+	for (int i = 0; i < 50'000; ++i) {
+		ss[static_cast<std::size_t>(i)].i = i;
+	}
+	auto r = stl2::partition(stl2::par.on(pool).with_grain_size(100),
+	                         ss.begin(), ss.end(), is_odd(), &S::i);
+	CHECK(r.begin() == ss.begin() + 25'000);
+	CHECK(std::all_of(ss.begin(), r.begin(),
+	                  [](const S& s) { return s.i & 1; }));
+	CHECK(std::none_of(r.begin(), ss.end(),
+	                   [](const S& s) { return s.i & 1; }));
+
+	// Exceptions thrown by the predicate reach the caller
+	std::vector<int> v(100'000, 1);
+	std::atomic<int> calls{0};
+	auto throwing = [&calls](int i) {
+		if (++calls == 50'000) throw std::runtime_error("predicate");
+		return i == 1;
+	};
+	CHECK_THROWS_AS(stl2::partition(stl2::par.on(pool).with_grain_size(1000),
+	                                v, throwing),
+	                std::runtime_error);
+}
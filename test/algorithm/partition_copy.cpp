@@ -24,7 +24,10 @@
 
 #include <nanorange/algorithm/partition_copy.hpp>
 //#include <stl2/iterator.hpp>
+#include <algorithm>
+#include <random>
 #include <tuple>
+#include <vector>
 #include "../catch.hpp"
 #include "../test_utils.hpp"
 #include "../test_iterators.hpp"
@@ -144,3 +147,64 @@ TEST_CASE("alg.partition_copy")
 	test_proj();
 	test_rvalue();
 }
+
+TEST_CASE("alg.partition_copy.par")
+{
+	stl2::thread_pool pool(4);
+	std::mt19937 gen;
+	const auto is_odd = [](int i) { return (i & 1) != 0; };
+
+	for (std::size_t size : {0, 1, 1000, 100'000}) {
+		for (int odds_in_ten : {0, 1, 5, 10}) {
+			std::vector<int> input(size);
+			for (std::size_t i = 0; i < size; ++i) {
+				input[i] = static_cast<int>(i) * 2 +
+				           (static_cast<int>(gen() % 10) < odds_in_ten);
+			}
+			std::vector<int> expected_true(size);
+			std::vector<int> expected_false(size);
+			const auto ends = std::partition_copy(
+			    input.begin(), input.end(), expected_true.begin(),
+			    expected_false.begin(), is_odd);
+
+			for (const auto policy : {stl2::par.on(pool),
+			                          stl2::par.on(pool).with_grain_size(1000),
+			                          stl2::par}) {
+				std::vector<int> out_true(size, -1);
+				std::vector<int> out_false(size, -1);
+				const auto r = stl2::partition_copy(policy, input,
+				                                    out_true.begin(),
+				                                    out_false.begin(), is_odd);
+				CHECK(r.in == input.end());
+				CHECK(r.out1 - out_true.begin() ==
+				      ends.first - expected_true.begin());
+				CHECK(r.out2 - out_false.begin() ==
+				      ends.second - expected_false.begin());
+				std::fill(ends.first, expected_true.end(), -1);
+				std::fill(ends.second, expected_false.end(), -1);
+				CHECK(out_true == expected_true);
+				CHECK(out_false == expected_false);
+			}
+		}
+	}
+
+	// Iterators, sentinels and projections
+	std::vector<S> ss(50'000);
+	for (int i = 0; i < 50'000; ++i) {
+		ss[static_cast<std::size_t>(i)].i = i;
+	}
+	std::vector<S> odd(25'000);
+	std::vector<S> even(25'000);
+	const auto r = stl2::partition_copy(
+	    stl2::par.on(pool).with_grain_size(100), ss.cbegin(), ss.cend(),
+	    odd.begin(), even.begin(), is_odd, &S::i);
+	CHECK(r.in == ss.cend());
+	CHECK(r.out1 == odd.end());
+	CHECK(r.out2 == even.end());
+	bool in_order = true;
+	for (int i = 0; i < 25'000; ++i) {
+		in_order &= odd[static_cast<std::size_t>(i)].i == 2 * i + 1;
+		in_order &= even[static_cast<std::size_t>(i)].i == 2 * i;
+	}
+	CHECK(in_order);
+}
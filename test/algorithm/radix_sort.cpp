@@ -0,0 +1,140 @@
+// test/algorithm/radix_sort.cpp
+//
+// Copyright (c) 2020 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <nanorange/algorithm/radix_sort.hpp>
+#include <nanorange/algorithm/count.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <list>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../catch.hpp"
+#include "../test_utils.hpp"
+
+namespace {
+
+std::mt19937 gen;
+
+template <typename T>
+std::vector<T> random_vector(std::size_t size)
+{
+    std::vector<T> vec(size);
+    if constexpr (std::is_floating_point<T>::value) {
+        std::uniform_real_distribution<T> dist(-1000, 1000);
+        for (auto& t : vec) t = dist(gen);
+    } else {
+        using D = std::conditional_t<sizeof(T) == 1, int, T>;
+        std::uniform_int_distribution<D> dist(std::numeric_limits<T>::min(),
+                                              std::numeric_limits<T>::max());
+        for (auto& t : vec) t = static_cast<T>(dist(gen));
+    }
+    return vec;
+}
+
+template <typename T>
+void test_radix_sort(std::size_t size)
+{
+    auto vec = random_vector<T>(size);
+
+    auto expected = vec;
+    std::stable_sort(expected.begin(), expected.end());
+    CHECK(nano::radix_sort(vec) == vec.end());
+    CHECK(vec == expected);
+
+    std::stable_sort(expected.begin(), expected.end(), std::greater<>{});
+    CHECK(nano::radix_sort(vec.begin(), vec.end(), nano::greater{}) == vec.end());
+    CHECK(vec == expected);
+}
+
+struct record {
+    double key;
+    int index;
+};
+
+template <typename Rng, typename Comp>
+constexpr bool can_radix_sort =
+    nano::detail::exists_v<nano::invoke_result_t, nano::detail::radix_sort_fn,
+                           Rng, Comp>;
+
+}
+
+TEST_CASE("alg.radix_sort")
+{
+    for (std::size_t size : {0, 1, 10, 63, 64, 1000, 100'000}) {
+        test_radix_sort<std::uint8_t>(size);
+        test_radix_sort<std::int16_t>(size);
+        test_radix_sort<unsigned>(size);
+        test_radix_sort<int>(size);
+        test_radix_sort<std::uint64_t>(size);
+        test_radix_sort<std::int64_t>(size);
+        test_radix_sort<float>(size);
+        test_radix_sort<double>(size);
+    }
+
+    SECTION("special floating point values") {
+        constexpr double inf = std::numeric_limits<double>::infinity();
+        std::vector<double> vec(1000);
+        for (std::size_t i = 0; i < vec.size(); i++) {
+            const double values[] = {inf, -inf, 0.0, -0.0, 1e-310, -1e-310, 1.0};
+            vec[i] = values[i % 7];
+        }
+        nano::radix_sort(vec);
+        CHECK(std::is_sorted(vec.begin(), vec.end()));
+    }
+
+    SECTION("with a projection, sort is stable") {
+        std::vector<record> vec(10'000);
+        std::uniform_int_distribution<int> dist(-50, 50);
+        for (int i = 0; i < 10'000; i++) {
+            // Include both signs of zero, which compare equal
+            const int k = dist(gen);
+            vec[i] = {k == 0 && i % 2 ? -0.0 : double(k), i};
+        }
+
+        auto expected = vec;
+        std::stable_sort(expected.begin(), expected.end(),
+                         [](const record& a, const record& b) {
+                             return a.key < b.key;
+                         });
+
+        nano::radix_sort(vec, std::less<double>{}, &record::key);
+        for (std::size_t i = 0; i < vec.size(); i++) {
+            CHECK(vec[i].index == expected[i].index);
+        }
+    }
+
+    SECTION("move-only types") {
+        std::vector<std::unique_ptr<int>> vec;
+        for (int i = 0; i < 1000; i++) {
+            vec.push_back(std::make_unique<int>(999 - i));
+        }
+        nano::radix_sort(vec, nano::less{}, [](const auto& p) { return *p; });
+        for (int i = 0; i < 1000; i++) {
+            CHECK(*vec[i] == i);
+        }
+    }
+
+    SECTION("all keys equal") {
+        std::vector<int> vec(1000, 42);
+        nano::radix_sort(vec);
+        CHECK(nano::count(vec, 42) == 1000);
+    }
+
+    SECTION("constraints") {
+        static_assert(can_radix_sort<std::vector<int>&, nano::less>);
+        static_assert(can_radix_sort<std::vector<int>&, std::greater<int>>);
+        static_assert(can_radix_sort<std::vector<float>&, std::less<>>);
+        static_assert(!can_radix_sort<std::vector<int>&, std::less<long>>);
+        static_assert(!can_radix_sort<std::vector<int>&, nano::less_equal>);
+        static_assert(!can_radix_sort<std::vector<std::string>&, nano::less>);
+        static_assert(!can_radix_sort<std::list<int>&, nano::less>);
+    }
+}
@@ -0,0 +1,244 @@
+// test/algorithm/searchers.cpp
+//
+// Copyright (c) 2020 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <nanorange/algorithm/search.hpp>
+#include <nanorange/algorithm/searchers.hpp>
+
+#include <algorithm>
+#include <cctype>
+#include <cstddef>
+#include <list>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../catch.hpp"
+#include "../test_iterators.hpp"
+
+namespace {
+
+// Checks that searcher s finds the same match as std::search for every
+// suffix of the haystack
+template <typename Searcher, typename Hay, typename Pat>
+void check_against_std(const Searcher& s, const Hay& hay, const Pat& pat)
+{
+	for (std::size_t i = 0; i <= hay.size(); i += 1 + hay.size() / 16) {
+		const auto first = hay.begin() + static_cast<std::ptrdiff_t>(i);
+		const auto expected = std::search(first, hay.end(),
+		                                  pat.begin(), pat.end());
+		const auto result = s(first, hay.end());
+		REQUIRE(result.begin() == expected);
+		if (expected == hay.end()) {
+			REQUIRE(result.empty());
+		} else {
+			REQUIRE(result.end() == expected + static_cast<std::ptrdiff_t>(pat.size()));
+		}
+	}
+}
+
+template <typename T>
+std::vector<T> random_seq(std::mt19937& gen, std::size_t n, int alphabet)
+{
+	std::uniform_int_distribution<int> dist(0, alphabet - 1);
+	std::vector<T> vec(n);
+	std::generate(vec.begin(), vec.end(), [&] { return T('a' + dist(gen)); });
+	return vec;
+}
+
+template <typename T>
+void test_random()
+{
+	std::mt19937 gen{};
+	for (int alphabet : {1, 2, 4, 26}) {
+		for (std::size_t m : {1u, 2u, 3u, 5u, 8u, 17u, 64u, 300u}) {
+			for (int trial = 0; trial < 4; trial++) {
+				const auto hay = random_seq<T>(gen, 1000, alphabet);
+				// Take the pattern from the haystack half the time, so that
+				// we find matches as well as rejecting them
+				auto pat = random_seq<T>(gen, m, alphabet);
+				if (trial % 2 == 0) {
+					const auto off = std::uniform_int_distribution<std::size_t>(
+						0, hay.size() - m)(gen);
+					std::copy_n(hay.begin() + off, m, pat.begin());
+				}
+
+				check_against_std(nano::naive_searcher{pat}, hay, pat);
+				check_against_std(nano::boyer_moore_horspool_searcher{pat}, hay, pat);
+				check_against_std(nano::two_way_searcher{pat}, hay, pat);
+				check_against_std(nano::default_searcher{pat}, hay, pat);
+
+				const auto r = nano::search(hay, pat);
+				REQUIRE(r.begin() == std::search(hay.begin(), hay.end(),
+				                                 pat.begin(), pat.end()));
+			}
+		}
+	}
+}
+
+// Periodic patterns are the worst cases for the naive and BMH algorithms
+// and exercise the "memory" part of the two-way algorithm
+void test_periodic()
+{
+	const std::string hay = std::string(500, 'a') + "b" + std::string(500, 'a') +
+	                        "abaabaab" + std::string(100, 'a');
+	for (std::string pat : {"aaaa", "aab", "baa", "abaabaab", "aaaaaaaaab",
+	                        "abababab", "aabaab", "baaaaaaaaa"}) {
+		check_against_std(nano::naive_searcher{pat}, hay, pat);
+		check_against_std(nano::boyer_moore_horspool_searcher{pat}, hay, pat);
+		check_against_std(nano::two_way_searcher{pat}, hay, pat);
+		check_against_std(nano::default_searcher{pat}, hay, pat);
+	}
+}
+
+struct case_insensitive_eq {
+	bool operator()(char a, char b) const
+	{
+		return std::tolower(static_cast<unsigned char>(a)) ==
+		       std::tolower(static_cast<unsigned char>(b));
+	}
+};
+
+struct case_insensitive_hash {
+	std::size_t operator()(char c) const
+	{
+		return std::hash<int>{}(std::tolower(static_cast<unsigned char>(c)));
+	}
+};
+
+constexpr bool test_constexpr()
+{
+	constexpr std::string_view hay = "the quick brown fox jumps over the lazy dog";
+	constexpr std::string_view pat = "lazy";
+
+	const auto r1 = nano::search(hay, nano::boyer_moore_horspool_searcher{pat});
+	const auto r2 = nano::search(hay, nano::two_way_searcher{pat});
+	const auto r3 = nano::search(hay, nano::naive_searcher{pat});
+
+	return r1.begin() == hay.begin() + 35 && r1.size() == 4 &&
+	       r2.begin() == r1.begin() && r2.end() == r1.end() &&
+	       r3.begin() == r1.begin() && r3.end() == r1.end();
+}
+
+}
+
+TEST_CASE("alg.searchers.basic")
+{
+	const std::string hay = "how much wood would a woodchuck chuck";
+
+	const auto check = [&](const auto& s) {
+		auto r = s(hay.begin(), hay.end());
+		CHECK(r.begin() == hay.begin() + 9);
+		CHECK(r.end() == hay.begin() + 13);
+
+		r = nano::search(hay.begin() + 10, hay.end(), s);
+		CHECK(r.begin() == hay.begin() + 22);
+
+		r = nano::search(hay, s);
+		CHECK(r.begin() == hay.begin() + 9);
+	};
+
+	const std::string pat = "wood";
+	check(nano::naive_searcher{pat});
+	check(nano::boyer_moore_horspool_searcher{pat});
+	check(nano::two_way_searcher{pat});
+	check(nano::default_searcher{pat});
+
+	// Searchers can own their pattern
+	check(nano::boyer_moore_horspool_searcher{std::string_view("wood")});
+
+	// Not found
+	{
+		const nano::two_way_searcher s{std::string_view("woodpecker")};
+		const auto r = nano::search(hay, s);
+		CHECK(r.begin() == hay.end());
+		CHECK(r.empty());
+	}
+
+	// Empty pattern matches at the start
+	{
+		const nano::boyer_moore_horspool_searcher s{std::string_view{}};
+		const auto r = s(hay.begin(), hay.end());
+		CHECK(r.begin() == hay.begin());
+		CHECK(r.empty());
+		const auto r2 = nano::two_way_searcher{std::string_view{}}(hay.begin(), hay.end());
+		CHECK(r2.begin() == hay.begin());
+		CHECK(r2.empty());
+	}
+
+	// Pattern longer than the haystack
+	{
+		const std::string_view small = "woo";
+		const auto r = nano::boyer_moore_horspool_searcher{pat}(small.begin(), small.end());
+		CHECK(r.begin() == small.end());
+		const auto r2 = nano::two_way_searcher{pat}(small.begin(), small.end());
+		CHECK(r2.begin() == small.end());
+	}
+
+	// Rvalue haystacks give dangling
+	{
+		auto r = nano::search(std::string(hay), nano::two_way_searcher{pat});
+		static_assert(nano::same_as<decltype(r), nano::dangling>);
+	}
+}
+
+TEST_CASE("alg.searchers.custom_predicate")
+{
+	const std::string hay = "Now Is The Winter Of Our Discontent";
+	const std::string pat = "winter of";
+
+	const nano::naive_searcher naive{pat, case_insensitive_eq{}};
+	auto r = nano::search(hay, naive);
+	CHECK(r.begin() == hay.begin() + 11);
+	CHECK(r.size() == 9);
+
+	const nano::boyer_moore_horspool_searcher bmh{pat, case_insensitive_hash{},
+	                                              case_insensitive_eq{}};
+	r = nano::search(hay, bmh);
+	CHECK(r.begin() == hay.begin() + 11);
+	CHECK(r.size() == 9);
+
+	const nano::default_searcher def{pat, case_insensitive_eq{}};
+	r = nano::search(hay, def);
+	CHECK(r.begin() == hay.begin() + 11);
+}
+
+TEST_CASE("alg.searchers.non_random_access")
+{
+	// The naive and default searchers work with forward ranges
+	const std::list<char> hay = {'a', 'b', 'a', 'b', 'c', 'a'};
+	const std::string pat = "abc";
+
+	auto r = nano::search(hay, nano::naive_searcher{pat});
+	CHECK(r.begin() == std::next(hay.begin(), 2));
+	r = nano::search(hay, nano::default_searcher{pat});
+	CHECK(r.begin() == std::next(hay.begin(), 2));
+
+	const char in[] = "xxababcxx";
+	using I = forward_iterator<const char*>;
+	const auto r2 = nano::default_searcher{pat}(I(in), I(in + 9));
+	CHECK(r2.begin() == I(in + 4));
+	CHECK(r2.end() == I(in + 7));
+}
+
+TEST_CASE("alg.searchers.random")
+{
+	test_random<char>();
+	test_random<unsigned char>();
+	test_random<std::byte>();
+	test_random<int>();
+	test_random<long long>();
+}
+
+TEST_CASE("alg.searchers.periodic")
+{
+	test_periodic();
+}
+
+TEST_CASE("alg.searchers.constexpr")
+{
+	static_assert(test_constexpr());
+}
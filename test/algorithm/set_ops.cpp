@@ -0,0 +1,297 @@
+// nanorange/test/algorithm/set_ops.cpp
+//
+// Copyright (c) 2020 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Checks the galloping and vectorised paths of the set operations against
+// the plain merge, which is used for forward iterators
+
+#include <nanorange/algorithm/set_difference.hpp>
+#include <nanorange/algorithm/set_intersection.hpp>
+#include <nanorange/algorithm/set_symmetric_difference.hpp>
+#include <nanorange/algorithm/set_union.hpp>
+#include <nanorange/iterator/back_insert_iterator.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "../catch.hpp"
+#include "../test_iterators.hpp"
+
+namespace {
+
+std::mt19937 gen;
+
+template <typename T>
+std::vector<T> sorted_values(std::size_t n, long max, bool unique)
+{
+    std::uniform_int_distribution<T> dist(
+        0, static_cast<T>(std::min<long>(max, std::numeric_limits<T>::max())));
+    std::vector<T> v(n);
+    std::generate(v.begin(), v.end(), [&] { return dist(gen); });
+    std::sort(v.begin(), v.end());
+    if (unique) {
+        v.erase(std::unique(v.begin(), v.end()), v.end());
+    }
+    return v;
+}
+
+template <typename V1, typename V2, typename Comp = nano::less,
+          typename Proj1 = nano::identity, typename Proj2 = nano::identity>
+void check_set_ops(const V1& a, const V2& b, Comp comp = Comp{},
+                   Proj1 proj1 = Proj1{}, Proj2 proj2 = Proj2{})
+{
+    using T = typename V1::value_type;
+    using FI1 = forward_iterator<const T*>;
+    using FI2 = forward_iterator<const typename V2::value_type*>;
+
+    const auto fa = [&] { return FI1(a.data()); };
+    const auto la = [&] { return FI1(a.data() + a.size()); };
+    const auto fb = [&] { return FI2(b.data()); };
+    const auto lb = [&] { return FI2(b.data() + b.size()); };
+
+    {
+        std::vector<T> expected;
+        nano::set_intersection(fa(), la(), fb(), lb(),
+                               nano::back_inserter(expected), comp, proj1,
+                               proj2);
+        std::vector<T> out;
+        nano::set_intersection(a, b, nano::back_inserter(out), comp, proj1,
+                               proj2);
+        CHECK(out == expected);
+    }
+
+    {
+        std::vector<T> expected;
+        nano::set_difference(fa(), la(), fb(), lb(),
+                             nano::back_inserter(expected), comp, proj1,
+                             proj2);
+        std::vector<T> out;
+        const auto res = nano::set_difference(a, b, nano::back_inserter(out),
+                                              comp, proj1, proj2);
+        CHECK(res.in == a.end());
+        CHECK(out == expected);
+    }
+
+    {
+        std::vector<T> expected;
+        nano::set_union(fa(), la(), fb(), lb(), nano::back_inserter(expected),
+                        comp, proj1, proj2);
+        std::vector<T> out;
+        const auto res = nano::set_union(a, b, nano::back_inserter(out), comp,
+                                         proj1, proj2);
+        CHECK(res.in1 == a.end());
+        CHECK(res.in2 == b.end());
+        CHECK(out == expected);
+    }
+
+    {
+        std::vector<T> expected;
+        nano::set_symmetric_difference(fa(), la(), fb(), lb(),
+                                       nano::back_inserter(expected), comp,
+                                       proj1, proj2);
+        std::vector<T> out;
+        const auto res = nano::set_symmetric_difference(
+            a, b, nano::back_inserter(out), comp, proj1, proj2);
+        CHECK(res.in1 == a.end());
+        CHECK(res.in2 == b.end());
+        CHECK(out == expected);
+    }
+}
+
+template <typename T>
+void check_integers()
+{
+    for (bool unique : {true, false}) {
+        // Similar sizes, with dense and sparse overlaps
+        for (std::size_t n : {0, 1, 7, 8, 9, 33, 100, 257, 1000, 5000}) {
+            for (long max : {50, 1000, 100000}) {
+                const auto a = sorted_values<T>(n, max, unique);
+                const auto b = sorted_values<T>(n + n / 3, max, unique);
+                check_set_ops(a, b);
+                check_set_ops(b, a);
+            }
+        }
+
+        // Skewed sizes, so that the set operations gallop
+        for (std::size_t n : {1, 3, 10, 100}) {
+            const auto a = sorted_values<T>(n, 100000, unique);
+            const auto b = sorted_values<T>(40 * n + 5, 100000, unique);
+            check_set_ops(a, b);
+            check_set_ops(b, a);
+
+            // Make sure some elements of the small range are present
+            std::vector<T> c;
+            std::sample(b.begin(), b.end(), std::back_inserter(c), n, gen);
+            check_set_ops(c, b);
+            check_set_ops(b, c);
+        }
+    }
+}
+
+// Every element of the smaller range is in the larger one, at both ends
+std::vector<int> every_nth(const std::vector<int>& v, std::size_t stride)
+{
+    std::vector<int> out;
+    for (std::size_t i = 0; i < v.size(); i += stride) {
+        out.push_back(v[i]);
+    }
+    if (out.back() != v.back()) {
+        out.push_back(v.back());
+    }
+    return out;
+}
+
+constexpr bool test_constexpr()
+{
+    int a[] = {3, 200};
+    int b[100] = {};
+    for (int i = 0; i < 100; ++i) {
+        b[i] = 4 * i;
+    }
+
+    int out[102] = {};
+    if (nano::set_intersection(a, b, out) != out + 1 || out[0] != 200) {
+        return false;
+    }
+
+    const auto diff = nano::set_difference(b, a, out);
+    if (diff.out != out + 99 || out[98] != 396) {
+        return false;
+    }
+
+    const auto uni = nano::set_union(a, b, out);
+    return uni.out == out + 101 && out[1] == 3 && out[100] == 396;
+}
+static_assert(test_constexpr());
+
+}
+
+TEST_CASE("alg.set_ops.integers")
+{
+    check_integers<std::int32_t>();
+    check_integers<std::uint32_t>();
+    check_integers<std::int64_t>();
+    check_integers<std::uint64_t>();
+    check_integers<std::int16_t>();
+}
+
+TEST_CASE("alg.set_ops.subsets")
+{
+    std::vector<int> v(10000);
+    std::iota(v.begin(), v.end(), -5000);
+
+    for (std::size_t stride : {1, 2, 3, 8, 33, 1000}) {
+        const auto s = every_nth(v, stride);
+        check_set_ops(s, v);
+        check_set_ops(v, s);
+
+        std::vector<int> out;
+        nano::set_intersection(s, v, nano::back_inserter(out));
+        CHECK(out == s);
+    }
+}
+
+TEST_CASE("alg.set_ops.duplicates_after_unique_prefix")
+{
+    // The vectorised intersection has to hand over to the merge when it
+    // finds a run of equal elements part way through
+    std::vector<int> a(1000);
+    std::vector<int> b(1000);
+    std::iota(a.begin(), a.end(), 0);
+    std::iota(b.begin(), b.end(), 0);
+    for (int pos : {0, 7, 8, 9, 500, 990, 998}) {
+        auto a2 = a;
+        auto b2 = b;
+        const auto i = static_cast<std::size_t>(pos);
+        a2[i] = a2[i + 1];
+        check_set_ops(a2, b);
+        check_set_ops(b, a2);
+        b2[i] = b2[i + 1];
+        check_set_ops(a2, b2);
+        check_set_ops(a, b2);
+    }
+}
+
+TEST_CASE("alg.set_ops.projections")
+{
+    using P = std::pair<int, int>;
+
+    // Elements with equal keys are told apart by their second member, so
+    // this checks which range each output element comes from
+    std::vector<P> a;
+    std::vector<P> b;
+    for (int i = 0; i < 2000; ++i) {
+        b.emplace_back(i / 2, 1);
+        if (i % 97 == 0) {
+            a.emplace_back(i / 2, 0);
+            a.emplace_back(i / 2, 0);
+            a.emplace_back(i / 2, 0);
+        }
+    }
+
+    check_set_ops(a, b, nano::less{}, &P::first, &P::first);
+    check_set_ops(b, a, nano::less{}, &P::first, &P::first);
+
+    std::reverse(a.begin(), a.end());
+    std::reverse(b.begin(), b.end());
+    check_set_ops(a, b, nano::greater{}, &P::first, &P::first);
+    check_set_ops(b, a, nano::greater{}, &P::first, &P::first);
+}
+
+TEST_CASE("alg.set_ops.union_prefers_first_range")
+{
+    using P = std::pair<int, char>;
+    const auto by_key = [](const P& x, const P& y) { return x.first < y.first; };
+
+    // Of two equivalent elements, set_union outputs the one from the first
+    // range, whichever range is larger and whichever path is taken
+    for (std::size_t small : {1, 5, 20}) {
+        for (std::size_t large : {small, std::size_t{2000}}) {
+            std::vector<P> a;
+            std::vector<P> b;
+            for (std::size_t i = 0; i < large; ++i) {
+                b.emplace_back(static_cast<int>(i), 'b');
+            }
+            for (std::size_t i = 0; i < small; ++i) {
+                a.emplace_back(static_cast<int>(i * large / small), 'a');
+            }
+
+            for (int swap = 0; swap < 2; ++swap) {
+                std::vector<P> expected;
+                std::set_union(a.begin(), a.end(), b.begin(), b.end(),
+                               std::back_inserter(expected), by_key);
+                std::vector<P> out;
+                nano::set_union(a, b, nano::back_inserter(out), nano::less{},
+                                &P::first, &P::first);
+                CHECK(out == expected);
+
+                std::vector<P> out_fwd;
+                nano::set_union(forward_iterator<const P*>(a.data()),
+                                forward_iterator<const P*>(a.data() + a.size()),
+                                forward_iterator<const P*>(b.data()),
+                                forward_iterator<const P*>(b.data() + b.size()),
+                                nano::back_inserter(out_fwd), nano::less{},
+                                &P::first, &P::first);
+                CHECK(out_fwd == expected);
+
+                std::swap(a, b);
+            }
+        }
+    }
+
+    const std::vector<P> a{{5, 'a'}};
+    const std::vector<P> b{{1, 'b'}, {5, 'b'}, {9, 'b'}};
+    std::vector<P> out;
+    nano::set_union(a, b, nano::back_inserter(out), nano::less{}, &P::first,
+                    &P::first);
+    CHECK(out == std::vector<P>{{1, 'b'}, {5, 'a'}, {9, 'b'}});
+}
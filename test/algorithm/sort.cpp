@@ -20,10 +20,14 @@
 
 #include <nanorange/algorithm/sort.hpp>
 #include <nanorange/algorithm/copy.hpp>
+#include <nanorange/algorithm/is_sorted.hpp>
 #include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <memory>
 #include <random>
+#include <stdexcept>
+#include <thread>
 #include <vector>
 #include "../catch.hpp"
 #include "../test_utils.hpp"
@@ -325,3 +329,81 @@ TEST_CASE("alg.sort")
 	}
 #endif
 }
+
+TEST_CASE("alg.sort.par")
+{
+	stl2::thread_pool pool(4);
+	const auto policy = stl2::par.on(pool);
+
+	// Large enough to be split into many tasks
+	const int size = 200'000;
+	std::vector<int> v(size);
+	std::uniform_int_distribution<int> dist(0, size);
+
+	for (auto& i : v) i = dist(gen);
+	auto expected = v;
+	std::sort(expected.begin(), expected.end());
+	CHECK(stl2::sort(policy, v) == v.end());
+	CHECK(v == expected);
+
+	// Patterns which exercise partition_left and the heapsort fallback
+	for (int i = 0; i < size; ++i) v[i] = i % 16;
+	stl2::sort(policy, v.begin(), v.end());
+	CHECK(stl2::is_sorted(v));
+
+	for (int i = 0; i < size; ++i) v[i] = size - i;
+	stl2::sort(policy, v, stl2::greater{});
+	CHECK(stl2::is_sorted(v, stl2::greater{}));
+
+	// Sequential and default pool policies
+	for (auto& i : v) i = dist(gen);
+	stl2::sort(stl2::seq, v);
+	CHECK(stl2::is_sorted(v));
+	for (auto& i : v) i = dist(gen);
+	stl2::sort(stl2::par, v);
+	CHECK(stl2::is_sorted(v));
+
+	// Check projections and move-only types
+	{
+		std::vector<std::unique_ptr<S>> ptrs(size);
+		for (int i = 0; i < size; ++i)
+			ptrs[i].reset(new S{size - i - 1, i});
+		stl2::sort(policy, ptrs, std::less<int>{},
+		           [](const auto& p) { return p->i; });
+		for (int i = 0; i < size; ++i) {
+			CHECK(ptrs[i]->i == i);
+			CHECK(ptrs[i]->j == size - i - 1);
+		}
+	}
+
+	// The grain size is the cutoff below which partitions are sorted on one
+	// thread, so a grain larger than the input keeps it all on this one
+	{
+		for (auto& i : v) i = dist(gen);
+		const auto self = std::this_thread::get_id();
+		std::atomic<int> elsewhere{0};
+		auto same_thread = [&](int a, int b) {
+			if (std::this_thread::get_id() != self) ++elsewhere;
+			return a < b;
+		};
+		stl2::sort(policy.with_grain_size(2 * size), v, same_thread);
+		CHECK(stl2::is_sorted(v));
+		CHECK(elsewhere.load() == 0);
+
+		// A tiny grain size still sorts correctly
+		for (auto& i : v) i = dist(gen);
+		stl2::sort(policy.with_grain_size(1), v);
+		CHECK(stl2::is_sorted(v));
+	}
+
+	// Exceptions thrown by the comparator reach the caller
+	{
+		for (auto& i : v) i = dist(gen);
+		std::atomic<int> calls{0};
+		auto throwing = [&calls](int a, int b) {
+			if (++calls == 1'000'000) throw std::runtime_error("comparison");
+			return a < b;
+		};
+		CHECK_THROWS_AS(stl2::sort(policy, v, throwing), std::runtime_error);
+	}
+}
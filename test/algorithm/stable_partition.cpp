@@ -23,9 +23,14 @@
 //===----------------------------------------------------------------------===//
 
 #include <nanorange/algorithm/stable_partition.hpp>
+#include <algorithm>
 #include <array>
+#include <atomic>
 #include <memory>
+#include <random>
+#include <stdexcept>
 #include <utility>
+#include <vector>
 #include "../catch.hpp"
 #include "../test_utils.hpp"
 #include "../test_iterators.hpp"
@@ -628,3 +633,73 @@ TEST_CASE("alg.stable_partition")
 		CHECK(std::is_partitioned(first, last, even));
 	}
 }
+
+TEST_CASE("alg.stable_partition.par")
+{
+	using P = std::pair<int, int>;
+	nano::thread_pool pool(4);
+	std::mt19937 gen;
+
+	for (std::size_t size : {0, 1, 1000, 100'000}) {
+		for (int odds_in_ten : {0, 1, 5, 10}) {
+			// Keys tagged with their original positions
+			std::vector<P> input(size);
+			for (std::size_t i = 0; i < size; ++i) {
+				input[i] = {static_cast<int>(gen() % 1000) * 2 +
+				                (static_cast<int>(gen() % 10) < odds_in_ten),
+				            static_cast<int>(i)};
+			}
+			auto expected = input;
+			const auto split = std::stable_partition(
+			    expected.begin(), expected.end(), odd_first());
+
+			for (const auto policy : {nano::par.on(pool),
+			                          nano::par.on(pool).with_grain_size(1000),
+			                          nano::par}) {
+				auto v = input;
+				const auto r = ranges::stable_partition(policy, v, odd_first());
+				CHECK(r.begin() == v.begin() + (split - expected.begin()));
+				CHECK(r.end() == v.end());
+				CHECK(v == expected);
+			}
+		}
+	}
+
+	// Move-only elements, iterators and projections
+	{
+		std::vector<std::unique_ptr<int>> v;
+		for (int i = 0; i < 50'000; ++i) {
+			v.push_back(std::make_unique<int>(i));
+		}
+		const auto r = ranges::stable_partition(
+		    nano::par.on(pool).with_grain_size(100), v.begin(), v.end(),
+		    is_odd(), [](const std::unique_ptr<int>& p) { return *p; });
+		CHECK(r.begin() == v.begin() + 25'000);
+		bool in_order = true;
+		for (int i = 0; i < 25'000; ++i) {
+			in_order &= *v[static_cast<std::size_t>(i)] == 2 * i + 1;
+			in_order &= *v[static_cast<std::size_t>(25'000 + i)] == 2 * i;
+		}
+		CHECK(in_order);
+	}
+
+	// Exceptions thrown by the predicate reach the caller, before any
+	// element has moved
+	{
+		std::vector<int> v(100'000);
+		for (int i = 0; i < 100'000; ++i) {
+			v[static_cast<std::size_t>(i)] = i;
+		}
+		const auto input = v;
+		std::atomic<int> calls{0};
+		auto throwing = [&calls](int i) {
+			if (++calls == 50'000) throw std::runtime_error("predicate");
+			return (i & 1) != 0;
+		};
+		CHECK_THROWS_AS(ranges::stable_partition(
+		                    nano::par.on(pool).with_grain_size(1000), v,
+		                    throwing),
+		                std::runtime_error);
+		CHECK(v == input);
+	}
+}
@@ -19,9 +19,14 @@
 //===----------------------------------------------------------------------===//
 
 #include <nanorange/algorithm/stable_sort.hpp>
+#include <nanorange/algorithm/is_sorted.hpp>
+#include <atomic>
 #include <cassert>
 #include <memory>
 #include <random>
+#include <stdexcept>
+#include <string>
+#include <thread>
 #include <vector>
 #include <algorithm>
 #include "../catch.hpp"
@@ -239,3 +244,153 @@ TEST_CASE("alg.stable_sort")
 		}
 	}
 }
+
+TEST_CASE("alg.stable_sort.par")
+{
+	stl2::thread_pool pool(4);
+	const auto policy = stl2::par.on(pool);
+
+	// Many equal keys, so that we can check stability. The sizes are large
+	// enough to be split into chunks, and not all are powers of two.
+	for (int size : {100'003, 300'000}) {
+		std::vector<S> v(size);
+		std::uniform_int_distribution<int> dist(0, 1000);
+		for (int i = 0; i < size; ++i) {
+			v[i].i = dist(gen);
+			v[i].j = i;
+		}
+		auto expected = v;
+		std::stable_sort(expected.begin(), expected.end(),
+		                 [](const S& a, const S& b) { return a.i < b.i; });
+
+		CHECK(stl2::stable_sort(policy, v, std::less<int>{}, &S::i) == v.end());
+		for (int i = 0; i < size; ++i) {
+			CHECK(v[i].i == expected[i].i);
+			CHECK(v[i].j == expected[i].j);
+		}
+
+		// Already sorted, and reversed
+		stl2::stable_sort(policy, v.begin(), v.end(), std::less<int>{}, &S::i);
+		for (int i = 0; i < size; ++i) {
+			CHECK(v[i].j == expected[i].j);
+		}
+		stl2::stable_sort(policy, v, std::greater<int>{}, &S::j);
+		for (int i = 1; i < size; ++i) {
+			CHECK(v[i - 1].j > v[i].j);
+		}
+	}
+
+	// The grain size is the smallest chunk worth sorting in parallel, so one
+	// larger than the input keeps it all on this thread, and a small one
+	// still gives a stable sort
+	{
+		const int size = 100'000;
+		std::vector<S> v(size);
+		std::uniform_int_distribution<int> dist(0, 100);
+		for (int i = 0; i < size; ++i) {
+			v[i].i = dist(gen);
+			v[i].j = i;
+		}
+
+		const auto self = std::this_thread::get_id();
+		std::atomic<int> elsewhere{0};
+		auto same_thread = [&](int a, int b) {
+			if (std::this_thread::get_id() != self) ++elsewhere;
+			return a < b;
+		};
+		stl2::stable_sort(policy.with_grain_size(size), v, same_thread, &S::i);
+		CHECK(elsewhere.load() == 0);
+
+		stl2::stable_sort(policy, v, std::less<int>{}, &S::j);
+		std::vector<S> small(v.begin(), v.begin() + 5000);
+		stl2::stable_sort(policy.with_grain_size(64), small, std::less<int>{},
+		                  &S::i);
+		for (std::size_t i = 1; i < small.size(); ++i) {
+			CHECK(small[i - 1].i <= small[i].i);
+			if (small[i - 1].i == small[i].i) {
+				CHECK(small[i - 1].j < small[i].j);
+			}
+		}
+	}
+
+	// Move-only and non-trivial types
+	{
+		const int size = 200'000;
+		std::vector<std::unique_ptr<S>> ptrs(size);
+		for (int i = 0; i < size; ++i)
+			ptrs[i].reset(new S{(size - i) / 3, i});
+		stl2::stable_sort(policy, ptrs, std::less<int>{},
+		                  [](const auto& p) { return p->i; });
+		for (int i = 1; i < size; ++i) {
+			CHECK(ptrs[i - 1]->i <= ptrs[i]->i);
+			if (ptrs[i - 1]->i == ptrs[i]->i) {
+				CHECK(ptrs[i - 1]->j < ptrs[i]->j);
+			}
+		}
+
+		std::vector<std::string> strs(size);
+		for (int i = 0; i < size; ++i)
+			strs[i] = std::to_string(gen()) + " is a long enough string";
+		auto expected = strs;
+		std::sort(expected.begin(), expected.end());
+		stl2::stable_sort(stl2::par, strs);
+		CHECK(strs == expected);
+	}
+
+	// A caller-supplied buffer is grown once and then reused
+	{
+		const int size = 200'000;
+		std::vector<int> v(size);
+		std::uniform_int_distribution<int> dist(0, size);
+
+		stl2::stable_sort_buffer<int> buf;
+		CHECK(buf.capacity() == 0);
+		for (auto& i : v) i = dist(gen);
+		stl2::stable_sort(policy, v, buf);
+		CHECK(stl2::is_sorted(v));
+		const auto capacity = buf.capacity();
+		CHECK(capacity > 0);
+		CHECK(capacity <= std::size_t(size));
+
+		for (auto& i : v) i = dist(gen);
+		stl2::stable_sort(policy, v.begin(), v.end(), buf, stl2::greater{});
+		CHECK(stl2::is_sorted(v, stl2::greater{}));
+		for (auto& i : v) i = dist(gen);
+		stl2::stable_sort(v, buf);
+		CHECK(stl2::is_sorted(v));
+		CHECK(buf.capacity() == capacity);
+
+		stl2::stable_sort_buffer<int> big(size);
+		for (auto& i : v) i = dist(gen);
+		stl2::stable_sort(stl2::seq, v.begin(), v.end(), big);
+		CHECK(stl2::is_sorted(v));
+		CHECK(big.capacity() == std::size_t(size));
+	}
+
+	// Exceptions thrown by the comparator reach the caller
+	{
+		const int size = 200'000;
+		std::vector<std::string> strs(size);
+		for (int i = 0; i < size; ++i)
+			strs[i] = std::to_string(gen()) + " is a long enough string";
+		auto copy = strs;
+		std::atomic<long> calls{0};
+		stl2::stable_sort(policy, copy, [&calls](const auto& a, const auto& b) {
+			++calls;
+			return a < b;
+		});
+
+		// Throw early on, while chunks are being sorted, and near the end
+		// during the final merge
+		for (long n : {1000L, calls - 1000}) {
+			copy = strs;
+			calls = 0;
+			auto throwing = [&calls, n](const std::string& a, const std::string& b) {
+				if (++calls == n) throw std::runtime_error("comparison");
+				return a < b;
+			};
+			CHECK_THROWS_AS(stl2::stable_sort(policy, copy, throwing),
+			                std::runtime_error);
+		}
+	}
+}
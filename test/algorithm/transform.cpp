@@ -10,6 +10,9 @@
 // Project home: https://github.com/caseycarter/cmcstl2
 //
 #include <nanorange/algorithm/transform.hpp>
+#include <algorithm>
+#include <numeric>
+#include <vector>
 #include "../test_utils.hpp"
 
 #include "../catch.hpp"
@@ -50,3 +53,82 @@ TEST_CASE("alg.transform") {
 		}
 	}
 }
+
+TEST_CASE("alg.transform.par")
+{
+	ranges::thread_pool pool(4);
+	const auto policy = ranges::par.on(pool).with_grain_size(1000);
+
+	const int size = 100'003;
+	std::vector<int> in(size);
+	std::iota(in.begin(), in.end(), 0);
+
+	const auto check_doubled = [&](const std::vector<long>& out, int offset) {
+		bool ok = true;
+		for (int i = 0; i < size - offset; ++i) {
+			ok = ok && out[i + offset] == 2L * i;
+		}
+		return ok;
+	};
+
+	// Unary, writing to outputs at various alignments
+	for (int offset : {0, 1, 3}) {
+		std::vector<long> out(size, -1);
+		auto res = ranges::transform(policy, in.begin(), in.end() - offset,
+		                             out.begin() + offset,
+		                             [](int i) { return 2L * i; });
+		CHECK(res.in == in.end() - offset);
+		CHECK(res.out == out.end());
+		CHECK(check_doubled(out, offset));
+	}
+
+	{
+		std::vector<long> out(size);
+		auto res = ranges::transform(ranges::par, in, out.begin(),
+		                             [](long i) { return i; },
+		                             [](int i) { return 2 * i; });
+		CHECK(res.in == in.end());
+		CHECK(check_doubled(out, 0));
+	}
+
+	// Binary, stopping at the end of the shorter input
+	{
+		std::vector<int> in2(size - 10, 1);
+		std::vector<long> out(size, -1);
+		auto res = ranges::transform(policy, in, in2, out.begin(),
+		                             [](int a, int b) { return 2L * a + b; });
+		CHECK(res.in1 == in.end() - 10);
+		CHECK(res.in2 == in2.end());
+		CHECK(res.out == out.end() - 10);
+		CHECK(out[size - 11] == 2L * (size - 11) + 1);
+		CHECK(out[size - 10] == -1);
+
+		auto res2 = ranges::transform(ranges::seq, in.begin(), in.end(),
+		                              in2.begin(), in2.end(), out.begin(),
+		                              [](int a, int b) { return a - b; });
+		CHECK(res2.out == out.end() - 10);
+		CHECK(out[size - 11] == size - 12);
+	}
+
+	// In place
+	{
+		std::vector<int> v = in;
+		ranges::transform(policy, v, v.begin(), [](int i) { return -i; });
+		CHECK(std::equal(v.begin(), v.end(), in.begin(),
+		                 [](int a, int b) { return a == -b; }));
+	}
+
+	// Small outputs which end before the first cache line boundary
+	alignas(64) int small[32];
+	const auto tiny = ranges::par.on(pool).with_grain_size(1);
+	for (int offset : {1, 5, 15}) {
+		for (int n : {0, 1, 8, 14, 15, 16, 17}) {
+			std::fill(std::begin(small), std::end(small), 0);
+			auto res = ranges::transform(tiny, in.begin(), in.begin() + n,
+			                             small + offset,
+			                             [](int) { return 1; });
+			CHECK(res.out == small + offset + n);
+			CHECK(std::count(std::begin(small), std::end(small), 1) == n);
+		}
+	}
+}
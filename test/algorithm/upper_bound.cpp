@@ -15,6 +15,8 @@
 
 #include <nanorange/algorithm/upper_bound.hpp>
 #include <nanorange/views/subrange.hpp>
+#include <algorithm>
+#include <functional>
 #include <vector>
 #include <utility>
 #include "../catch.hpp"
@@ -84,3 +86,30 @@ TEST_CASE("alg.upper_bound")
 	CHECK(*stl2::upper_bound(stl2::ext::iota_view<int>{}, 42).get_unsafe() == 43);
 #endif
 }
+
+TEST_CASE("alg.upper_bound.branchless")
+{
+	// Contiguous ranges of scalars are searched without branches; check
+	// every position in small ranges and a range big enough to prefetch
+	for (int n : {0, 1, 2, 3, 4, 5, 7, 8, 9, 15, 16, 17, 31, 100, 257, 100'000}) {
+		std::vector<int> v(n);
+		for (int i = 0; i < n; ++i) v[i] = 2 * (i / 2);
+		for (int key = -1; key <= 2 * n + 1; key += (n > 1000 ? 37 : 1)) {
+			CHECK(stl2::upper_bound(v, key) ==
+			      std::upper_bound(v.begin(), v.end(), key));
+		}
+
+		std::vector<long> desc(v.rbegin(), v.rend());
+		for (int key = -1; key <= 2 * n + 1; key += (n > 1000 ? 37 : 1)) {
+			CHECK(stl2::upper_bound(desc, key, std::greater<>{}) ==
+			      std::upper_bound(desc.begin(), desc.end(), key,
+			                       std::greater<>{}));
+		}
+	}
+
+	std::pair<int, int> a[] = {{0, 0}, {0, 1}, {1, 2}, {1, 3}, {3, 4}, {3, 5}};
+	for (int key = -1; key <= 4; ++key) {
+		CHECK(stl2::upper_bound(a, key, stl2::less{}, &std::pair<int, int>::first) ==
+		      std::upper_bound(a, a + 6, std::pair<int, int>{key, 99}));
+	}
+}
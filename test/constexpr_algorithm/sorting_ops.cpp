@@ -54,4 +54,28 @@ constexpr bool test_nth_element()
 }
 static_assert(test_nth_element(), "");
 
+constexpr bool test_merge()
+{
+    // Long runs from each side, so that the merge gallops
+    carray<int, 20> a{};
+    carray<int, 20> b{};
+    for (int i = 0; i < 20; i++) {
+        a[(size_t)i] = i < 10 ? i : i + 10;
+        b[(size_t)i] = i < 10 ? i + 10 : i + 20;
+    }
+
+    carray<int, 40> out{};
+    const auto ret = nano::merge(a, b, out.begin());
+    if (ret.out != out.end()) {
+        return false;
+    }
+    for (int i = 0; i < 40; i++) {
+        if (out[(size_t)i] != i) {
+            return false;
+        }
+    }
+    return true;
+}
+static_assert(test_merge(), "");
+
 }
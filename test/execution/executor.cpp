@@ -0,0 +1,183 @@
+// nanorange/test/execution/executor.cpp
+//
+// Copyright (c) 2020 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <nanorange/algorithm/for_each.hpp>
+#include <nanorange/algorithm/is_sorted.hpp>
+#include <nanorange/algorithm/sort.hpp>
+#include <nanorange/execution.hpp>
+#include <nanorange/numeric/reduce.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "../catch.hpp"
+
+namespace {
+
+// Runs tasks on threads which it was given rather than started, as a program
+// with threads of its own would. Each thread calls serve() until stopped.
+// With no threads, tasks only run on the thread which waits for them.
+class borrowed_threads_executor final : public nano::executor {
+public:
+    explicit borrowed_threads_executor(std::size_t concurrency)
+        : concurrency_(concurrency)
+    {}
+
+    ~borrowed_threads_executor() override
+    {
+        for (task* t : tasks_) {
+            delete t;
+        }
+    }
+
+    std::size_t concurrency() const noexcept override { return concurrency_; }
+
+    void serve()
+    {
+        while (true) {
+            std::unique_lock<std::mutex> lock(mutex_);
+            cv_.wait(lock, [this] { return stop_ || !tasks_.empty(); });
+            if (tasks_.empty()) {
+                return;
+            }
+            std::unique_ptr<task> t(tasks_.front());
+            tasks_.pop_front();
+            lock.unlock();
+            t->run();
+        }
+    }
+
+    void stop()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        cv_.notify_all();
+    }
+
+    int submitted() const { return submitted_.load(); }
+
+private:
+    void submit(std::unique_ptr<task> t) override
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            tasks_.push_back(t.get());
+            t.release();
+        }
+        ++submitted_;
+        cv_.notify_one();
+    }
+
+    bool try_run_one() noexcept override
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (tasks_.empty()) {
+            return false;
+        }
+        std::unique_ptr<task> t(tasks_.back());
+        tasks_.pop_back();
+        lock.unlock();
+        t->run();
+        return true;
+    }
+
+    const std::size_t concurrency_;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<task*> tasks_;
+    std::atomic<int> submitted_{0};
+    bool stop_ = false;
+};
+
+void check_algorithms(const nano::parallel_policy& policy)
+{
+    std::mt19937 gen{};
+    std::vector<int> vec(100'000);
+    for (auto& i : vec) {
+        i = static_cast<int>(gen() % 1000);
+    }
+
+    const long long expected = std::accumulate(vec.begin(), vec.end(), 0LL);
+    CHECK(nano::reduce(policy.with_grain_size(1000), vec, 0LL) == expected);
+
+    std::atomic<long long> sum{0};
+    nano::for_each(policy.with_grain_size(1000), vec,
+                   [&sum](int i) { sum += i; });
+    CHECK(sum.load() == expected);
+
+    nano::sort(policy.with_grain_size(1000), vec);
+    CHECK(nano::is_sorted(vec));
+
+    // Exceptions still reach the caller
+    CHECK_THROWS_AS(nano::for_each(policy.with_grain_size(1000), vec,
+                                   [](int i) {
+                                       if (i == 999) {
+                                           throw std::runtime_error("999");
+                                       }
+                                   }),
+                    std::runtime_error);
+}
+
+}
+
+TEST_CASE("execution.executor.own_threads")
+{
+    borrowed_threads_executor ex(4);
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 3; ++i) {
+        threads.emplace_back([&ex] { ex.serve(); });
+    }
+
+    check_algorithms(nano::par.on(ex));
+    CHECK(ex.submitted() > 0);
+
+    ex.stop();
+    for (auto& t : threads) {
+        t.join();
+    }
+}
+
+TEST_CASE("execution.executor.calling_thread_only")
+{
+    // An executor with no threads at all: every task runs on the thread
+    // which waits for it, so no threads are started
+    borrowed_threads_executor ex(4);
+    const auto self = std::this_thread::get_id();
+    std::atomic<int> elsewhere{0};
+
+    check_algorithms(nano::par.on(ex));
+    CHECK(ex.submitted() > 0);
+
+    std::vector<int> vec(10'000);
+    nano::for_each(nano::par.on(ex).with_grain_size(100), vec, [&](int) {
+        if (std::this_thread::get_id() != self) {
+            ++elsewhere;
+        }
+    });
+    CHECK(elsewhere.load() == 0);
+}
+
+TEST_CASE("execution.executor.default")
+{
+    borrowed_threads_executor ex(4);
+    nano::scoped_default_executor guard(ex);
+    CHECK(nano::get_default_executor() == &ex);
+    CHECK(&nano::par.get_executor() == &ex);
+
+    check_algorithms(nano::par);
+    CHECK(ex.submitted() > 0);
+}
@@ -0,0 +1,263 @@
+// nanorange/test/execution/thread_pool.cpp
+//
+// Copyright (c) 2020 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <nanorange/execution.hpp>
+#include <nanorange/numeric/reduce.hpp>
+
+#include <atomic>
+#include <numeric>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "../catch.hpp"
+
+namespace {
+
+// Sums [lo, hi) by splitting it in half until the pieces are small, forking
+// one half each time
+long long fork_sum(nano::thread_pool& pool, long long lo, long long hi)
+{
+    if (hi - lo <= 64) {
+        long long sum = 0;
+        for (long long i = lo; i < hi; ++i) {
+            sum += i;
+        }
+        return sum;
+    }
+
+    const long long mid = lo + (hi - lo) / 2;
+    long long left = 0;
+    long long right = 0;
+    auto sum_left = [&] { left = fork_sum(pool, lo, mid); };
+    auto sum_right = [&] { right = fork_sum(pool, mid, hi); };
+    nano::detail::parallel_invoke(pool, sum_left, sum_right);
+    return left + right;
+}
+
+}
+
+TEST_CASE("execution.chase_lev_deque.sequential")
+{
+    std::vector<int> values(1000);
+    std::iota(values.begin(), values.end(), 0);
+
+    // Starts small, so that the pushes have to grow it several times
+    nano::detail::chase_lev_deque<int> deque(4);
+    CHECK(deque.empty());
+    CHECK(deque.pop() == nullptr);
+    CHECK(deque.steal() == nullptr);
+
+    for (int& i : values) {
+        deque.push(&i);
+    }
+    CHECK(!deque.empty());
+
+    // The owner takes the newest, thieves the oldest
+    CHECK(deque.pop() == &values[999]);
+    CHECK(deque.steal() == &values[0]);
+    CHECK(deque.steal() == &values[1]);
+    CHECK(deque.pop() == &values[998]);
+
+    for (int i = 997; i >= 2; --i) {
+        REQUIRE(deque.pop() == &values[static_cast<std::size_t>(i)]);
+    }
+    CHECK(deque.empty());
+    CHECK(deque.pop() == nullptr);
+    CHECK(deque.steal() == nullptr);
+}
+
+TEST_CASE("execution.chase_lev_deque.concurrent")
+{
+    constexpr int count = 200000;
+    constexpr int num_thieves = 3;
+
+    std::vector<int> values(count);
+    std::vector<std::atomic<int>> taken(count);
+    for (auto& t : taken) {
+        t.store(0);
+    }
+
+    nano::detail::chase_lev_deque<int> deque(16);
+    std::atomic<bool> done{false};
+
+    const auto take = [&](int* p) {
+        taken[static_cast<std::size_t>(p - values.data())].fetch_add(1);
+    };
+
+    std::vector<std::thread> thieves;
+    for (int i = 0; i < num_thieves; ++i) {
+        thieves.emplace_back([&] {
+            while (!done.load()) {
+                if (int* p = deque.steal()) {
+                    take(p);
+                }
+            }
+        });
+    }
+
+    // The owner pops one element for every three it pushes, so that the
+    // deque grows while thieves are stealing and pops race with steals
+    for (int i = 0; i < count; ++i) {
+        deque.push(&values[static_cast<std::size_t>(i)]);
+        if (i % 3 == 2) {
+            if (int* p = deque.pop()) {
+                take(p);
+            }
+        }
+    }
+    while (int* p = deque.pop()) {
+        take(p);
+    }
+
+    done.store(true);
+    for (auto& t : thieves) {
+        t.join();
+    }
+
+    // Every element was taken exactly once
+    int bad = 0;
+    for (auto& t : taken) {
+        bad += t.load() != 1;
+    }
+    CHECK(bad == 0);
+}
+
+TEST_CASE("execution.thread_pool.fork_join")
+{
+    for (std::size_t threads : {1, 2, 4}) {
+        nano::thread_pool pool(threads);
+        CHECK(pool.concurrency() == threads);
+        CHECK(fork_sum(pool, 0, 100000) == 100000LL * 99999 / 2);
+    }
+}
+
+TEST_CASE("execution.thread_pool.parallel_for")
+{
+    nano::thread_pool pool(4);
+    std::vector<std::atomic<int>> calls(1000);
+    for (auto& c : calls) {
+        c.store(0);
+    }
+
+    auto f = [&](std::ptrdiff_t i) {
+        calls[static_cast<std::size_t>(i)].fetch_add(1);
+    };
+    nano::detail::parallel_for(pool, 1000, f);
+
+    int bad = 0;
+    for (auto& c : calls) {
+        bad += c.load() != 1;
+    }
+    CHECK(bad == 0);
+}
+
+TEST_CASE("execution.thread_pool.exceptions")
+{
+    nano::thread_pool pool(4);
+
+    // From a forked task
+    {
+        int ran = 0;
+        auto f = [] { throw std::runtime_error("forked"); };
+        auto g = [&] { ++ran; };
+        CHECK_THROWS_AS(nano::detail::parallel_invoke(pool, f, g),
+                        std::runtime_error);
+        CHECK(ran == 1);
+    }
+
+    // From the calling thread, after which the forked task still finishes
+    {
+        std::atomic<int> ran{0};
+        auto f = [&] { ++ran; };
+        auto g = [] { throw std::logic_error("inline"); };
+        CHECK_THROWS_AS(nano::detail::parallel_invoke(pool, f, g),
+                        std::logic_error);
+        CHECK(ran.load() == 1);
+    }
+
+    // From deep inside nested forks, after which the pool is still usable
+    {
+        auto f = [&](std::ptrdiff_t i) {
+            if (i == 37) {
+                throw std::out_of_range("nested");
+            }
+            fork_sum(pool, 0, 1000);
+        };
+        CHECK_THROWS_AS(nano::detail::parallel_for(pool, 100, f),
+                        std::out_of_range);
+        CHECK(fork_sum(pool, 0, 100000) == 100000LL * 99999 / 2);
+    }
+}
+
+TEST_CASE("execution.thread_pool.single_thread")
+{
+    // A pool of concurrency one starts no threads, so every task runs on the
+    // thread which waits for it
+    nano::thread_pool pool(1);
+    const auto self = std::this_thread::get_id();
+    std::atomic<int> elsewhere{0};
+
+    auto f = [&](std::ptrdiff_t) {
+        if (std::this_thread::get_id() != self) {
+            ++elsewhere;
+        }
+    };
+    nano::detail::parallel_for(pool, 100, f);
+    CHECK(elsewhere.load() == 0);
+}
+
+TEST_CASE("execution.thread_pool.external_threads")
+{
+    // Several threads outside the pool use it at once
+    nano::thread_pool pool(3);
+    std::vector<long long> vec(50000);
+    std::iota(vec.begin(), vec.end(), 0LL);
+    const long long expected = 50000LL * 49999 / 2;
+
+    std::vector<long long> results(4);
+    std::vector<std::thread> callers;
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        callers.emplace_back([&, i] {
+            results[i] = nano::reduce(
+                nano::par.on(pool).with_grain_size(1000), vec, 0LL);
+        });
+    }
+    for (auto& t : callers) {
+        t.join();
+    }
+
+    for (long long r : results) {
+        CHECK(r == expected);
+    }
+}
+
+TEST_CASE("execution.default_executor")
+{
+    CHECK(nano::get_default_executor() == nullptr);
+    nano::executor& builtin = nano::par.get_executor();
+
+    nano::thread_pool pool(2);
+    {
+        nano::scoped_default_executor guard(pool);
+        CHECK(nano::get_default_executor() == &pool);
+        CHECK(&nano::par.get_executor() == &pool);
+        CHECK(&nano::detail::default_executor() == &pool);
+
+        // Naming an executor still overrides the default
+        nano::thread_pool other(1);
+        CHECK(&nano::par.on(other).get_executor() == &other);
+
+        nano::thread_pool inner(1);
+        CHECK(nano::set_default_executor(&inner) == &pool);
+        CHECK(&nano::par.get_executor() == &inner);
+        CHECK(nano::set_default_executor(&pool) == &inner);
+    }
+
+    CHECK(nano::get_default_executor() == nullptr);
+    CHECK(&nano::par.get_executor() == &builtin);
+}
@@ -0,0 +1,204 @@
+// nanorange/test/index/eytzinger_index.cpp
+//
+// Copyright (c) 2020 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <nanorange/algorithm/lower_bound.hpp>
+#include <nanorange/algorithm/upper_bound.hpp>
+#include <nanorange/index/eytzinger_index.hpp>
+#include <nanorange/views/filter.hpp>
+#include <nanorange/views/reverse.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../catch.hpp"
+
+namespace {
+
+std::mt19937 gen;
+
+static_assert(nano::bidirectional_range<nano::eytzinger_index<int>>);
+static_assert(nano::sized_range<nano::eytzinger_index<int>>);
+static_assert(nano::common_range<nano::eytzinger_index<int>>);
+static_assert(nano::view<nano::subrange<nano::eytzinger_index<int>::iterator>>);
+
+template <typename Index, typename Sorted, typename Comp = std::less<>>
+void check_index(const Index& idx, const Sorted& sorted, Comp comp = Comp{})
+{
+    REQUIRE(idx.size() == sorted.size());
+    CHECK(idx.empty() == sorted.empty());
+    CHECK(std::equal(idx.begin(), idx.end(), sorted.begin(), sorted.end()));
+
+    const auto pos = [&](auto it) {
+        return std::distance(idx.begin(), it);
+    };
+
+    for (const auto& key : sorted) {
+        const auto lo = std::lower_bound(sorted.begin(), sorted.end(), key,
+                                         comp);
+        const auto hi = std::upper_bound(sorted.begin(), sorted.end(), key,
+                                         comp);
+        CHECK(pos(idx.lower_bound(key)) == lo - sorted.begin());
+        CHECK(pos(idx.upper_bound(key)) == hi - sorted.begin());
+        const auto er = idx.equal_range(key);
+        CHECK(pos(er.begin()) == lo - sorted.begin());
+        CHECK(pos(er.end()) == hi - sorted.begin());
+        CHECK(idx.contains(key));
+    }
+}
+
+}
+
+TEST_CASE("index.eytzinger_index.empty")
+{
+    const nano::eytzinger_index<int> idx;
+    CHECK(idx.empty());
+    CHECK(idx.size() == 0);
+    CHECK(idx.begin() == idx.end());
+    CHECK(idx.lower_bound(1) == idx.end());
+    CHECK(idx.upper_bound(1) == idx.end());
+    CHECK_FALSE(idx.contains(1));
+
+    const nano::eytzinger_index<int> idx2(std::vector<int>{});
+    CHECK(idx2.empty());
+    CHECK(idx2.begin() == idx2.end());
+}
+
+TEST_CASE("index.eytzinger_index.sizes")
+{
+    std::uniform_int_distribution<int> dist(0, 100);
+
+    for (int n = 0; n < 300; ++n) {
+        std::vector<int> v(static_cast<std::size_t>(n));
+        std::generate(v.begin(), v.end(), [&] { return 2 * dist(gen); });
+        std::sort(v.begin(), v.end());
+
+        const nano::eytzinger_index idx(v);
+        check_index(idx, v);
+
+        // Keys between and outside the elements
+        for (int key = -1; key <= 201; key += 2) {
+            const auto lo = std::lower_bound(v.begin(), v.end(), key);
+            CHECK(std::distance(idx.begin(), idx.lower_bound(key)) ==
+                  lo - v.begin());
+            CHECK(std::distance(idx.begin(), idx.upper_bound(key)) ==
+                  lo - v.begin());
+            CHECK_FALSE(idx.contains(key));
+        }
+    }
+}
+
+TEST_CASE("index.eytzinger_index.large")
+{
+    std::uniform_int_distribution<int> dist(0, 1 << 20);
+    std::vector<int> v(100000);
+    std::generate(v.begin(), v.end(), [&] { return dist(gen); });
+    std::sort(v.begin(), v.end());
+
+    const nano::eytzinger_index<int> idx(v);
+    CHECK(std::equal(idx.begin(), idx.end(), v.begin(), v.end()));
+
+    for (int i = 0; i < 10000; ++i) {
+        const int key = dist(gen);
+        const auto lo = std::lower_bound(v.begin(), v.end(), key);
+        const auto hi = std::upper_bound(v.begin(), v.end(), key);
+        const auto it = idx.lower_bound(key);
+        if (lo == v.end()) {
+            CHECK(it == idx.end());
+        } else {
+            CHECK(*it == *lo);
+        }
+        CHECK(std::distance(it, idx.upper_bound(key)) == hi - lo);
+        CHECK(idx.contains(key) == std::binary_search(v.begin(), v.end(), key));
+    }
+}
+
+TEST_CASE("index.eytzinger_index.reverse_iteration")
+{
+    std::vector<int> v(77);
+    std::iota(v.begin(), v.end(), 0);
+    const nano::eytzinger_index<int> idx(v);
+
+    std::vector<int> out;
+    for (auto it = idx.end(); it != idx.begin();) {
+        out.push_back(*--it);
+    }
+    CHECK(std::equal(out.begin(), out.end(), v.rbegin(), v.rend()));
+
+    auto it = idx.lower_bound(40);
+    CHECK(*it-- == 40);
+    CHECK(*it++ == 39);
+    CHECK(*it == 40);
+}
+
+TEST_CASE("index.eytzinger_index.projection")
+{
+    using P = std::pair<int, std::string>;
+    std::vector<P> v;
+    for (int i = 0; i < 100; ++i) {
+        v.emplace_back(i / 3, std::to_string(i));
+    }
+
+    const nano::eytzinger_index idx(v, &P::first);
+    CHECK(std::equal(idx.begin(), idx.end(), v.begin(), v.end()));
+
+    for (int key = -1; key <= 34; ++key) {
+        const auto lo = nano::lower_bound(v, key, nano::less{}, &P::first);
+        const auto hi = nano::upper_bound(v, key, nano::less{}, &P::first);
+        const auto er = idx.equal_range(key);
+        CHECK(std::distance(idx.begin(), er.begin()) == lo - v.begin());
+        CHECK(std::distance(idx.begin(), er.end()) == hi - v.begin());
+        CHECK(idx.contains(key) == (lo != hi));
+    }
+
+    CHECK(idx.lower_bound(10)->second == "30");
+}
+
+TEST_CASE("index.eytzinger_index.comparator")
+{
+    std::vector<int> v(150);
+    std::generate(v.begin(), v.end(), [i = 0]() mutable { return i++ / 2; });
+    std::sort(v.begin(), v.end(), std::greater<>{});
+
+    const nano::eytzinger_index<int, nano::identity, nano::greater> idx(
+        v, nano::identity{}, nano::greater{});
+    check_index(idx, v, std::greater<>{});
+}
+
+TEST_CASE("index.eytzinger_index.strings")
+{
+    std::vector<std::string> v;
+    for (int i = 0; i < 200; ++i) {
+        v.push_back(std::to_string(i));
+    }
+    std::sort(v.begin(), v.end());
+
+    const nano::eytzinger_index idx(v);
+    check_index(idx, v);
+    CHECK_FALSE(idx.contains(std::string("200")));
+    CHECK(*idx.upper_bound(std::string("199")) == "2");
+}
+
+TEST_CASE("index.eytzinger_index.views")
+{
+    std::vector<int> v(100);
+    std::iota(v.begin(), v.end(), 0);
+    const nano::eytzinger_index<int> idx(v);
+
+    const auto tail = nano::subrange(idx.lower_bound(90), idx.end());
+    CHECK(nano::distance(tail) == 10);
+
+    std::vector<int> out;
+    for (int i : tail | nano::views::reverse |
+                     nano::views::filter([](int i) { return i % 2 == 0; })) {
+        out.push_back(i);
+    }
+    CHECK(out == std::vector<int>{98, 96, 94, 92, 90});
+}
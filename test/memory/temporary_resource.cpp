@@ -0,0 +1,200 @@
+// nanorange/test/memory/temporary_resource.cpp
+//
+// Copyright (c) 2019 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <nanorange/memory/temporary_resource.hpp>
+#include <nanorange/algorithm/adaptive_stable_sort.hpp>
+#include <nanorange/algorithm/inplace_merge.hpp>
+#include <nanorange/algorithm/is_partitioned.hpp>
+#include <nanorange/algorithm/is_sorted.hpp>
+#include <nanorange/algorithm/sort.hpp>
+#include <nanorange/algorithm/stable_partition.hpp>
+#include <nanorange/algorithm/stable_sort.hpp>
+
+#include <algorithm>
+#include <random>
+#include <new>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../catch.hpp"
+
+#ifdef NANO_HAS_MEMORY_RESOURCE
+
+namespace {
+
+// Forwards to an upstream resource, counting the calls. Allocations beyond
+// max_allocations (if it isn't negative) fail.
+struct counting_resource : std::pmr::memory_resource {
+    explicit counting_resource(std::pmr::memory_resource* upstream
+                               = std::pmr::new_delete_resource())
+        : upstream(upstream)
+    {}
+
+    std::pmr::memory_resource* upstream;
+    int allocations = 0;
+    int deallocations = 0;
+    int max_allocations = -1;
+
+private:
+    void* do_allocate(std::size_t bytes, std::size_t align) override
+    {
+        if (max_allocations >= 0 && allocations >= max_allocations) {
+            throw std::bad_alloc{};
+        }
+        ++allocations;
+        return upstream->allocate(bytes, align);
+    }
+
+    void do_deallocate(void* p, std::size_t bytes, std::size_t align) override
+    {
+        ++deallocations;
+        upstream->deallocate(p, bytes, align);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const
+        noexcept override
+    {
+        return this == &other;
+    }
+};
+
+std::vector<std::string> make_strings(int n)
+{
+    std::mt19937 gen;
+    std::vector<std::string> vec(n);
+    for (auto& s : vec) {
+        s = std::to_string(gen() % 100) + " is a long enough string";
+    }
+    return vec;
+}
+
+}
+
+TEST_CASE("memory.temporary_resource")
+{
+    counting_resource res;
+
+    SECTION("scoped_temporary_resource restores the previous resource")
+    {
+        CHECK(nano::get_temporary_resource() == nullptr);
+        {
+            nano::scoped_temporary_resource guard(&res);
+            CHECK(nano::get_temporary_resource() == &res);
+            {
+                nano::scoped_temporary_resource inner(nullptr);
+                CHECK(nano::get_temporary_resource() == nullptr);
+            }
+            CHECK(nano::get_temporary_resource() == &res);
+        }
+        CHECK(nano::get_temporary_resource() == nullptr);
+    }
+
+    SECTION("algorithms allocate from the resource")
+    {
+        nano::scoped_temporary_resource guard(&res);
+
+        auto vec = make_strings(1000);
+        nano::stable_sort(vec);
+        CHECK(nano::is_sorted(vec));
+        CHECK(res.allocations == 1);
+        CHECK(res.deallocations == 1);
+
+        auto vec2 = make_strings(1000);
+        nano::sort(vec2.begin(), vec2.begin() + 300);
+        nano::sort(vec2.begin() + 300, vec2.end());
+        nano::inplace_merge(vec2, vec2.begin() + 300);
+        CHECK(nano::is_sorted(vec2));
+        CHECK(res.allocations == 2);
+
+        const auto starts_low = [](const std::string& s) { return s[0] < '5'; };
+        auto vec3 = make_strings(1000);
+        nano::stable_partition(vec3, starts_low);
+        CHECK(nano::is_partitioned(vec3, starts_low));
+        CHECK(res.allocations == 3);
+        CHECK(res.deallocations == 3);
+
+        // Small ranges don't ask for a buffer at all
+        std::vector<int> small{3, 2, 1};
+        nano::stable_sort(small);
+        CHECK(res.allocations == 3);
+
+        auto vec4 = make_strings(1000);
+        nano::adaptive_stable_sort(vec4);
+        CHECK(nano::is_sorted(vec4));
+        CHECK(res.allocations == 4);
+        CHECK(res.deallocations == 4);
+
+        // Nor do ranges which turn out to be sorted already
+        nano::adaptive_stable_sort(vec4);
+        CHECK(res.allocations == 4);
+    }
+
+    SECTION("a reused stable_sort_buffer allocates once")
+    {
+        nano::scoped_temporary_resource guard(&res);
+        nano::stable_sort_buffer<std::string> buf;
+
+        for (int i = 0; i < 5; i++) {
+            auto vec = make_strings(1000);
+            nano::stable_sort(vec, buf);
+            CHECK(nano::is_sorted(vec));
+        }
+        CHECK(res.allocations == 1);
+        CHECK(res.deallocations == 0);
+    }
+
+    SECTION("algorithms fall back when the resource fails")
+    {
+        counting_resource failing(std::pmr::null_memory_resource());
+        nano::scoped_temporary_resource guard(&failing);
+
+        auto vec = make_strings(1000);
+        auto expected = vec;
+        std::stable_sort(expected.begin(), expected.end());
+        nano::stable_sort(vec);
+        CHECK(vec == expected);
+
+        const auto starts_low = [](const std::string& s) { return s[0] < '5'; };
+        auto vec2 = make_strings(1000);
+        nano::stable_partition(vec2, starts_low);
+        CHECK(nano::is_partitioned(vec2, starts_low));
+        CHECK(failing.allocations == 2);
+
+        auto vec3 = make_strings(1000);
+        nano::adaptive_stable_sort(vec3);
+        CHECK(vec3 == expected);
+        CHECK(failing.allocations == 3);
+    }
+
+    SECTION("a stable_sort_buffer which can't grow isn't overrun")
+    {
+        using P = std::pair<int, int>;
+        res.max_allocations = 1;
+        nano::scoped_temporary_resource guard(&res);
+        nano::stable_sort_buffer<P> buf(8);
+
+        std::mt19937 gen;
+        for (int n : {200, 1000}) {
+            std::vector<P> vec;
+            for (int i = 0; i < n; ++i) {
+                vec.emplace_back(static_cast<int>(gen() % 50), i);
+            }
+            auto expected = vec;
+            std::stable_sort(expected.begin(), expected.end(),
+                             [](const P& a, const P& b) {
+                                 return a.first < b.first;
+                             });
+            nano::stable_sort(vec, buf, nano::less{}, &P::first);
+            CHECK(vec == expected);
+        }
+        CHECK(buf.capacity() == 8);
+    }
+
+    CHECK(res.allocations == res.deallocations);
+}
+
+#endif // NANO_HAS_MEMORY_RESOURCE
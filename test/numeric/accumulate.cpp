@@ -0,0 +1,57 @@
+// test/numeric/accumulate.cpp
+//
+// Copyright (c) 2020 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <nanorange/numeric/accumulate.hpp>
+
+#include <functional>
+#include <list>
+#include <string>
+#include <vector>
+
+#include "../catch.hpp"
+#include "../test_iterators.hpp"
+
+namespace {
+
+struct S {
+	int i;
+};
+
+constexpr bool test_constexpr()
+{
+	int arr[] = {1, 2, 3, 4, 5};
+	return nano::accumulate(arr, 0) == 15 &&
+	       nano::accumulate(arr, arr + 5, 1, std::multiplies<>{}) == 120;
+}
+
+}
+
+TEST_CASE("numeric.accumulate")
+{
+	const int ia[] = {1, 2, 3, 4, 5, 6};
+	using I = input_iterator<const int*>;
+
+	CHECK(nano::accumulate(I(ia), I(ia), 0) == 0);
+	CHECK(nano::accumulate(I(ia), I(ia + 6), 0) == 21);
+	CHECK(nano::accumulate(I(ia), sentinel<const int*>(ia + 6), 10) == 31);
+	CHECK(nano::accumulate(ia, 1, std::multiplies<>{}) == 720);
+
+	// The fold is strictly left to right
+	const std::list<std::string> strs{"a", "b", "c"};
+	CHECK(nano::accumulate(strs, std::string("x")) == "xabc");
+	CHECK(nano::accumulate(strs, std::string("x"),
+	                       [](std::string a, const std::string& b) {
+		                       return b + a;
+	                       }) == "cbax");
+
+	// Projections
+	const std::vector<S> vec{{1}, {2}, {3}};
+	CHECK(nano::accumulate(vec, 0, std::plus<>{}, &S::i) == 6);
+	CHECK(nano::accumulate(vec.begin(), vec.end(), 0.5, std::plus<>{},
+	                       &S::i) == 6.5);
+
+	static_assert(test_constexpr());
+}
@@ -0,0 +1,167 @@
+// test/numeric/exclusive_scan.cpp
+//
+// Copyright (c) 2020 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <nanorange/numeric/exclusive_scan.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../catch.hpp"
+#include "../test_iterators.hpp"
+
+namespace {
+
+struct S {
+	int i;
+};
+
+constexpr bool test_constexpr()
+{
+	int in[] = {1, 2, 3, 4};
+	int out[4] = {};
+	const auto res = nano::exclusive_scan(in, out, 10);
+	return res.in == in + 4 && res.out == out + 4 && out[0] == 10 &&
+	       out[1] == 11 && out[2] == 13 && out[3] == 16;
+}
+
+}
+
+TEST_CASE("numeric.exclusive_scan")
+{
+	const int ia[] = {1, 2, 3, 4, 5};
+	const int sums[] = {0, 1, 3, 6, 10};
+	int out[5] = {};
+
+	using I = input_iterator<const int*>;
+	using O = output_iterator<int*>;
+	auto r = nano::exclusive_scan(I(ia), I(ia + 5), O(out), 0);
+	CHECK(r.in == I(ia + 5));
+	CHECK(r.out.base() == out + 5);
+	CHECK(std::equal(out, out + 5, sums));
+
+	CHECK(nano::exclusive_scan(ia, ia, out, 0).out == out);
+
+	// In place, with an operation and a projection
+	std::vector<S> vec{{1}, {2}, {3}, {4}};
+	std::vector<int> prods(4);
+	nano::exclusive_scan(vec, prods.begin(), 1, std::multiplies<>{}, &S::i);
+	CHECK(prods == std::vector<int>{1, 1, 2, 6});
+	nano::exclusive_scan(prods, prods.begin(), 0);
+	CHECK(prods == std::vector<int>{0, 1, 2, 4});
+
+	// The type of the result is that of init
+	const char cs[] = {100, 100, 100};
+	std::vector<int> big(3);
+	nano::exclusive_scan(cs, big.begin(), 1000);
+	CHECK(big == std::vector<int>{1000, 1100, 1200});
+
+	const std::vector<std::string> strs{"a", "b", "c"};
+	std::vector<std::string> cat(3);
+	nano::exclusive_scan(nano::seq, strs, cat.begin(), std::string(">"));
+	CHECK(cat == std::vector<std::string>{">", ">a", ">ab"});
+
+	static_assert(test_constexpr());
+}
+
+TEST_CASE("numeric.exclusive_scan.par")
+{
+	std::mt19937 gen{};
+
+	// A histogram to offsets conversion, as used by counting sorts
+	for (std::size_t size : {1u, 100u, 16'384u, 16'385u, 100'000u, 1'000'003u}) {
+		std::vector<unsigned> counts(size);
+		for (auto& c : counts) {
+			c = gen() % 100;
+		}
+		std::vector<unsigned long long> expected(size);
+		unsigned long long acc = 7;
+		for (std::size_t i = 0; i < size; i++) {
+			expected[i] = acc;
+			acc += counts[i];
+		}
+
+		nano::thread_pool pool(4);
+		std::vector<unsigned long long> out(size);
+		const auto r = nano::exclusive_scan(nano::par.on(pool), counts,
+		                                    out.begin(), 7ULL);
+		CHECK(r.in == counts.end());
+		CHECK(r.out == out.end());
+		CHECK(out == expected);
+
+		std::fill(out.begin(), out.end(), 0);
+		nano::exclusive_scan(nano::seq, counts.begin(), counts.end(),
+		                     out.begin(), 7ULL);
+		CHECK(out == expected);
+
+		// In place
+		std::vector<unsigned long long> inplace(counts.begin(), counts.end());
+		nano::exclusive_scan(nano::par, inplace, inplace.begin(), 7ULL);
+		CHECK(inplace == expected);
+	}
+
+	// Floating-point results do not depend on the number of threads
+	std::uniform_real_distribution<double> dist(-1.0, 1.0);
+	std::vector<double> in(300'000);
+	for (auto& d : in) {
+		d = dist(gen);
+	}
+	std::vector<double> expected(in.size());
+	nano::exclusive_scan(nano::seq, in, expected.begin(), 0.5);
+	for (std::size_t threads : {1u, 2u, 3u, 8u}) {
+		nano::thread_pool pool(threads);
+		std::vector<double> out(in.size());
+		nano::exclusive_scan(nano::par.on(pool), in, out.begin(), 0.5);
+		CHECK(std::memcmp(out.data(), expected.data(),
+		                  out.size() * sizeof(double)) == 0);
+	}
+}
+
+namespace {
+
+template <typename T>
+void test_simd()
+{
+	std::mt19937_64 gen{};
+
+	for (std::size_t size : {0u, 1u, 3u, 4u, 7u, 8u, 9u, 31u, 64u, 1000u,
+	                         16'383u, 16'384u, 40'000u}) {
+		std::vector<T> in(size);
+		for (auto& i : in) {
+			i = static_cast<T>(gen() % 1000);
+		}
+		const T init = std::is_unsigned<T>::value ? T(-3) : T(-3000);
+		std::vector<T> expected(size);
+		T acc = init;
+		for (std::size_t i = 0; i < size; i++) {
+			expected[i] = acc;
+			acc = static_cast<T>(acc + in[i]);
+		}
+
+		std::vector<T> out(size);
+		nano::exclusive_scan(in, out.begin(), init);
+		CHECK(out == expected);
+		nano::exclusive_scan(nano::seq, in.data(), in.data() + size,
+		                     out.begin(), init, std::plus<T>{});
+		CHECK(out == expected);
+		nano::thread_pool pool(3);
+		nano::exclusive_scan(nano::par.on(pool), in, in.begin(), init);
+		CHECK(in == expected);
+	}
+}
+
+}
+
+TEST_CASE("numeric.exclusive_scan.simd")
+{
+	test_simd<int>();
+	test_simd<unsigned>();
+	test_simd<long long>();
+	test_simd<unsigned long long>();
+}
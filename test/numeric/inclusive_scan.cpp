@@ -0,0 +1,243 @@
+// test/numeric/inclusive_scan.cpp
+//
+// Copyright (c) 2020 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <nanorange/iterator/ostream_iterator.hpp>
+#include <nanorange/numeric/inclusive_scan.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <functional>
+#include <numeric>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../catch.hpp"
+#include "../test_iterators.hpp"
+
+namespace {
+
+struct S {
+	int i;
+};
+
+// Can be accumulated, but not copied
+struct move_only_int {
+	int i;
+
+	move_only_int(int i) : i(i) {}
+	move_only_int(move_only_int&&) = default;
+	move_only_int& operator=(move_only_int&&) = default;
+
+	operator int() const { return i; }
+};
+
+struct move_only_plus {
+	move_only_int operator()(move_only_int&& a, move_only_int&& b) const
+	{
+		return {a.i + b.i};
+	}
+};
+
+struct to_move_only {
+	move_only_int operator()(int i) const { return {i}; }
+};
+
+constexpr bool test_constexpr()
+{
+	int in[] = {1, 2, 3, 4};
+	int out[4] = {};
+	const auto res = nano::inclusive_scan(in, out);
+	return res.in == in + 4 && res.out == out + 4 && out[0] == 1 &&
+	       out[1] == 3 && out[2] == 6 && out[3] == 10;
+}
+
+}
+
+TEST_CASE("numeric.inclusive_scan")
+{
+	const int ia[] = {1, 2, 3, 4, 5};
+	const int sums[] = {1, 3, 6, 10, 15};
+	int out[5] = {};
+
+	using I = input_iterator<const int*>;
+	using O = output_iterator<int*>;
+	auto r = nano::inclusive_scan(I(ia), I(ia + 5), O(out));
+	CHECK(r.in == I(ia + 5));
+	CHECK(r.out.base() == out + 5);
+	CHECK(std::equal(out, out + 5, sums));
+
+	// Empty input
+	CHECK(nano::inclusive_scan(ia, ia, out).out == out);
+
+	// In place, with an operation and a projection
+	std::vector<S> vec{{1}, {2}, {3}, {4}};
+	std::vector<int> prods(4);
+	nano::inclusive_scan(vec, prods.begin(), std::multiplies<>{}, &S::i);
+	CHECK(prods == std::vector<int>{1, 2, 6, 24});
+	nano::inclusive_scan(prods, prods.begin());
+	CHECK(prods == std::vector<int>{1, 3, 9, 33});
+
+	// Output to a stream
+	std::ostringstream os;
+	nano::inclusive_scan(ia, nano::ostream_iterator<int>(os, " "));
+	CHECK(os.str() == "1 3 6 10 15 ");
+
+	// The order of operands is preserved
+	const std::vector<std::string> strs{"a", "b", "c"};
+	std::vector<std::string> cat(3);
+	nano::inclusive_scan(nano::seq, strs, cat.begin());
+	CHECK(cat == std::vector<std::string>{"a", "ab", "abc"});
+
+	static_assert(test_constexpr());
+}
+
+TEST_CASE("numeric.inclusive_scan.par")
+{
+	// The carries are copied between chunks
+	static_assert(nano::detail::reducible<move_only_plus, move_only_int,
+	                                      move_only_int>);
+	static_assert(!std::is_invocable_v<decltype(nano::inclusive_scan),
+	                                   const nano::parallel_policy&,
+	                                   std::vector<int>&, int*,
+	                                   move_only_plus, to_move_only>);
+
+	std::mt19937 gen{};
+
+	for (std::size_t size : {1u, 100u, 16'384u, 16'385u, 100'000u, 1'000'003u}) {
+		std::vector<long long> in(size);
+		for (auto& i : in) {
+			i = static_cast<long long>(gen() % 1000);
+		}
+		std::vector<long long> expected(size);
+		std::partial_sum(in.begin(), in.end(), expected.begin());
+
+		std::vector<long long> out(size);
+		nano::thread_pool pool(4);
+		const auto r = nano::inclusive_scan(nano::par.on(pool), in, out.begin());
+		CHECK(r.in == in.end());
+		CHECK(r.out == out.end());
+		CHECK(out == expected);
+
+		std::fill(out.begin(), out.end(), 0);
+		nano::inclusive_scan(nano::seq, in.begin(), in.end(), out.begin());
+		CHECK(out == expected);
+
+		// In place
+		nano::inclusive_scan(nano::par, in, in.begin());
+		CHECK(in == expected);
+	}
+
+	// Floating-point results do not depend on the number of threads
+	std::uniform_real_distribution<double> dist(-1.0, 1.0);
+	std::vector<double> in(300'000);
+	for (auto& d : in) {
+		d = dist(gen);
+	}
+	std::vector<double> expected(in.size());
+	nano::inclusive_scan(nano::seq, in, expected.begin());
+	for (std::size_t threads : {1u, 2u, 3u, 8u}) {
+		nano::thread_pool pool(threads);
+		std::vector<double> out(in.size());
+		nano::inclusive_scan(nano::par.on(pool), in, out.begin());
+		CHECK(std::memcmp(out.data(), expected.data(),
+		                  out.size() * sizeof(double)) == 0);
+	}
+
+	// Nor on the grain size, which sets the least work for one task: one
+	// larger than the input keeps the scan on this thread
+	{
+		nano::thread_pool pool(4);
+		for (std::size_t grain : {1u, 20'000u, 100'000u}) {
+			std::vector<double> out(in.size());
+			nano::inclusive_scan(nano::par.on(pool).with_grain_size(grain), in,
+			                     out.begin());
+			CHECK(std::memcmp(out.data(), expected.data(),
+			                  out.size() * sizeof(double)) == 0);
+		}
+
+		const auto self = std::this_thread::get_id();
+		std::atomic<int> elsewhere{0};
+		const auto same_thread = [&](double a, double b) {
+			if (std::this_thread::get_id() != self) ++elsewhere;
+			return a + b;
+		};
+		std::vector<double> out(in.size());
+		nano::inclusive_scan(nano::par.on(pool).with_grain_size(in.size()), in,
+		                     out.begin(), same_thread);
+		CHECK(std::memcmp(out.data(), expected.data(),
+		                  out.size() * sizeof(double)) == 0);
+		CHECK(elsewhere.load() == 0);
+	}
+
+	// Exceptions propagate to the caller
+	std::vector<int> ints(200'000, 1);
+	const auto thrower = [](int a, int b) {
+		if (a + b == 150'000) {
+			throw std::runtime_error("oops");
+		}
+		return a + b;
+	};
+	CHECK_THROWS_AS(nano::inclusive_scan(nano::par, ints, ints.begin(), thrower),
+	                std::runtime_error);
+}
+
+namespace {
+
+template <typename T>
+void test_simd()
+{
+	std::mt19937_64 gen{};
+
+	for (std::size_t size : {0u, 1u, 3u, 4u, 7u, 8u, 9u, 31u, 64u, 1000u,
+	                         16'383u, 16'384u, 40'000u}) {
+		std::vector<T> in(size);
+		for (auto& i : in) {
+			// Large values, so that the sums overflow
+			i = static_cast<T>(gen());
+		}
+		if constexpr (std::is_unsigned<T>::value) {
+			std::vector<T> expected(size);
+			std::partial_sum(in.begin(), in.end(), expected.begin());
+
+			std::vector<T> out(size);
+			nano::inclusive_scan(in, out.begin());
+			CHECK(out == expected);
+			nano::inclusive_scan(nano::par, in.begin(), in.end(), out.data());
+			CHECK(out == expected);
+			nano::inclusive_scan(in, in.begin());
+			CHECK(in == expected);
+		} else {
+			// Avoid signed overflow in the reference computation
+			for (auto& i : in) {
+				i /= static_cast<T>(size + 1);
+			}
+			std::vector<T> expected(size);
+			std::partial_sum(in.begin(), in.end(), expected.begin());
+
+			std::vector<T> out(size);
+			nano::inclusive_scan(in, out.begin(), std::plus<T>{});
+			CHECK(out == expected);
+			nano::thread_pool pool(3);
+			nano::inclusive_scan(nano::par.on(pool), in, in.begin());
+			CHECK(in == expected);
+		}
+	}
+}
+
+}
+
+TEST_CASE("numeric.inclusive_scan.simd")
+{
+	test_simd<int>();
+	test_simd<unsigned>();
+	test_simd<long long>();
+	test_simd<unsigned long long>();
+}
@@ -0,0 +1,146 @@
+// test/numeric/reduce.cpp
+//
+// Copyright (c) 2020 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <nanorange/numeric/reduce.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <functional>
+#include <list>
+#include <random>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "../catch.hpp"
+#include "../test_iterators.hpp"
+
+namespace {
+
+struct S {
+	double d;
+};
+
+constexpr bool test_constexpr()
+{
+	int arr[5000] = {};
+	for (int i = 0; i < 5000; i++) {
+		arr[i] = i;
+	}
+	return nano::reduce(arr, 0) == 4999 * 5000 / 2;
+}
+
+bool same_bits(double a, double b)
+{
+	return std::memcmp(&a, &b, sizeof(double)) == 0;
+}
+
+}
+
+TEST_CASE("numeric.reduce")
+{
+	const int ia[] = {1, 2, 3, 4, 5, 6};
+	using I = input_iterator<const int*>;
+
+	CHECK(nano::reduce(ia, 0) == 21);
+	CHECK(nano::reduce(ia, ia, 7) == 7);
+	CHECK(nano::reduce(I(ia), I(ia + 6), 1, std::multiplies<>{}) == 720);
+	CHECK(nano::reduce(std::list<int>(ia, ia + 6), 0) == 21);
+	CHECK(nano::reduce(nano::seq, ia, 0) == 21);
+	CHECK(nano::reduce(nano::par, ia, ia + 6, 0) == 21);
+
+	const std::vector<S> vec{{0.5}, {1.5}, {2.0}};
+	CHECK(nano::reduce(vec, 0.0, std::plus<>{}, &S::d) == 4.0);
+
+	static_assert(test_constexpr());
+}
+
+TEST_CASE("numeric.reduce.deterministic")
+{
+	// Floating-point addition is not associative, so this checks that the
+	// elements are combined in the same order whatever the policy and
+	// number of threads
+	std::mt19937 gen{};
+	std::uniform_real_distribution<double> dist(-1e6, 1e6);
+
+	for (std::size_t size : {1u, 2047u, 2048u, 2049u, 100'000u, 1'000'003u}) {
+		std::vector<double> vec(size);
+		for (auto& d : vec) {
+			d = dist(gen) * (gen() % 2 ? 1e-9 : 1.0);
+		}
+
+		const double expected = nano::reduce(vec, 0.25);
+		CHECK(same_bits(nano::reduce(nano::seq, vec, 0.25), expected));
+		CHECK(same_bits(nano::reduce(nano::par, vec, 0.25), expected));
+		for (std::size_t threads : {1u, 2u, 3u, 8u}) {
+			nano::thread_pool pool(threads);
+			CHECK(same_bits(nano::reduce(nano::par.on(pool), vec.begin(),
+			                             vec.end(), 0.25),
+			                expected));
+		}
+	}
+}
+
+TEST_CASE("numeric.reduce.par")
+{
+	nano::thread_pool pool(4);
+	const auto policy = nano::par.on(pool);
+
+	std::vector<long long> vec(1'000'000);
+	for (std::size_t i = 0; i < vec.size(); i++) {
+		vec[i] = static_cast<long long>(i);
+	}
+	const long long n = static_cast<long long>(vec.size());
+	CHECK(nano::reduce(policy, vec, 0LL) == n * (n - 1) / 2);
+
+	// Non-commutative operation: the elements must stay in order
+	std::vector<std::vector<int>> vecs(100'000);
+	for (std::size_t i = 0; i < vecs.size(); i++) {
+		vecs[i] = {static_cast<int>(i)};
+	}
+	const auto concat = [](std::vector<int> a, const std::vector<int>& b) {
+		a.insert(a.end(), b.begin(), b.end());
+		return a;
+	};
+	const auto joined = nano::reduce(policy, vecs, std::vector<int>{-1}, concat);
+	REQUIRE(joined.size() == vecs.size() + 1);
+	CHECK(joined[0] == -1);
+	CHECK(std::is_sorted(joined.begin(), joined.end()));
+
+	// Exceptions propagate to the caller
+	const auto thrower = [](long long a, long long b) {
+		if (b == 500'000) {
+			throw std::runtime_error("oops");
+		}
+		return a + b;
+	};
+	CHECK_THROWS_AS(nano::reduce(policy, vec, 0LL, thrower), std::runtime_error);
+
+	// The grain size is the least work for one task: larger than the input
+	// keeps it on this thread, and any grain size gives the same result
+	{
+		const auto self = std::this_thread::get_id();
+		std::atomic<int> elsewhere{0};
+		const auto same_thread = [&](long long a, long long b) {
+			if (std::this_thread::get_id() != self) ++elsewhere;
+			return a + b;
+		};
+		CHECK(nano::reduce(policy.with_grain_size(vec.size()), vec, 0LL,
+		                   same_thread) == n * (n - 1) / 2);
+		CHECK(elsewhere.load() == 0);
+
+		std::mt19937 gen{};
+		std::uniform_real_distribution<double> dist(-1.0, 1.0);
+		std::vector<double> dbl(300'000);
+		for (auto& d : dbl) d = dist(gen);
+		const double expected = nano::reduce(nano::seq, dbl, 0.0);
+		for (std::size_t grain : {1u, 5000u, 100'000u}) {
+			CHECK(nano::reduce(policy.with_grain_size(grain), dbl, 0.0) ==
+			      expected);
+		}
+	}
+}
@@ -0,0 +1,117 @@
+// test/numeric/transform_reduce.cpp
+//
+// Copyright (c) 2020 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <nanorange/numeric/transform_reduce.hpp>
+
+#include <cstring>
+#include <functional>
+#include <list>
+#include <random>
+#include <vector>
+
+#include "../catch.hpp"
+#include "../test_iterators.hpp"
+
+namespace {
+
+struct S {
+	int i;
+};
+
+constexpr bool test_constexpr()
+{
+	int a[] = {1, 2, 3};
+	int b[] = {4, 5, 6};
+	return nano::transform_reduce(a, b, 0) == 32 &&
+	       nano::transform_reduce(a, 0, std::plus<>{},
+	                              [](int i) { return i * i; }) == 14;
+}
+
+bool same_bits(double a, double b)
+{
+	return std::memcmp(&a, &b, sizeof(double)) == 0;
+}
+
+}
+
+TEST_CASE("numeric.transform_reduce.unary")
+{
+	const int ia[] = {1, 2, 3, 4};
+	const auto sq = [](int i) { return i * i; };
+	using I = input_iterator<const int*>;
+
+	CHECK(nano::transform_reduce(ia, 0, std::plus<>{}, sq) == 30);
+	CHECK(nano::transform_reduce(I(ia), I(ia + 4), 1, std::multiplies<>{},
+	                             sq) == 576);
+	CHECK(nano::transform_reduce(std::list<int>(ia, ia + 4), 0, std::plus<>{},
+	                             sq) == 30);
+
+	const std::vector<S> vec{{1}, {2}, {3}};
+	CHECK(nano::transform_reduce(vec, 0, std::plus<>{}, sq, &S::i) == 14);
+	CHECK(nano::transform_reduce(nano::seq, vec, 0, std::plus<>{}, sq,
+	                             &S::i) == 14);
+	CHECK(nano::transform_reduce(nano::par, vec.begin(), vec.end(), 0,
+	                             std::plus<>{}, sq, &S::i) == 14);
+
+	static_assert(test_constexpr());
+}
+
+TEST_CASE("numeric.transform_reduce.binary")
+{
+	const int a[] = {1, 2, 3, 4};
+	const int b[] = {5, 6, 7, 8, 9};
+
+	// Inner product by default
+	CHECK(nano::transform_reduce(a, a + 4, b, 0) == 70);
+	CHECK(nano::transform_reduce(a, b, 0) == 70);
+	CHECK(nano::transform_reduce(a, a + 4, b, 0, std::plus<>{},
+	                             std::plus<>{}) == 36);
+
+	// The range overloads stop at the end of the shorter range
+	CHECK(nano::transform_reduce(b, a, 0) == 70);
+	const std::list<int> la(a, a + 4);
+	CHECK(nano::transform_reduce(b, la, 0) == 70);
+
+	// Projections
+	const std::vector<S> sa{{1}, {2}, {3}, {4}};
+	CHECK(nano::transform_reduce(sa, b, 0, std::plus<>{}, std::multiplies<>{},
+	                             &S::i) == 70);
+	CHECK(nano::transform_reduce(nano::par, b, sa, 0, std::plus<>{},
+	                             std::multiplies<>{}, {}, &S::i) == 70);
+	CHECK(nano::transform_reduce(nano::seq, sa.begin(), sa.end(), b, 0,
+	                             std::plus<>{}, std::multiplies<>{},
+	                             &S::i) == 70);
+}
+
+TEST_CASE("numeric.transform_reduce.par")
+{
+	std::mt19937 gen{};
+	std::uniform_real_distribution<double> dist(-1.0, 1.0);
+	std::vector<double> x(750'001), y(750'001);
+	for (std::size_t i = 0; i < x.size(); i++) {
+		x[i] = dist(gen);
+		y[i] = dist(gen);
+	}
+
+	const double dot = nano::transform_reduce(x, y, 0.0);
+	const double norm = nano::transform_reduce(x, 0.0, std::plus<>{},
+	                                           [](double d) { return d * d; });
+	for (std::size_t threads : {1u, 2u, 5u}) {
+		nano::thread_pool pool(threads);
+		const auto policy = nano::par.on(pool);
+		CHECK(same_bits(nano::transform_reduce(policy, x, y, 0.0), dot));
+		CHECK(same_bits(nano::transform_reduce(policy, x.begin(), x.end(),
+		                                       y.begin(), 0.0),
+		                dot));
+		CHECK(same_bits(nano::transform_reduce(policy, x, 0.0, std::plus<>{},
+		                                       [](double d) { return d * d; }),
+		                norm));
+	}
+
+	std::vector<int> v(1'000'000, 1);
+	CHECK(nano::transform_reduce(nano::par, v, 0LL, std::plus<>{},
+	                             [](int i) { return 3LL * i; }) == 3'000'000);
+}
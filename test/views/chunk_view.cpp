@@ -0,0 +1,185 @@
+// test/views/chunk_view.cpp
+//
+// Copyright (c) 2020 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <nanorange/views/chunk.hpp>
+
+#include <nanorange/algorithm/equal.hpp>
+#include <nanorange/views/filter.hpp>
+#include <nanorange/views/iota.hpp>
+#include <nanorange/views/reverse.hpp>
+#include <nanorange/views/transform.hpp>
+
+#include <forward_list>
+#include <list>
+#include <vector>
+
+#include "../catch.hpp"
+#include "../test_utils.hpp"
+
+namespace {
+
+template <typename Rng>
+std::vector<std::vector<int>> to_vectors(Rng&& rng)
+{
+    std::vector<std::vector<int>> out;
+    for (auto&& chunk : rng) {
+        out.emplace_back(nano::begin(chunk), nano::end(chunk));
+    }
+    return out;
+}
+
+constexpr bool test_constexpr()
+{
+    int arr[] = {1, 2, 3, 4, 5};
+    auto rng = arr | nano::views::chunk(2);
+    auto it = nano::begin(rng);
+    return nano::size(rng) == 3 &&
+           nano::equal(*it, nano::views::iota(1, 3)) &&
+           nano::equal(*++it, nano::views::iota(3, 5)) &&
+           nano::equal(*++it, nano::views::iota(5, 6)) &&
+           ++it == nano::end(rng);
+}
+
+}
+
+TEST_CASE("views.chunk")
+{
+    using nano::views::chunk;
+
+    SECTION("random-access range")
+    {
+        std::vector<int> vec{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+        auto rng = vec | chunk(3);
+        using R = decltype(rng);
+        static_assert(nano::view<R>);
+        static_assert(nano::random_access_range<R>);
+        static_assert(nano::common_range<R>);
+        static_assert(nano::sized_range<R>);
+        static_assert(nano::same_as<nano::range_value_t<R>,
+                      nano::subrange<std::vector<int>::iterator>>);
+
+        CHECK(nano::size(rng) == 4);
+        CHECK(nano::distance(rng.begin(), rng.end()) == 4);
+        CHECK(to_vectors(rng) == std::vector<std::vector<int>>{
+                  {0, 1, 2}, {3, 4, 5}, {6, 7, 8}, {9}});
+
+        auto it = rng.begin();
+        CHECK(nano::equal(it[2], std::vector<int>{6, 7, 8}));
+        CHECK(nano::equal(*(it + 3), std::vector<int>{9}));
+        CHECK(it + 4 == rng.end());
+        CHECK(rng.end() - it == 4);
+        CHECK(nano::equal(*(rng.end() - 1), std::vector<int>{9}));
+        CHECK(nano::equal(*(rng.end() - 2), std::vector<int>{6, 7, 8}));
+
+        // Stepping backwards from the end goes via the short final chunk
+        ::check_equal(rng | nano::views::reverse | nano::views::transform(
+                          [](auto c) { return *nano::begin(c); }),
+                      {9, 6, 3, 0});
+    }
+
+    SECTION("exact multiple")
+    {
+        std::vector<int> vec{0, 1, 2, 3, 4, 5};
+        auto rng = vec | chunk(2);
+        CHECK(nano::size(rng) == 3);
+        CHECK(to_vectors(rng) == std::vector<std::vector<int>>{
+                  {0, 1}, {2, 3}, {4, 5}});
+        CHECK(nano::equal(*(rng.end() - 1), std::vector<int>{4, 5}));
+    }
+
+    SECTION("chunk larger than range")
+    {
+        std::vector<int> vec{0, 1, 2};
+        auto rng = vec | chunk(5);
+        CHECK(nano::size(rng) == 1);
+        CHECK(to_vectors(rng) == std::vector<std::vector<int>>{{0, 1, 2}});
+    }
+
+    SECTION("empty range")
+    {
+        std::vector<int> vec;
+        auto rng = vec | chunk(3);
+        CHECK(nano::size(rng) == 0);
+        CHECK(rng.begin() == rng.end());
+        CHECK(rng.empty());
+    }
+
+    SECTION("bidirectional range")
+    {
+        std::list<int> list{0, 1, 2, 3, 4, 5, 6};
+        auto rng = nano::views::chunk(list, 3);
+        using R = decltype(rng);
+        static_assert(nano::bidirectional_range<R>);
+        static_assert(!nano::random_access_range<R>);
+        static_assert(nano::sized_range<R>);
+        static_assert(nano::common_range<R>);
+
+        CHECK(nano::size(rng) == 3);
+        CHECK(to_vectors(rng) == std::vector<std::vector<int>>{
+                  {0, 1, 2}, {3, 4, 5}, {6}});
+
+        auto it = nano::end(rng);
+        --it;
+        CHECK(nano::equal(*it, std::vector<int>{6}));
+        --it;
+        CHECK(nano::equal(*it, std::vector<int>{3, 4, 5}));
+    }
+
+    SECTION("forward range")
+    {
+        std::forward_list<int> list{0, 1, 2, 3, 4};
+        auto rng = list | chunk(2);
+        using R = decltype(rng);
+        static_assert(nano::forward_range<R>);
+        static_assert(!nano::bidirectional_range<R>);
+        static_assert(nano::common_range<R>);
+
+        CHECK(to_vectors(rng) == std::vector<std::vector<int>>{
+                  {0, 1}, {2, 3}, {4}});
+    }
+
+    SECTION("non-common range")
+    {
+        auto rng = nano::views::iota(0) | nano::views::chunk(4);
+        static_assert(!nano::common_range<decltype(rng)>);
+        static_assert(nano::random_access_range<decltype(rng)>);
+
+        auto it = rng.begin();
+        CHECK(nano::equal(it[1], nano::views::iota(4, 8)));
+        it += 10;
+        CHECK(*nano::begin(*it) == 40);
+    }
+
+    SECTION("non-common sized range")
+    {
+        auto rng = nano::views::iota(0, 7) | nano::views::chunk(3);
+        CHECK(nano::size(rng) == 3);
+        CHECK(to_vectors(rng) == std::vector<std::vector<int>>{
+                  {0, 1, 2}, {3, 4, 5}, {6}});
+    }
+
+    SECTION("const iteration")
+    {
+        const std::vector<int> vec{0, 1, 2, 3};
+        const auto rng = vec | chunk(2);
+        CHECK(to_vectors(rng) == std::vector<std::vector<int>>{{0, 1}, {2, 3}});
+    }
+
+    SECTION("non-simple view")
+    {
+        std::vector<int> vec{0, 1, 2, 3, 4, 5};
+        auto rng = vec |
+                   nano::views::filter([](int i) { return i % 2 == 0; }) |
+                   chunk(2);
+        CHECK(to_vectors(rng) == std::vector<std::vector<int>>{{0, 2}, {4}});
+    }
+
+    SECTION("constexpr")
+    {
+        static_assert(test_constexpr());
+    }
+}
@@ -0,0 +1,191 @@
+// test/views/slide_view.cpp
+//
+// Copyright (c) 2020 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <nanorange/views/slide.hpp>
+
+#include <nanorange/algorithm/equal.hpp>
+#include <nanorange/views/filter.hpp>
+#include <nanorange/views/iota.hpp>
+#include <nanorange/views/reverse.hpp>
+#include <nanorange/views/transform.hpp>
+
+#include <forward_list>
+#include <list>
+#include <vector>
+
+#include "../catch.hpp"
+#include "../test_utils.hpp"
+
+namespace {
+
+template <typename Rng>
+std::vector<std::vector<int>> to_vectors(Rng&& rng)
+{
+    std::vector<std::vector<int>> out;
+    for (auto&& window : rng) {
+        out.emplace_back(nano::begin(window), nano::end(window));
+    }
+    return out;
+}
+
+constexpr bool test_constexpr()
+{
+    int arr[] = {1, 2, 3, 4};
+    auto rng = arr | nano::views::slide(3);
+    auto it = nano::begin(rng);
+    return nano::size(rng) == 2 &&
+           nano::equal(*it, nano::views::iota(1, 4)) &&
+           nano::equal(*++it, nano::views::iota(2, 5)) &&
+           ++it == nano::end(rng);
+}
+
+}
+
+TEST_CASE("views.slide")
+{
+    using nano::views::slide;
+
+    SECTION("random-access range")
+    {
+        std::vector<int> vec{0, 1, 2, 3, 4, 5};
+
+        auto rng = vec | slide(3);
+        using R = decltype(rng);
+        static_assert(nano::view<R>);
+        static_assert(nano::random_access_range<R>);
+        static_assert(nano::common_range<R>);
+        static_assert(nano::sized_range<R>);
+        static_assert(nano::same_as<nano::range_value_t<R>,
+                      nano::subrange<std::vector<int>::iterator>>);
+
+        CHECK(nano::size(rng) == 4);
+        CHECK(nano::distance(rng.begin(), rng.end()) == 4);
+        CHECK(to_vectors(rng) == std::vector<std::vector<int>>{
+                  {0, 1, 2}, {1, 2, 3}, {2, 3, 4}, {3, 4, 5}});
+
+        auto it = rng.begin();
+        CHECK(nano::equal(it[2], std::vector<int>{2, 3, 4}));
+        CHECK(it + 4 == rng.end());
+        CHECK(rng.end() - it == 4);
+        CHECK(nano::equal(*(rng.end() - 1), std::vector<int>{3, 4, 5}));
+
+        ::check_equal(rng | nano::views::reverse | nano::views::transform(
+                          [](auto w) { return *nano::begin(w); }),
+                      {3, 2, 1, 0});
+    }
+
+    SECTION("window the size of the range")
+    {
+        std::vector<int> vec{0, 1, 2};
+        auto rng = vec | slide(3);
+        CHECK(nano::size(rng) == 1);
+        CHECK(to_vectors(rng) == std::vector<std::vector<int>>{{0, 1, 2}});
+    }
+
+    SECTION("window larger than range")
+    {
+        std::vector<int> vec{0, 1, 2};
+        auto rng = vec | slide(4);
+        CHECK(nano::size(rng) == 0);
+        CHECK(rng.begin() == rng.end());
+        CHECK(rng.end() - rng.begin() == 0);
+    }
+
+    SECTION("window of one")
+    {
+        std::vector<int> vec{0, 1, 2};
+        auto rng = vec | slide(1);
+        CHECK(to_vectors(rng) == std::vector<std::vector<int>>{{0}, {1}, {2}});
+    }
+
+    SECTION("bidirectional range")
+    {
+        std::list<int> list{0, 1, 2, 3, 4};
+        auto rng = nano::views::slide(list, 2);
+        using R = decltype(rng);
+        static_assert(nano::bidirectional_range<R>);
+        static_assert(!nano::random_access_range<R>);
+        static_assert(nano::common_range<R>);
+        static_assert(nano::sized_range<R>);
+
+        CHECK(nano::size(rng) == 4);
+        CHECK(to_vectors(rng) == std::vector<std::vector<int>>{
+                  {0, 1}, {1, 2}, {2, 3}, {3, 4}});
+
+        auto it = nano::end(rng);
+        --it;
+        CHECK(nano::equal(*it, std::vector<int>{3, 4}));
+
+        auto short_rng = nano::views::slide(list, 6);
+        CHECK(short_rng.begin() == short_rng.end());
+    }
+
+    SECTION("forward range")
+    {
+        std::forward_list<int> list{0, 1, 2, 3};
+        auto rng = list | slide(2);
+        using R = decltype(rng);
+        static_assert(nano::forward_range<R>);
+        static_assert(!nano::bidirectional_range<R>);
+        static_assert(!nano::common_range<R>);
+
+        CHECK(to_vectors(rng) == std::vector<std::vector<int>>{
+                  {0, 1}, {1, 2}, {2, 3}});
+    }
+
+    SECTION("non-common range")
+    {
+        auto rng = nano::views::iota(0) | slide(3);
+        auto it = rng.begin();
+        it += 10;
+        CHECK(nano::equal(*it, std::vector<int>{10, 11, 12}));
+    }
+
+    SECTION("non-common sized range")
+    {
+        auto rng = nano::views::iota(0, 5) | slide(2);
+        CHECK(nano::size(rng) == 4);
+        CHECK(to_vectors(rng) == std::vector<std::vector<int>>{
+                  {0, 1}, {1, 2}, {2, 3}, {3, 4}});
+    }
+
+    SECTION("const iteration")
+    {
+        const std::vector<int> vec{0, 1, 2};
+        const auto rng = vec | slide(2);
+        CHECK(to_vectors(rng) == std::vector<std::vector<int>>{{0, 1}, {1, 2}});
+    }
+
+    SECTION("non-simple view")
+    {
+        std::vector<int> vec{0, 1, 2, 3, 4, 5};
+        auto rng = vec |
+                   nano::views::filter([](int i) { return i % 2 == 0; }) |
+                   slide(2);
+        CHECK(to_vectors(rng) == std::vector<std::vector<int>>{{0, 2}, {2, 4}});
+    }
+
+    SECTION("first window is cached")
+    {
+        std::vector<int> vec{0, 1, 2, 3, 4, 5};
+        int calls = 0;
+        auto rng = vec |
+                   nano::views::filter([&calls](int) { ++calls; return true; }) |
+                   slide(4);
+        static_assert(!nano::random_access_range<decltype(rng)>);
+
+        const auto first = rng.begin();
+        const int calls_after_first = calls;
+        CHECK(rng.begin() == first);
+        CHECK(calls == calls_after_first);
+        CHECK(nano::equal(*rng.begin(), std::vector<int>{0, 1, 2, 3}));
+    }
+
+    SECTION("constexpr")
+    {
+        static_assert(test_constexpr());
+    }
+}
@@ -19,8 +19,11 @@
 #include "../catch.hpp"
 #include "../test_utils.hpp"
 
+#include <cctype>
 #include <list>
 #include <sstream>
+#include <string>
+#include <vector>
 
 namespace ranges = nano::ranges;
 
@@ -254,3 +257,78 @@ TEST_CASE("views.split") {
 	static_assert(test_split_join());
 #endif
 }
+
+TEST_CASE("views.split.searchers") {
+	using namespace ranges;
+
+	const auto to_strings = [](auto&& rng) {
+		std::vector<std::string> out;
+		for (auto&& seg : rng) {
+			std::string s;
+			for (char c : seg) {
+				s.push_back(c);
+			}
+			out.push_back(std::move(s));
+		}
+		return out;
+	};
+
+	const std::string log = "alpha\r\nbeta\r\n\r\ngamma\r\n";
+	const std::vector<std::string> expected = {"alpha", "beta", "", "gamma"};
+
+	// Multi-element delimiter, using the default searcher
+	{
+		const std::string delim = "\r\n";
+		CHECK(to_strings(split_view{log, delim}) == expected);
+		CHECK(to_strings(views::split(log, delim)) == expected);
+		// Lvalue pattern in the pipe form
+		CHECK(to_strings(log | views::split(delim)) == expected);
+	}
+
+	// Explicit searchers
+	{
+		const std::string delim = "\r\n";
+		CHECK(to_strings(views::split(log, boyer_moore_horspool_searcher{delim})) == expected);
+		CHECK(to_strings(views::split(log, two_way_searcher{delim})) == expected);
+		CHECK(to_strings(log | views::split(naive_searcher{delim})) == expected);
+
+		auto sv = split_view{log, two_way_searcher{delim}};
+		static_assert(same_as<decltype(sv),
+			split_view<ref_view<const std::string>, ref_view<const std::string>,
+			           two_way_searcher<ref_view<const std::string>>>>);
+	}
+
+	// Searchers with a custom predicate are used for the inner ranges too
+	{
+		const auto ieq = [](char a, char b) {
+			return std::tolower(static_cast<unsigned char>(a)) ==
+			       std::tolower(static_cast<unsigned char>(b));
+		};
+		const std::string text = "oneANDtwoandthreeAnDfour";
+		const std::string delim = "and";
+		CHECK(to_strings(views::split(text, naive_searcher{delim, ieq})) ==
+		      std::vector<std::string>{"one", "two", "three", "four"});
+	}
+
+	// Non-random-access ranges fall back to the naive algorithm
+	{
+		const std::list<char> lst(log.begin(), log.end());
+		CHECK(to_strings(lst | views::split(std::string_view("\r\n"))) == expected);
+	}
+
+	// Long input with a delimiter longer than the skip table cap
+	{
+		const std::string delim = std::string(300, '-') + "|";
+		std::string text;
+		std::vector<std::string> parts;
+		for (int i = 0; i < 50; i++) {
+			parts.push_back(std::string(static_cast<std::size_t>(i * 7), 'a' + i % 26));
+			text += parts.back();
+			if (i != 49) {
+				text += delim;
+			}
+		}
+		CHECK(to_strings(views::split(text, delim)) == parts);
+		CHECK(to_strings(views::split(text, two_way_searcher{delim})) == parts);
+	}
+}
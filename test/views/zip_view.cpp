@@ -0,0 +1,243 @@
+// test/views/zip_view.cpp
+//
+// Copyright (c) 2020 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <nanorange/views/zip.hpp>
+
+#include <nanorange/algorithm/equal.hpp>
+#include <nanorange/algorithm/is_sorted.hpp>
+#include <nanorange/algorithm/reverse.hpp>
+#include <nanorange/algorithm/sort.hpp>
+#include <nanorange/algorithm/stable_sort.hpp>
+#include <nanorange/views/filter.hpp>
+#include <nanorange/views/iota.hpp>
+
+#include <forward_list>
+#include <list>
+#include <string>
+#include <vector>
+
+#include "../catch.hpp"
+#include "../test_utils.hpp"
+
+namespace {
+
+struct first_fn {
+    template <typename T>
+    constexpr auto operator()(const T& t) const
+        -> decltype(std::get<0>(t))
+    {
+        return std::get<0>(t);
+    }
+};
+
+constexpr bool test_constexpr()
+{
+    int a[] = {1, 2, 3};
+    long b[] = {10, 20};
+    auto rng = nano::views::zip(a, b);
+    auto it = nano::begin(rng);
+    const auto [x, y] = *it;
+    return x == 1 && y == 10 && nano::size(rng) == 2 &&
+           nano::end(rng) - it == 2;
+}
+
+}
+
+TEST_CASE("views.zip")
+{
+    using nano::views::zip;
+
+    SECTION("basic")
+    {
+        std::vector<int> ints{1, 2, 3};
+        std::vector<std::string> strs{"a", "b", "c"};
+
+        auto rng = zip(ints, strs);
+        using R = decltype(rng);
+        static_assert(nano::view<R>);
+        static_assert(nano::random_access_range<R>);
+        static_assert(nano::common_range<R>);
+        static_assert(nano::sized_range<R>);
+        static_assert(nano::random_access_range<const R>);
+        static_assert(nano::same_as<nano::range_value_t<R>,
+                                    std::tuple<int, std::string>>);
+        static_assert(nano::writable<nano::iterator_t<R>,
+                                     nano::range_value_t<R>>);
+        static_assert(nano::sortable<nano::iterator_t<R>>);
+
+        CHECK(nano::size(rng) == 3);
+        int i = 0;
+        for (auto [n, s] : rng) {
+            CHECK(n == ints[i]);
+            CHECK(s == strs[i]);
+            ++i;
+        }
+        CHECK(i == 3);
+
+        // Assignment writes through to the underlying ranges
+        for (auto [n, s] : rng) {
+            n *= 2;
+            s += "!";
+        }
+        CHECK(ints == std::vector<int>{2, 4, 6});
+        CHECK(strs == std::vector<std::string>{"a!", "b!", "c!"});
+
+        rng[1] = std::make_tuple(0, std::string("x"));
+        CHECK(ints[1] == 0);
+        CHECK(strs[1] == "x");
+    }
+
+    SECTION("different lengths")
+    {
+        std::vector<int> vec{1, 2, 3, 4, 5};
+        std::list<char> list{'a', 'b', 'c'};
+
+        auto rng = zip(vec, list);
+        static_assert(nano::bidirectional_range<decltype(rng)>);
+        static_assert(!nano::random_access_range<decltype(rng)>);
+        static_assert(!nano::common_range<decltype(rng)>);
+        CHECK(nano::size(rng) == 3);
+        CHECK(nano::distance(rng.begin(), rng.end()) == 3);
+
+        auto rng2 = zip(list, vec);
+        auto it = rng2.begin();
+        CHECK(std::get<0>(*it) == 'a');
+        CHECK(std::get<1>(*it) == 1);
+        ++it;
+        ++it;
+        ++it;
+        CHECK(it == rng2.end());
+
+        auto ra = zip(vec, nano::views::iota(0, 2));
+        static_assert(nano::common_range<decltype(ra)>);
+        CHECK(nano::size(ra) == 2);
+        CHECK(ra.end() - ra.begin() == 2);
+        CHECK(std::get<0>(*(ra.end() - 1)) == 2);
+    }
+
+    SECTION("forward and input ranges")
+    {
+        std::forward_list<int> flist{1, 2, 3};
+        std::vector<int> vec{4, 5, 6, 7};
+
+        auto rng = zip(flist, vec);
+        static_assert(nano::forward_range<decltype(rng)>);
+        static_assert(!nano::bidirectional_range<decltype(rng)>);
+
+        std::vector<int> sums;
+        for (auto [a, b] : rng) {
+            sums.push_back(a + b);
+        }
+        CHECK(sums == std::vector<int>{5, 7, 9});
+
+        auto filtered = zip(vec | nano::views::filter([](int i) {
+                                return i % 2 == 0;
+                            }),
+                            flist);
+        auto it = filtered.begin();
+        CHECK(std::get<0>(*it) == 4);
+        CHECK(std::get<1>(*it) == 1);
+        ++it;
+        CHECK(std::get<0>(*it) == 6);
+        CHECK(std::get<1>(*it) == 2);
+        ++it;
+        CHECK(it == filtered.end());
+    }
+
+    SECTION("const iteration")
+    {
+        const std::vector<int> a{1, 2};
+        std::vector<double> b{0.5, 1.5};
+
+        const auto rng = zip(a, b);
+        auto it = rng.begin();
+        static_assert(nano::same_as<decltype(std::get<0>(*it)), const int&>);
+        static_assert(nano::same_as<decltype(std::get<1>(*it)), double&>);
+        CHECK(std::get<1>(*it) == 0.5);
+    }
+
+    SECTION("iter_swap and iter_move")
+    {
+        std::vector<int> a{1, 2};
+        std::vector<std::string> b{"one", "two"};
+
+        auto rng = zip(a, b);
+        nano::iter_swap(rng.begin(), rng.begin() + 1);
+        CHECK(a == std::vector<int>{2, 1});
+        CHECK(b == std::vector<std::string>{"two", "one"});
+
+        std::tuple<int, std::string> tmp = nano::iter_move(rng.begin());
+        CHECK(std::get<0>(tmp) == 2);
+        CHECK(std::get<1>(tmp) == "two");
+        CHECK(b[0].empty());
+    }
+
+    SECTION("sorting structure-of-arrays data")
+    {
+        std::vector<int> keys{5, 3, 1, 4, 2};
+        std::vector<std::string> values{"five", "three", "one", "four", "two"};
+
+        nano::sort(zip(keys, values));
+        CHECK(keys == std::vector<int>{1, 2, 3, 4, 5});
+        CHECK(values == std::vector<std::string>{"one", "two", "three",
+                                                 "four", "five"});
+
+        nano::sort(zip(keys, values), nano::greater{}, first_fn{});
+        CHECK(keys == std::vector<int>{5, 4, 3, 2, 1});
+        CHECK(values == std::vector<std::string>{"five", "four", "three",
+                                                 "two", "one"});
+
+        std::vector<int> big_keys;
+        std::vector<int> big_vals;
+        for (int i = 0; i < 1000; i++) {
+            big_keys.push_back((i * 7919) % 1000);
+            big_vals.push_back(-big_keys.back());
+        }
+        nano::stable_sort(zip(big_keys, big_vals), nano::less{}, first_fn{});
+        CHECK(nano::is_sorted(big_keys));
+        for (std::size_t i = 0; i < big_keys.size(); i++) {
+            CHECK(big_vals[i] == -big_keys[i]);
+        }
+
+        nano::reverse(zip(big_keys, big_vals));
+        CHECK(nano::is_sorted(big_keys, nano::greater{}));
+    }
+
+    SECTION("empty and single ranges")
+    {
+        auto none = zip();
+        CHECK(nano::empty(none));
+
+        std::vector<int> vec{1, 2, 3};
+        auto one = zip(vec);
+        CHECK(nano::size(one) == 3);
+        CHECK(std::get<0>(*one.begin()) == 1);
+    }
+
+    SECTION("constexpr")
+    {
+        static_assert(test_constexpr());
+    }
+}
+
+TEST_CASE("views.zip_transform")
+{
+    using nano::views::zip_transform;
+
+    std::vector<int> a{1, 2, 3, 4};
+    std::list<int> b{10, 20, 30};
+
+    auto rng = zip_transform([](int x, int y) { return x + y; }, a, b);
+    static_assert(nano::view<decltype(rng)>);
+    static_assert(nano::bidirectional_range<decltype(rng)>);
+    CHECK(nano::equal(rng, std::vector<int>{11, 22, 33}));
+
+    auto sized = zip_transform([](int x, int y) { return x * y; }, a,
+                               nano::views::iota(1, 10));
+    static_assert(nano::random_access_range<decltype(sized)>);
+    CHECK(nano::size(sized) == 4);
+    CHECK(nano::equal(sized, std::vector<int>{1, 4, 9, 16}));
+}